@@ -0,0 +1,402 @@
+#include "NovaBridgeEditorInternals.h"
+
+#include "NovaBridgeActorLookupIndex.h"
+#include "NovaBridgeSceneChangeLog.h"
+#include "NovaBridgeSceneQuery.h"
+#include "Components/ActorComponent.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+// Game-thread only: every lookup and every delegate that touches it runs there.
+struct FNovaBridgeActorIndexState
+{
+	TWeakObjectPtr<UWorld> World;
+	NovaBridgeCore::TActorLookupIndex<TWeakObjectPtr<AActor>> Index;
+	NovaBridgeCore::TSceneChangeLog<TWeakObjectPtr<AActor>> Changes;
+	NovaBridgeCore::TSceneSpatialIndex<TWeakObjectPtr<AActor>> Spatial;
+	FDelegateHandle SpawnedHandle;
+	FDelegateHandle DestroyedHandle;
+	FDelegateHandle MovedHandle;
+	FDelegateHandle LevelActorAddedHandle;
+};
+
+FNovaBridgeActorIndexState NovaBridgeActorIndex;
+FDelegateHandle NovaBridgeLabelChangedHandle;
+FDelegateHandle NovaBridgeLevelAddedHandle;
+FDelegateHandle NovaBridgeLevelRemovedHandle;
+FDelegateHandle NovaBridgeWorldCleanupHandle;
+FDelegateHandle NovaBridgePropertyChangedHandle;
+FDelegateHandle NovaBridgeUndoRedoHandle;
+FDelegateHandle NovaBridgeObjectRenamedHandle;
+
+bool IsIndexedWorld(const UWorld* World)
+{
+	return World && NovaBridgeActorIndex.World.Get() == World;
+}
+
+FBox GetIndexedActorBounds(const AActor* Actor)
+{
+	// Actors without primitive components (lights, volumes without shapes) index as a point.
+	const FBox Bounds = Actor->GetComponentsBoundingBox(true);
+	if (Bounds.IsValid)
+	{
+		return Bounds;
+	}
+	const FVector Location = Actor->GetActorLocation();
+	return FBox(Location, Location);
+}
+
+void IndexActor(AActor* Actor)
+{
+	if (IsValid(Actor))
+	{
+		NovaBridgeActorIndex.Index.Add(Actor, Actor->GetFName(), Actor->GetActorLabel());
+		NovaBridgeActorIndex.Spatial.Update(Actor->GetUniqueID(), Actor, GetIndexedActorBounds(Actor));
+	}
+}
+
+void RecordSceneChange(NovaBridgeCore::ESceneChangeKind Kind, AActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	NovaBridgeActorIndex.Changes.Record(Kind, Actor->GetUniqueID(), Actor->GetFName(), Actor);
+	if (Kind == NovaBridgeCore::ESceneChangeKind::Removed || !IsValid(Actor))
+	{
+		NovaBridgeActorIndex.Spatial.Remove(Actor->GetUniqueID());
+	}
+	else
+	{
+		NovaBridgeActorIndex.Spatial.Update(Actor->GetUniqueID(), Actor, GetIndexedActorBounds(Actor));
+	}
+}
+
+void ReindexWorldActors(UWorld* World)
+{
+	NovaBridgeActorIndex.Index.Reset();
+	NovaBridgeActorIndex.Spatial.Reset();
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		IndexActor(*It);
+	}
+}
+
+void OnActorSpawned(AActor* Actor)
+{
+	IndexActor(Actor);
+	RecordSceneChange(NovaBridgeCore::ESceneChangeKind::Added, Actor);
+}
+
+void OnActorDestroyed(AActor* Actor)
+{
+	NovaBridgeActorIndex.Index.Remove(Actor);
+	RecordSceneChange(NovaBridgeCore::ESceneChangeKind::Removed, Actor);
+}
+
+void OnActorMoved(AActor* Actor)
+{
+	if (Actor && IsIndexedWorld(Actor->GetWorld()))
+	{
+		RecordSceneChange(NovaBridgeCore::ESceneChangeKind::Modified, Actor);
+	}
+}
+
+void OnActorLabelChanged(AActor* Actor)
+{
+	if (Actor && IsIndexedWorld(Actor->GetWorld()))
+	{
+		NovaBridgeActorIndex.Index.Relabel(Actor, Actor->GetActorLabel());
+		RecordSceneChange(NovaBridgeCore::ESceneChangeKind::Modified, Actor);
+	}
+}
+
+void OnLevelActorAdded(AActor* Actor)
+{
+	// Also fires for actors streamed in by world partition, which never go through the spawn handler.
+	if (Actor && IsIndexedWorld(Actor->GetWorld()))
+	{
+		IndexActor(Actor);
+	}
+}
+
+void OnObjectRenamed(UObject* Object, UObject* OldOuter, FName OldName)
+{
+	(void)OldOuter;
+	(void)OldName;
+	AActor* Actor = Cast<AActor>(Object);
+	if (Actor && IsIndexedWorld(Actor->GetWorld()))
+	{
+		// Add drops the entry under the old name.
+		IndexActor(Actor);
+	}
+}
+
+void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+	(void)Event;
+	if (!Object || Object->IsTemplate() || !NovaBridgeActorIndex.World.IsValid())
+	{
+		return;
+	}
+
+	// Component edits count as changes to the owning actor.
+	AActor* Actor = Cast<AActor>(Object);
+	if (!Actor)
+	{
+		if (const UActorComponent* Component = Cast<UActorComponent>(Object))
+		{
+			Actor = Component->GetOwner();
+		}
+	}
+	if (Actor && IsIndexedWorld(Actor->GetWorld()))
+	{
+		RecordSceneChange(NovaBridgeCore::ESceneChangeKind::Modified, Actor);
+	}
+}
+
+void OnUndoRedo()
+{
+	// Undo restores and removes actors without the spawn/destroy delegates, so the log cannot be trusted
+	// and bounds may have moved back; rebuild rather than patch.
+	if (UWorld* World = NovaBridgeActorIndex.World.Get())
+	{
+		NovaBridgeActorIndex.Changes.Reset();
+		ReindexWorldActors(World);
+	}
+}
+
+void OnLevelAdded(ULevel* Level, UWorld* World)
+{
+	if (Level && IsIndexedWorld(World))
+	{
+		for (AActor* Actor : Level->Actors)
+		{
+			IndexActor(Actor);
+			RecordSceneChange(NovaBridgeCore::ESceneChangeKind::Added, Actor);
+		}
+	}
+}
+
+void OnLevelRemoved(ULevel* Level, UWorld* World)
+{
+	if (Level && IsIndexedWorld(World))
+	{
+		for (AActor* Actor : Level->Actors)
+		{
+			NovaBridgeActorIndex.Index.Remove(Actor);
+			RecordSceneChange(NovaBridgeCore::ESceneChangeKind::Removed, Actor);
+		}
+	}
+}
+
+void UnbindIndexedWorld()
+{
+	if (UWorld* World = NovaBridgeActorIndex.World.Get())
+	{
+		World->RemoveOnActorSpawnedHandler(NovaBridgeActorIndex.SpawnedHandle);
+		World->RemoveOnActorDestroyededHandler(NovaBridgeActorIndex.DestroyedHandle);
+	}
+	if (GEngine)
+	{
+		GEngine->OnActorMoved().Remove(NovaBridgeActorIndex.MovedHandle);
+		GEngine->OnLevelActorAdded().Remove(NovaBridgeActorIndex.LevelActorAddedHandle);
+	}
+	NovaBridgeActorIndex.SpawnedHandle.Reset();
+	NovaBridgeActorIndex.DestroyedHandle.Reset();
+	NovaBridgeActorIndex.MovedHandle.Reset();
+	NovaBridgeActorIndex.LevelActorAddedHandle.Reset();
+	NovaBridgeActorIndex.World.Reset();
+	NovaBridgeActorIndex.Index.Reset();
+	NovaBridgeActorIndex.Spatial.Reset();
+	NovaBridgeActorIndex.Changes.Reset();
+}
+
+void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	(void)bSessionEnded;
+	(void)bCleanupResources;
+	if (IsIndexedWorld(World))
+	{
+		UnbindIndexedWorld();
+	}
+}
+
+void BindIndexedWorld(UWorld* World)
+{
+	if (IsIndexedWorld(World))
+	{
+		return;
+	}
+
+	UnbindIndexedWorld();
+	NovaBridgeActorIndex.World = World;
+	NovaBridgeActorIndex.SpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateStatic(&OnActorSpawned));
+	NovaBridgeActorIndex.DestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateStatic(&OnActorDestroyed));
+	if (GEngine)
+	{
+		NovaBridgeActorIndex.MovedHandle = GEngine->OnActorMoved().AddStatic(&OnActorMoved);
+		NovaBridgeActorIndex.LevelActorAddedHandle = GEngine->OnLevelActorAdded().AddStatic(&OnLevelActorAdded);
+	}
+	ReindexWorldActors(World);
+}
+
+AActor* ResolveBucket(const NovaBridgeCore::TActorLookupIndex<TWeakObjectPtr<AActor>>::FBucket* Bucket, UWorld* World, const FString& Name, bool bByLabel)
+{
+	if (!Bucket)
+	{
+		return nullptr;
+	}
+
+	for (const TWeakObjectPtr<AActor>& Handle : *Bucket)
+	{
+		// Renames bypass the delegates, so confirm the key still matches before trusting an entry.
+		AActor* Actor = Handle.Get();
+		if (IsValid(Actor) && Actor->GetWorld() == World && (bByLabel ? Actor->GetActorLabel() == Name : Actor->GetName() == Name))
+		{
+			return Actor;
+		}
+	}
+	return nullptr;
+}
+} // namespace
+
+void StartActorIndexService()
+{
+	NovaBridgeLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddStatic(&OnActorLabelChanged);
+	NovaBridgeLevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddStatic(&OnLevelAdded);
+	NovaBridgeLevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddStatic(&OnLevelRemoved);
+	NovaBridgeWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&OnWorldCleanup);
+	NovaBridgePropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(&OnObjectPropertyChanged);
+	NovaBridgeUndoRedoHandle = FEditorDelegates::PostUndoRedo.AddStatic(&OnUndoRedo);
+	NovaBridgeObjectRenamedHandle = FCoreUObjectDelegates::OnObjectRenamed.AddStatic(&OnObjectRenamed);
+}
+
+void StopActorIndexService()
+{
+	FCoreDelegates::OnActorLabelChanged.Remove(NovaBridgeLabelChangedHandle);
+	FWorldDelegates::LevelAddedToWorld.Remove(NovaBridgeLevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(NovaBridgeLevelRemovedHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(NovaBridgeWorldCleanupHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(NovaBridgePropertyChangedHandle);
+	FEditorDelegates::PostUndoRedo.Remove(NovaBridgeUndoRedoHandle);
+	FCoreUObjectDelegates::OnObjectRenamed.Remove(NovaBridgeObjectRenamedHandle);
+	UnbindIndexedWorld();
+}
+
+AActor* FindIndexedActor(UWorld* World, const FString& Name)
+{
+	check(IsInGameThread());
+	if (!World || Name.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	BindIndexedWorld(World);
+	const NovaBridgeCore::TActorLookupIndex<TWeakObjectPtr<AActor>>& Index = NovaBridgeActorIndex.Index;
+	if (AActor* Actor = ResolveBucket(Index.FindByName(FName(*Name, FNAME_Find)), World, Name, false))
+	{
+		return Actor;
+	}
+
+	// The delegates above keep the index complete (undo and level loads rebuild or extend it), so a miss
+	// is an answer and never falls back to walking the world.
+	return ResolveBucket(Index.FindByLabel(Name), World, Name, true);
+}
+
+uint64 GetSceneRevision(UWorld* World)
+{
+	check(IsInGameThread());
+	if (!World)
+	{
+		return 0;
+	}
+	BindIndexedWorld(World);
+	return NovaBridgeActorIndex.Changes.GetRevision();
+}
+
+bool CollectSceneChanges(UWorld* World, uint64 Since, TArray<NovaBridgeCore::TSceneChange<TWeakObjectPtr<AActor>>>& OutChanges)
+{
+	check(IsInGameThread());
+	if (!World)
+	{
+		return false;
+	}
+	BindIndexedWorld(World);
+	return NovaBridgeActorIndex.Changes.CollectSince(Since, OutChanges);
+}
+
+void NoteSceneActorModified(AActor* Actor)
+{
+	check(IsInGameThread());
+	if (Actor && IsIndexedWorld(Actor->GetWorld()))
+	{
+		RecordSceneChange(NovaBridgeCore::ESceneChangeKind::Modified, Actor);
+	}
+}
+
+void QueryIndexedActors(UWorld* World, const NovaBridgeCore::FSceneQueryShape& Shape, TArray<AActor*>& OutActors)
+{
+	check(IsInGameThread());
+	if (!World)
+	{
+		return;
+	}
+
+	BindIndexedWorld(World);
+	TArray<AActor*, TInlineAllocator<64>> Stale;
+	NovaBridgeActorIndex.Spatial.Query(Shape, [World, &Shape, &OutActors, &Stale](uint32 Id, const TWeakObjectPtr<AActor>& Handle, const FBox& Bounds)
+	{
+		(void)Id;
+		AActor* Actor = Handle.Get();
+		if (!IsValid(Actor) || Actor->GetWorld() != World)
+		{
+			return;
+		}
+
+		// Moves that bypassed the delegates leave stale bounds; confirm against the live bounds and
+		// repair the entry after the walk.
+		const FBox Live = GetIndexedActorBounds(Actor);
+		if (!(Live == Bounds))
+		{
+			Stale.Add(Actor);
+			if (!Shape.Intersects(Live))
+			{
+				return;
+			}
+		}
+		OutActors.Add(Actor);
+	});
+
+	for (AActor* Actor : Stale)
+	{
+		NovaBridgeActorIndex.Spatial.Update(Actor->GetUniqueID(), Actor, GetIndexedActorBounds(Actor));
+	}
+}
+
+AActor* FindNearestIndexedActor(UWorld* World, const FVector& Point, double Radius, FName ClassName)
+{
+	check(IsInGameThread());
+	if (!World || Radius <= 0.0)
+	{
+		return nullptr;
+	}
+
+	BindIndexedWorld(World);
+	TWeakObjectPtr<AActor> Nearest;
+	const bool bFound = NovaBridgeActorIndex.Spatial.FindNearest(Point, Radius, [World, ClassName](const TWeakObjectPtr<AActor>& Handle)
+	{
+		const AActor* Actor = Handle.Get();
+		return IsValid(Actor) && Actor->GetWorld() == World && (ClassName.IsNone() || ActorMatchesClassName(Actor, ClassName));
+	}, Nearest);
+	return bFound ? Nearest.Get() : nullptr;
+}
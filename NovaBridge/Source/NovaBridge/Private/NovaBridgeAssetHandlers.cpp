@@ -1,4 +1,7 @@
 #include "NovaBridgeModule.h"
+#include "NovaBridgeEditorInternals.h"
+#include "NovaBridgeModelImport.h"
+#include "NovaBridgeSceneSnapshot.h"
 
 #include "Async/Async.h"
 #include "AssetImportTask.h"
@@ -9,16 +12,61 @@
 #include "Factories/MaterialFactoryNew.h"
 #include "IAssetTools.h"
 #include "MeshDescription.h"
-#include "Misc/FileHelper.h"
 #include "Misc/PackageName.h"
 #include "Misc/Paths.h"
-#include "StaticMeshAttributes.h"
 #include "Engine/StaticMesh.h"
 #include "Materials/Material.h"
 #include "UObject/Package.h"
 #include "UObject/SavePackage.h"
 #include "UObject/SoftObjectPath.h"
 
+#include <atomic>
+
+namespace
+{
+std::atomic<uint64> NovaBridgeAssetRegistryRevision { 0 };
+FDelegateHandle NovaBridgeAssetAddedHandle;
+FDelegateHandle NovaBridgeAssetRemovedHandle;
+FDelegateHandle NovaBridgeAssetRenamedHandle;
+FDelegateHandle NovaBridgeAssetUpdatedHandle;
+
+void BumpAssetRegistryRevision()
+{
+	NovaBridgeAssetRegistryRevision.fetch_add(1, std::memory_order_release);
+}
+} // namespace
+
+void StartAssetRevisionService()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	NovaBridgeAssetAddedHandle = AssetRegistry.OnAssetAdded().AddLambda([](const FAssetData&) { BumpAssetRegistryRevision(); });
+	NovaBridgeAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddLambda([](const FAssetData&) { BumpAssetRegistryRevision(); });
+	NovaBridgeAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddLambda([](const FAssetData&, const FString&) { BumpAssetRegistryRevision(); });
+	NovaBridgeAssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddLambda([](const FAssetData&) { BumpAssetRegistryRevision(); });
+}
+
+void StopAssetRevisionService()
+{
+	// The registry may already be gone during editor shutdown.
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().Remove(NovaBridgeAssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(NovaBridgeAssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(NovaBridgeAssetRenamedHandle);
+		AssetRegistry.OnAssetUpdated().Remove(NovaBridgeAssetUpdatedHandle);
+	}
+	NovaBridgeAssetAddedHandle.Reset();
+	NovaBridgeAssetRemovedHandle.Reset();
+	NovaBridgeAssetRenamedHandle.Reset();
+	NovaBridgeAssetUpdatedHandle.Reset();
+}
+
+uint64 GetAssetRegistryRevision()
+{
+	return NovaBridgeAssetRegistryRevision.load(std::memory_order_acquire);
+}
+
 bool FNovaBridgeModule::HandleAssetList(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
 	FString Path = TEXT("/Game");
@@ -35,29 +83,30 @@ bool FNovaBridgeModule::HandleAssetList(const FHttpServerRequest& Request, const
 		}
 	}
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Path]()
+	DispatchGameThreadTask([this, OnComplete, Path]()
 	{
 		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 		IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
-		TArray<FAssetData> Assets;
-		AssetRegistry.GetAssetsByPath(FName(*Path), Assets, true);
+		TSharedRef<TArray<FAssetData>> Assets = MakeShared<TArray<FAssetData>>();
+		AssetRegistry.GetAssetsByPath(FName(*Path), *Assets, true);
 
-		TArray<TSharedPtr<FJsonValue>> AssetArray;
-		for (const FAssetData& Asset : Assets)
+		// FAssetData is all names, so the registry result itself is the snapshot; encoding moves to a worker.
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetNumberField(TEXT("count"), Assets->Num());
+		SendEncodedJsonResponse(OnComplete, Result, TEXT("assets"), [Assets](const NovaBridgeCore::FResponseProfile& Profile)
 		{
-			TSharedPtr<FJsonObject> AssetObj = MakeShareable(new FJsonObject);
-			AssetObj->SetStringField(TEXT("name"), Asset.AssetName.ToString());
-			AssetObj->SetStringField(TEXT("path"), Asset.GetObjectPathString());
-			AssetObj->SetStringField(TEXT("class"), Asset.AssetClassPath.GetAssetName().ToString());
-			AssetObj->SetStringField(TEXT("package"), Asset.PackageName.ToString());
-			AssetArray.Add(MakeShareable(new FJsonValueObject(AssetObj)));
-		}
-
-		TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
-		Result->SetArrayField(TEXT("assets"), AssetArray);
-		Result->SetNumberField(TEXT("count"), AssetArray.Num());
-		SendJsonResponse(OnComplete, Result);
+			(void)Profile;
+			return NovaBridgeCore::EncodeJsonArrayParallel<FAssetData>(*Assets, [](NovaBridgeCore::FSnapshotJsonWriter& Writer, const FAssetData& Asset)
+			{
+				Writer.WriteObjectStart();
+				Writer.WriteValue(TEXT("name"), Asset.AssetName.ToString());
+				Writer.WriteValue(TEXT("path"), Asset.GetObjectPathString());
+				Writer.WriteValue(TEXT("class"), Asset.AssetClassPath.GetAssetName().ToString());
+				Writer.WriteValue(TEXT("package"), Asset.PackageName.ToString());
+				Writer.WriteObjectEnd();
+			});
+		});
 	});
 	return true;
 }
@@ -75,7 +124,7 @@ bool FNovaBridgeModule::HandleAssetCreate(const FHttpServerRequest& Request, con
 	const FString Name = Body->GetStringField(TEXT("name"));
 	const FString Path = Body->HasField(TEXT("path")) ? Body->GetStringField(TEXT("path")) : TEXT("/Game");
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Type, Name, Path]()
+	DispatchGameThreadTask([this, OnComplete, Type, Name, Path]()
 	{
 		const FString PackagePath = Path / Name;
 		UPackage* Package = CreatePackage(*PackagePath);
@@ -126,7 +175,7 @@ bool FNovaBridgeModule::HandleAssetDuplicate(const FHttpServerRequest& Request,
 	const FString Source = Body->GetStringField(TEXT("source"));
 	const FString Destination = Body->GetStringField(TEXT("destination"));
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Source, Destination]()
+	DispatchGameThreadTask([this, OnComplete, Source, Destination]()
 	{
 #if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 7)
 		UObject* DuplicatedAsset = UEditorAssetLibrary::DuplicateAsset(Source, Destination);
@@ -159,7 +208,7 @@ bool FNovaBridgeModule::HandleAssetDelete(const FHttpServerRequest& Request, con
 
 	const FString AssetPath = Body->GetStringField(TEXT("path"));
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, AssetPath]()
+	DispatchGameThreadTask([this, OnComplete, AssetPath]()
 	{
 		const bool Success = UEditorAssetLibrary::DeleteAsset(AssetPath);
 		if (!Success)
@@ -184,7 +233,7 @@ bool FNovaBridgeModule::HandleAssetRename(const FHttpServerRequest& Request, con
 	const FString Source = Body->GetStringField(TEXT("source"));
 	const FString Destination = Body->GetStringField(TEXT("destination"));
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Source, Destination]()
+	DispatchGameThreadTask([this, OnComplete, Source, Destination]()
 	{
 		const bool Success = UEditorAssetLibrary::RenameAsset(Source, Destination);
 		if (!Success)
@@ -223,7 +272,7 @@ bool FNovaBridgeModule::HandleAssetInfo(const FHttpServerRequest& Request, const
 		return true;
 	}
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, AssetPath]()
+	DispatchGameThreadTask([this, OnComplete, AssetPath]()
 	{
 		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 		const FSoftObjectPath ObjectPath(AssetPath);
@@ -285,16 +334,17 @@ bool FNovaBridgeModule::HandleAssetImport(const FHttpServerRequest& Request, con
 	}
 
 	const bool bIsObj = FilePath.EndsWith(TEXT(".obj"), ESearchCase::IgnoreCase);
+	const bool bIsGlb = FilePath.EndsWith(TEXT(".glb"), ESearchCase::IgnoreCase);
 	const bool bIsFbx = FilePath.EndsWith(TEXT(".fbx"), ESearchCase::IgnoreCase);
-	if (!bIsObj && !bIsFbx)
+	if (!bIsObj && !bIsGlb && !bIsFbx)
 	{
-		SendErrorResponse(OnComplete, TEXT("Unsupported file format. Supported: .obj, .fbx"));
+		SendErrorResponse(OnComplete, TEXT("Unsupported file format. Supported: .obj, .glb, .fbx"));
 		return true;
 	}
 
 	if (bIsFbx)
 	{
-		AsyncTask(ENamedThreads::GameThread, [this, OnComplete, FilePath, AssetName, Destination]()
+		DispatchGameThreadTask([this, OnComplete, FilePath, AssetName, Destination]()
 		{
 			UAssetImportTask* Task = NewObject<UAssetImportTask>();
 			Task->Filename = FilePath;
@@ -334,202 +384,60 @@ bool FNovaBridgeModule::HandleAssetImport(const FHttpServerRequest& Request, con
 		return true;
 	}
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, FilePath, AssetName, Destination, ImportScale]()
+	// Parse (memory-mapped, chunked in parallel), validate and build the mesh description on a worker; the game
+	// thread only creates and saves the asset.
+	const FString Format = bIsObj ? TEXT("obj") : TEXT("glb");
+	DispatchBackgroundTask([this, OnComplete, FilePath, AssetName, Destination, ImportScale, Format]()
 	{
-		FString ObjContent;
-		if (!FFileHelper::LoadFileToString(ObjContent, *FilePath))
-		{
-			SendErrorResponse(OnComplete, TEXT("Failed to read OBJ file"));
-			return;
-		}
-
-		TArray<FVector> Positions;
-		TArray<FVector2D> UVs;
-		TArray<FVector> Normals;
-
-		struct ObjFaceVert
+		NovaBridgeCore::FMeshBuffers Mesh;
+		NovaBridgeCore::FModelImportStats Stats;
+		FString Error;
+		if (!NovaBridgeCore::ImportMeshFile(FilePath, ImportScale, Mesh, Stats, Error) || !NovaBridgeCore::ValidateMeshBuffers(Mesh, Error))
 		{
-			int32 PosIdx;
-			int32 UVIdx;
-			int32 NormIdx;
-		};
-		TArray<TArray<ObjFaceVert>> Faces;
-
-		TArray<FString> Lines;
-		ObjContent.ParseIntoArrayLines(Lines);
-
-		for (const FString& Line : Lines)
-		{
-			FString Trimmed = Line.TrimStartAndEnd();
-			if (Trimmed.StartsWith(TEXT("v ")))
+			DispatchGameThreadTask([this, OnComplete, Error]()
 			{
-				TArray<FString> Parts;
-				Trimmed.Mid(2).ParseIntoArrayWS(Parts);
-				if (Parts.Num() >= 3)
-				{
-					Positions.Add(FVector(FCString::Atof(*Parts[0]), FCString::Atof(*Parts[1]), FCString::Atof(*Parts[2])));
-				}
-			}
-			else if (Trimmed.StartsWith(TEXT("vt ")))
-			{
-				TArray<FString> Parts;
-				Trimmed.Mid(3).ParseIntoArrayWS(Parts);
-				if (Parts.Num() >= 2)
-				{
-					UVs.Add(FVector2D(FCString::Atof(*Parts[0]), FCString::Atof(*Parts[1])));
-				}
-			}
-			else if (Trimmed.StartsWith(TEXT("vn ")))
-			{
-				TArray<FString> Parts;
-				Trimmed.Mid(3).ParseIntoArrayWS(Parts);
-				if (Parts.Num() >= 3)
-				{
-					Normals.Add(FVector(FCString::Atof(*Parts[0]), FCString::Atof(*Parts[1]), FCString::Atof(*Parts[2])));
-				}
-			}
-			else if (Trimmed.StartsWith(TEXT("f ")))
-			{
-				TArray<FString> Parts;
-				Trimmed.Mid(2).ParseIntoArrayWS(Parts);
-				TArray<ObjFaceVert> FaceVerts;
-				for (const FString& P : Parts)
-				{
-					ObjFaceVert V = { -1, -1, -1 };
-					TArray<FString> Indices;
-					P.ParseIntoArray(Indices, TEXT("/"));
-					if (Indices.Num() >= 1 && !Indices[0].IsEmpty()) V.PosIdx = FCString::Atoi(*Indices[0]) - 1;
-					if (Indices.Num() >= 2 && !Indices[1].IsEmpty()) V.UVIdx = FCString::Atoi(*Indices[1]) - 1;
-					if (Indices.Num() >= 3 && !Indices[2].IsEmpty()) V.NormIdx = FCString::Atoi(*Indices[2]) - 1;
-					FaceVerts.Add(V);
-				}
-				if (FaceVerts.Num() >= 3)
-				{
-					Faces.Add(FaceVerts);
-				}
-			}
-		}
-
-		if (Positions.Num() == 0 || Faces.Num() == 0)
-		{
-			SendErrorResponse(OnComplete, FString::Printf(TEXT("OBJ parse failed: %d positions, %d faces"), Positions.Num(), Faces.Num()));
+				SendErrorResponse(OnComplete, Error);
+			});
 			return;
 		}
 
-		const FString MeshName = AssetName.IsEmpty() ? FPaths::GetBaseFilename(FilePath) : AssetName;
-		const FString PackagePath = Destination / MeshName;
-		UPackage* Package = CreatePackage(*PackagePath);
-		UStaticMesh* StaticMesh = NewObject<UStaticMesh>(Package, FName(*MeshName), RF_Public | RF_Standalone);
-
-		StaticMesh->GetStaticMaterials().Add(FStaticMaterial());
-
-		FMeshDescription MeshDesc;
-		FStaticMeshAttributes Attributes(MeshDesc);
-		Attributes.Register();
+		const int32 NumVerts = Mesh.NumVertices();
+		const int32 NumTris = Mesh.NumTriangles();
+		TSharedRef<FMeshDescription> MeshDesc = BuildMeshDescriptionFromBuffers(Mesh);
 
-		TArray<FVector> ExpandedPositions;
-		TArray<FVector2D> ExpandedUVs;
-		TArray<FVector> ExpandedNormals;
-		int32 VertIdx = 0;
-		for (const auto& Face : Faces)
+		DispatchGameThreadTask([this, OnComplete, FilePath, AssetName, Destination, ImportScale, Format, Stats, MeshDesc, NumVerts, NumTris]()
 		{
-			for (int32 i = 1; i < Face.Num() - 1; i++)
-			{
-				const ObjFaceVert* FVerts[3] = { &Face[0], &Face[i], &Face[i + 1] };
-				for (int32 j = 0; j < 3; j++)
-				{
-					const ObjFaceVert& FV = *FVerts[j];
-					if (FV.PosIdx >= 0 && FV.PosIdx < Positions.Num())
-					{
-						const FVector Pos = Positions[FV.PosIdx];
-						ExpandedPositions.Add(FVector(Pos.X * ImportScale, -Pos.Y * ImportScale, Pos.Z * ImportScale));
-					}
-					else
-					{
-						ExpandedPositions.Add(FVector::ZeroVector);
-					}
-
-					if (FV.UVIdx >= 0 && FV.UVIdx < UVs.Num())
-					{
-						const FVector2D UV = UVs[FV.UVIdx];
-						ExpandedUVs.Add(FVector2D(UV.X, 1.0f - UV.Y));
-					}
-					else
-					{
-						ExpandedUVs.Add(FVector2D(0, 0));
-					}
-
-					if (FV.NormIdx >= 0 && FV.NormIdx < Normals.Num())
-					{
-						const FVector N = Normals[FV.NormIdx];
-						ExpandedNormals.Add(FVector(N.X, -N.Y, N.Z));
-					}
-					else
-					{
-						ExpandedNormals.Add(FVector(0, 0, 1));
-					}
-
-					VertIdx++;
-				}
-			}
-		}
-
-		const int32 NumVerts = ExpandedPositions.Num();
-		const int32 NumTris = NumVerts / 3;
-		MeshDesc.ReserveNewVertices(NumVerts);
-		MeshDesc.ReserveNewVertexInstances(NumVerts);
-		MeshDesc.ReserveNewPolygons(NumTris);
-		MeshDesc.ReserveNewEdges(NumTris * 3);
+			const FString MeshName = AssetName.IsEmpty() ? FPaths::GetBaseFilename(FilePath) : AssetName;
+			const FString PackagePath = Destination / MeshName;
+			UPackage* Package = CreatePackage(*PackagePath);
+			UStaticMesh* StaticMesh = NewObject<UStaticMesh>(Package, FName(*MeshName), RF_Public | RF_Standalone);
 
-		FPolygonGroupID PolyGroup = MeshDesc.CreatePolygonGroup();
+			StaticMesh->GetStaticMaterials().Add(FStaticMaterial());
 
-		TVertexAttributesRef<FVector3f> VertexPositions = Attributes.GetVertexPositions();
-		TVertexInstanceAttributesRef<FVector3f> VertexInstanceNormals = Attributes.GetVertexInstanceNormals();
-		TVertexInstanceAttributesRef<FVector2f> VertexInstanceUVs = Attributes.GetVertexInstanceUVs();
+			TArray<const FMeshDescription*> MeshDescriptions;
+			MeshDescriptions.Add(&MeshDesc.Get());
+			StaticMesh->BuildFromMeshDescriptions(MeshDescriptions);
 
-		TArray<FVertexID> VertexIDs;
-		TArray<FVertexInstanceID> VertexInstanceIDs;
-		VertexIDs.SetNum(NumVerts);
-		VertexInstanceIDs.SetNum(NumVerts);
+			FAssetRegistryModule::AssetCreated(StaticMesh);
+			Package->MarkPackageDirty();
+			const FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
+			FSavePackageArgs SaveArgs;
+			SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+			UPackage::SavePackage(Package, StaticMesh, *PackageFileName, SaveArgs);
 
-		for (int32 i = 0; i < NumVerts; i++)
-		{
-			VertexIDs[i] = MeshDesc.CreateVertex();
-			VertexPositions[VertexIDs[i]] = FVector3f(ExpandedPositions[i]);
-			VertexInstanceIDs[i] = MeshDesc.CreateVertexInstance(VertexIDs[i]);
-			VertexInstanceNormals[VertexInstanceIDs[i]] = FVector3f(ExpandedNormals[i]);
-			VertexInstanceUVs[VertexInstanceIDs[i]] = FVector2f(ExpandedUVs[i]);
-		}
-
-		for (int32 i = 0; i < NumTris; i++)
-		{
-			TArray<FVertexInstanceID> TriVerts;
-			TriVerts.Add(VertexInstanceIDs[i * 3 + 0]);
-			TriVerts.Add(VertexInstanceIDs[i * 3 + 1]);
-			TriVerts.Add(VertexInstanceIDs[i * 3 + 2]);
-			MeshDesc.CreatePolygon(PolyGroup, TriVerts);
-		}
-
-		TArray<const FMeshDescription*> MeshDescriptions;
-		MeshDescriptions.Add(&MeshDesc);
-		StaticMesh->BuildFromMeshDescriptions(MeshDescriptions);
-
-		FAssetRegistryModule::AssetCreated(StaticMesh);
-		Package->MarkPackageDirty();
-		const FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-		FSavePackageArgs SaveArgs;
-		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-		UPackage::SavePackage(Package, StaticMesh, *PackageFileName, SaveArgs);
-
-		TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
-		Result->SetStringField(TEXT("status"), TEXT("ok"));
-		Result->SetStringField(TEXT("asset_path"), PackagePath + TEXT(".") + MeshName);
-		Result->SetNumberField(TEXT("vertices"), NumVerts);
-		Result->SetNumberField(TEXT("triangles"), NumTris);
-		Result->SetNumberField(TEXT("original_positions"), Positions.Num());
-		Result->SetNumberField(TEXT("original_faces"), Faces.Num());
-		Result->SetNumberField(TEXT("import_scale"), ImportScale);
-		SendJsonResponse(OnComplete, Result);
+			TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+			Result->SetStringField(TEXT("status"), TEXT("ok"));
+			Result->SetStringField(TEXT("format"), Format);
+			Result->SetStringField(TEXT("asset_path"), PackagePath + TEXT(".") + MeshName);
+			Result->SetNumberField(TEXT("vertices"), NumVerts);
+			Result->SetNumberField(TEXT("triangles"), NumTris);
+			Result->SetNumberField(TEXT("original_positions"), Stats.SourcePositions);
+			Result->SetNumberField(TEXT("original_faces"), Stats.SourceFaces);
+			Result->SetNumberField(TEXT("parse_chunks"), Stats.ParseChunks);
+			Result->SetBoolField(TEXT("memory_mapped"), Stats.bMemoryMapped);
+			Result->SetNumberField(TEXT("import_scale"), ImportScale);
+			SendJsonResponse(OnComplete, Result);
+		});
 	});
 	return true;
 }
@@ -0,0 +1,248 @@
+#include "NovaBridgeModule.h"
+#include "NovaBridgeEditorInternals.h"
+
+#include "NovaBridgeAdmission.h"
+#include "NovaBridgeBatch.h"
+#include "NovaBridgeHttpUtils.h"
+#include "NovaBridgeMetrics.h"
+#include "NovaBridgeRateLimiter.h"
+#include "NovaBridgeRoutePolicy.h"
+#include "NovaBridgeTaskLanes.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "HttpPath.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+
+// Shared by the batch's game-thread loop and the callbacks of its entries. Only touched on the game thread.
+struct FNovaBridgeBatchState
+{
+	TArray<NovaBridgeCore::FBatchSubRequest> Requests;
+	bool bStopOnError = false;
+	FString Role;
+	int32 RoleSlot = 0;
+	TMap<FString, TArray<FString>> Headers;
+	FHttpResultCallback OnComplete;
+	// The batch's deadline; entries inherit it and no new entry starts once it has passed.
+	NovaBridgeCore::FCancellationTokenPtr Cancellation;
+
+	TArray<NovaBridgeCore::FBatchResult> Results;
+	int32 Next = 0;
+	bool bPending = false;
+	bool bRunning = false;
+	bool bStopped = false;
+};
+
+namespace
+{
+bool IsBatchDroppedHeader(const FString& Name)
+{
+	// Entries carry their own bodies and are never compressed or revalidated on their own; the role is pinned below.
+	static const TCHAR* const Dropped[] = {
+		TEXT("Content-Length"),
+		TEXT("Content-Type"),
+		TEXT("Content-Encoding"),
+		TEXT("Accept-Encoding"),
+		TEXT("If-None-Match"),
+		TEXT("X-NovaBridge-Role"),
+	};
+	for (const TCHAR* Header : Dropped)
+	{
+		if (Name.Equals(Header, ESearchCase::IgnoreCase))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+} // namespace
+
+bool FNovaBridgeModule::HandleBatch(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	TSharedPtr<FJsonObject> Body = ParseRequestBody(Request);
+	if (!Body)
+	{
+		SendErrorResponse(OnComplete, TEXT("Invalid JSON body"));
+		return true;
+	}
+
+	const TSharedRef<FNovaBridgeBatchState> State = MakeShared<FNovaBridgeBatchState>();
+	FString Error;
+	if (!NovaBridgeCore::ParseBatchRequest(*Body, State->Requests, State->bStopOnError, Error))
+	{
+		SendErrorResponse(OnComplete, Error, 400);
+		return true;
+	}
+
+	State->Role = ResolveRoleFromRequest(Request);
+	State->RoleSlot = NovaBridgeCore::FTokenBucketRateLimiter::RoleSlotForName(State->Role);
+	for (const TPair<FString, TArray<FString>>& Header : Request.Headers)
+	{
+		if (!IsBatchDroppedHeader(Header.Key))
+		{
+			State->Headers.Add(Header.Key, Header.Value);
+		}
+	}
+	// Entries run as the batch's caller; a role in an entry's query cannot override the header.
+	State->Headers.Add(TEXT("X-NovaBridge-Role"), { State->Role });
+	State->OnComplete = OnComplete;
+	State->Cancellation = GetCurrentCancellationToken();
+	State->Results.Reserve(State->Requests.Num());
+
+	DispatchGameThreadTask([this, State]()
+	{
+		RunBatchRequests(State);
+	});
+	return true;
+}
+
+void FNovaBridgeModule::RunBatchRequests(const TSharedRef<FNovaBridgeBatchState>& State)
+{
+	// Entries that answer inline complete inside StartBatchSubRequest, so the loop keeps going in this task.
+	// One that waits on a worker or the renderer resumes the loop from its callback.
+	State->bRunning = true;
+	while (!State->bPending && !State->bStopped && State->Next < State->Requests.Num())
+	{
+		if (State->Cancellation.IsValid() && State->Cancellation->IsCancelled())
+		{
+			// Entries not started are left out of the results, as with stop_on_error.
+			State->bStopped = true;
+			break;
+		}
+		const int32 Index = State->Next++;
+		State->bPending = true;
+		StartBatchSubRequest(State, Index);
+	}
+	State->bRunning = false;
+	if (State->bPending)
+	{
+		return;
+	}
+
+	const double SerializeStartSec = FPlatformTime::Seconds();
+	const FString Json = NovaBridgeCore::ComposeBatchResponseJson(State->Results, State->Requests.Num());
+	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(Json, TEXT("application/json"));
+	RecordResponseSerializeTime(FPlatformTime::Seconds() - SerializeStartSec);
+	AddCorsHeaders(Response);
+	State->OnComplete(MoveTemp(Response));
+}
+
+void FNovaBridgeModule::StartBatchSubRequest(const TSharedRef<FNovaBridgeBatchState>& State, int32 Index)
+{
+	const NovaBridgeCore::FBatchSubRequest& Entry = State->Requests[Index];
+
+	const FHttpResultCallback Collect = [this, State, Route = Entry.Route, Verb = Entry.Verb](TUniquePtr<FHttpServerResponse>&& Response)
+	{
+		NovaBridgeCore::FBatchResult Result;
+		Result.Route = Route;
+		Result.Verb = Verb;
+		Result.Status = Response ? static_cast<int32>(Response->Code) : 500;
+		if (Response)
+		{
+			const TArray<FString>* ContentType = Response->Headers.Find(TEXT("Content-Type"));
+			Result.ContentType = ContentType && ContentType->Num() > 0 ? (*ContentType)[0] : FString();
+			Result.Body = MoveTemp(Response->Body);
+		}
+
+		auto Record = [this, State, Result = MoveTemp(Result)]() mutable
+		{
+			if (State->bStopOnError && Result.Status >= 400)
+			{
+				State->bStopped = true;
+			}
+			State->Results.Add(MoveTemp(Result));
+			State->bPending = false;
+			if (!State->bRunning)
+			{
+				RunBatchRequests(State);
+			}
+		};
+		if (IsInGameThread())
+		{
+			Record();
+		}
+		else
+		{
+			AsyncTask(ENamedThreads::GameThread, MoveTemp(Record));
+		}
+	};
+
+	const FBatchRoute* Route = Entry.Route != TEXT("/nova/batch") ? BatchRoutes.Find(Entry.Route) : nullptr;
+	if (!Route)
+	{
+		SendErrorResponse(Collect, FString::Printf(TEXT("Unknown route: %s"), *Entry.Route), 404);
+		return;
+	}
+	if (!EnumHasAnyFlags(Route->Verbs, Entry.Verb))
+	{
+		SendErrorResponse(Collect, FString::Printf(TEXT("%s does not accept %s"), *Entry.Route, NovaBridgeCore::HttpVerbToString(Entry.Verb)), 405);
+		return;
+	}
+
+	const bool bAuditDenials = Route->Policy->AuditLevel != NovaBridgeCore::ERouteAuditLevel::Quiet;
+	if (!Route->Policy->Allows(State->RoleSlot, Entry.Verb))
+	{
+		if (bAuditDenials)
+		{
+			PushAuditEntry(Entry.Route, TEXT("batch"), State->Role, TEXT("denied"), TEXT("Role does not have permission for this endpoint"));
+		}
+		SendErrorResponse(Collect, TEXT("Permission denied for role on this endpoint"), 403);
+		return;
+	}
+
+	NovaBridgeCore::FRateLimitDecision RateDecision;
+	FString RateError;
+	if (!ConsumeRateLimit(Route->Policy->RateRouteId, State->RoleSlot, Route->Policy->RateLimitFor(State->RoleSlot), RateDecision, RateError))
+	{
+		if (bAuditDenials)
+		{
+			PushAuditEntry(Entry.Route, TEXT("batch"), State->Role, TEXT("rate_limited"), RateError);
+		}
+		SendErrorResponse(Collect, RateError, 429);
+		return;
+	}
+
+	// Entries hold a slot in their own class, so a batch cannot get past the heavy in-flight cap.
+	const NovaBridgeCore::ERouteClass EntryClass = Route->Policy->RouteClass;
+	const NovaBridgeCore::FAdmissionDecision Admission = GetAdmissionController().TryAdmit(EntryClass);
+	if (!Admission.bAdmitted)
+	{
+		const FString Message = FString::Printf(TEXT("Editor busy: %d %s requests in flight, estimated wait %d ms"),
+			Admission.InFlight, NovaBridgeCore::RouteClassToString(Admission.Class), Admission.EstimatedWaitMs);
+		if (bAuditDenials)
+		{
+			PushAuditEntry(Entry.Route, TEXT("batch"), State->Role, TEXT("overloaded"), Message);
+		}
+		SendErrorResponse(Collect, Message, 503);
+		return;
+	}
+	const FHttpResultCallback AdmittedCollect = NovaBridgeCore::WrapResultCallbackWithAdmission(GetAdmissionController(), EntryClass, Collect);
+
+	FHttpServerRequest SubRequest;
+	SubRequest.Verb = Entry.Verb;
+	SubRequest.RelativePath = FHttpPath(Entry.Route);
+	SubRequest.Headers = State->Headers;
+	SubRequest.QueryParams = Entry.QueryParams;
+	SubRequest.Body = Entry.Body;
+	if (Entry.Body.Num() > 0)
+	{
+		SubRequest.Headers.Add(TEXT("Content-Type"), { TEXT("application/json") });
+	}
+
+	// Entries keep the batch's response profile and are counted under their own route.
+	const TSharedRef<FNovaBridgeRequestTiming> Timing = MakeShared<FNovaBridgeRequestTiming>();
+	Timing->Route = Route->Metrics;
+	Timing->Profile = GetCurrentResponseProfile();
+	// Heavy entries queue their game-thread work in the heavy lane and the batch waits for them, as for an
+	// entry that waits on a worker; the rest run inline in the batch's task.
+	Timing->Lane = NovaBridgeCore::TaskLaneForRouteClass(EntryClass);
+	Timing->bInlineGameThreadDispatch = Timing->Lane != NovaBridgeCore::ETaskLane::Heavy;
+	Timing->Cancellation = State->Cancellation;
+	const FHttpResultCallback TimedCollect = WrapResultCallbackWithMetrics(Timing, AdmittedCollect);
+
+	FNovaBridgeRequestScope RequestScope(Timing);
+	if (!(this->*(Route->Handler))(SubRequest, TimedCollect))
+	{
+		SendErrorResponse(TimedCollect, FString::Printf(TEXT("Unknown route: %s"), *Entry.Route), 404);
+	}
+}
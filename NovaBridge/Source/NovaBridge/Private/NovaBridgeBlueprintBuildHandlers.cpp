@@ -1,4 +1,5 @@
 #include "NovaBridgeModule.h"
+#include "NovaBridgeEditorInternals.h"
 
 #include "Async/Async.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -27,7 +28,7 @@ bool FNovaBridgeModule::HandleBlueprintCreate(const FHttpServerRequest& Request,
 	const FString Path = Body->HasField(TEXT("path")) ? Body->GetStringField(TEXT("path")) : TEXT("/Game");
 	const FString ParentClass = Body->HasField(TEXT("parent_class")) ? Body->GetStringField(TEXT("parent_class")) : TEXT("Actor");
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Name, Path, ParentClass]()
+	DispatchGameThreadTask([this, OnComplete, Name, Path, ParentClass]()
 	{
 		UClass* Parent = AActor::StaticClass();
 		if (ParentClass != TEXT("Actor"))
@@ -84,7 +85,7 @@ bool FNovaBridgeModule::HandleBlueprintAddComponent(const FHttpServerRequest& Re
 	const FString ComponentClass = Body->GetStringField(TEXT("component_class"));
 	const FString ComponentName = Body->HasField(TEXT("component_name")) ? Body->GetStringField(TEXT("component_name")) : TEXT("");
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, BlueprintPath, ComponentClass, ComponentName]()
+	DispatchGameThreadTask([this, OnComplete, BlueprintPath, ComponentClass, ComponentName]()
 	{
 		UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
 		if (!Blueprint)
@@ -134,7 +135,7 @@ bool FNovaBridgeModule::HandleBlueprintCompile(const FHttpServerRequest& Request
 
 	const FString BlueprintPath = Body->GetStringField(TEXT("blueprint"));
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, BlueprintPath]()
+	DispatchGameThreadTask([this, OnComplete, BlueprintPath]()
 	{
 		UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
 		if (!Blueprint)
@@ -157,7 +158,7 @@ bool FNovaBridgeModule::HandleBlueprintCompile(const FHttpServerRequest& Request
 bool FNovaBridgeModule::HandleBuildLighting(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
 	(void)Request;
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete]()
+	DispatchGameThreadTask([this, OnComplete]()
 	{
 		if (!GEditor)
 		{
@@ -182,7 +183,7 @@ bool FNovaBridgeModule::HandleExecCommand(const FHttpServerRequest& Request, con
 
 	const FString Command = Body->GetStringField(TEXT("command"));
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Command]()
+	DispatchGameThreadTask([this, OnComplete, Command]()
 	{
 		if (!GEditor)
 		{
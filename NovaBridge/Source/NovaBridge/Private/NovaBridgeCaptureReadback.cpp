@@ -0,0 +1,406 @@
+#include "NovaBridgeEditorInternals.h"
+
+#include "NovaBridgeCapturePattern.h"
+#include "NovaBridgeModule.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/ScopeLock.h"
+#include "RenderingThread.h"
+#include "RHI.h"
+#include "RHIGPUReadback.h"
+#include "TextureResource.h"
+
+namespace
+{
+enum class ENovaBridgeReadbackSlotState : uint8
+{
+	Free,
+	Submitted,
+	Polling,
+	Delivering,
+	// Timed out and answered, but the GPU copy may still land in the buffer; reused once it reports ready.
+	Quarantined,
+	Draining,
+};
+
+struct FNovaBridgeReadbackSlot
+{
+	TUniquePtr<FRHIGPUTextureReadback> Readback;
+	FNovaBridgeReadbackCallback OnReady;
+	ENovaBridgeReadbackSlotState State = ENovaBridgeReadbackSlotState::Free;
+	int32 Width = 0;
+	int32 Height = 0;
+	double SubmitTimeSec = 0.0;
+};
+
+struct FNovaBridgeSoftwareReadback
+{
+	FNovaBridgeReadbackCallback OnReady;
+	int32 Width = 0;
+	int32 Height = 0;
+};
+
+FCriticalSection NovaBridgeReadbackMutex;
+TArray<TUniquePtr<FNovaBridgeReadbackSlot>> NovaBridgeReadbackSlots;
+TArray<FNovaBridgeSoftwareReadback> NovaBridgeSoftwareReadbacks;
+FTSTicker::FDelegateHandle NovaBridgeReadbackTickHandle;
+FNovaBridgeReadbackStats NovaBridgeReadbackCounters;
+const int32 NovaBridgeReadbackSlotCount = 4;
+const double NovaBridgeReadbackTimeoutSec = 2.0;
+
+bool ShouldUseSoftwareReadback()
+{
+	return GUsingNullRHI || !FApp::CanEverRender();
+}
+
+void DeliverReadback(FNovaBridgeReadbackCallback&& OnReady, FNovaBridgeReadbackResult&& Result)
+{
+	if (OnReady)
+	{
+		OnReady(MoveTemp(Result));
+	}
+}
+
+bool ReadRenderTargetSynchronously(UTextureRenderTarget2D* RenderTarget, FNovaBridgeReadbackResult& OutResult)
+{
+	FTextureRenderTargetResource* RTResource = RenderTarget ? RenderTarget->GameThread_GetRenderTargetResource() : nullptr;
+	if (!RTResource)
+	{
+		OutResult.Error = TEXT("No render target resource");
+		return false;
+	}
+
+	OutResult.Width = RenderTarget->SizeX;
+	OutResult.Height = RenderTarget->SizeY;
+	OutResult.Source = TEXT("sync");
+	if (!RTResource->ReadPixels(OutResult.Pixels) || OutResult.Pixels.Num() == 0)
+	{
+		OutResult.Error = TEXT("Failed to read render target pixels");
+		return false;
+	}
+	return true;
+}
+
+void CompleteSlot(FNovaBridgeReadbackSlot* Slot, FNovaBridgeReadbackResult&& Result)
+{
+	FNovaBridgeReadbackCallback OnReady;
+	{
+		FScopeLock Lock(&NovaBridgeReadbackMutex);
+		const bool bSlotAlive = NovaBridgeReadbackSlots.ContainsByPredicate([Slot](const TUniquePtr<FNovaBridgeReadbackSlot>& Candidate)
+		{
+			return Candidate.Get() == Slot;
+		});
+		if (!bSlotAlive)
+		{
+			return;
+		}
+		OnReady = MoveTemp(Slot->OnReady);
+		Slot->OnReady = nullptr;
+		Slot->State = ENovaBridgeReadbackSlotState::Free;
+		if (Result.bSuccess)
+		{
+			NovaBridgeReadbackCounters.Completed++;
+		}
+		else
+		{
+			NovaBridgeReadbackCounters.Failed++;
+		}
+	}
+	DeliverReadback(MoveTemp(OnReady), MoveTemp(Result));
+}
+
+void PollReadbackSlot(FNovaBridgeReadbackSlot* Slot)
+{
+	FRHIGPUTextureReadback* Readback = Slot->Readback.Get();
+	const int32 Width = Slot->Width;
+	const int32 Height = Slot->Height;
+
+	ENQUEUE_RENDER_COMMAND(NovaBridgePollReadback)([Slot, Readback, Width, Height](FRHICommandListImmediate& RHICmdList)
+	{
+		(void)RHICmdList;
+		if (!Readback->IsReady())
+		{
+			FScopeLock Lock(&NovaBridgeReadbackMutex);
+			Slot->State = ENovaBridgeReadbackSlotState::Submitted;
+			return;
+		}
+
+		FNovaBridgeReadbackResult Result;
+		Result.Width = Width;
+		Result.Height = Height;
+		Result.Source = TEXT("gpu_async");
+
+		int32 RowPitchInPixels = 0;
+		const FColor* Source = static_cast<const FColor*>(Readback->Lock(RowPitchInPixels));
+		if (Source && RowPitchInPixels >= Width)
+		{
+			Result.Pixels.SetNumUninitialized(Width * Height);
+			for (int32 Row = 0; Row < Height; ++Row)
+			{
+				FMemory::Memcpy(&Result.Pixels[Row * Width], Source + static_cast<int64>(Row) * RowPitchInPixels, Width * sizeof(FColor));
+			}
+			Result.bSuccess = true;
+		}
+		else
+		{
+			Result.Error = TEXT("Failed to map GPU readback buffer");
+		}
+		Readback->Unlock();
+
+		{
+			FScopeLock Lock(&NovaBridgeReadbackMutex);
+			Slot->State = ENovaBridgeReadbackSlotState::Delivering;
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [Slot, Result = MoveTemp(Result)]() mutable
+		{
+			CompleteSlot(Slot, MoveTemp(Result));
+		});
+	});
+}
+
+void DrainQuarantinedSlot(FNovaBridgeReadbackSlot* Slot)
+{
+	FRHIGPUTextureReadback* Readback = Slot->Readback.Get();
+	ENQUEUE_RENDER_COMMAND(NovaBridgeDrainReadback)([Slot, Readback](FRHICommandListImmediate& RHICmdList)
+	{
+		(void)RHICmdList;
+		const bool bReady = Readback->IsReady();
+		FScopeLock Lock(&NovaBridgeReadbackMutex);
+		Slot->State = bReady ? ENovaBridgeReadbackSlotState::Free : ENovaBridgeReadbackSlotState::Quarantined;
+	});
+}
+
+bool TickCaptureReadbacks(float DeltaTime)
+{
+	(void)DeltaTime;
+
+	TArray<FNovaBridgeSoftwareReadback> SoftwareReadbacks;
+	TArray<FNovaBridgeReadbackSlot*> SlotsToPoll;
+	TArray<FNovaBridgeReadbackSlot*> SlotsToDrain;
+	TArray<FNovaBridgeReadbackResult> TimedOutResults;
+	TArray<FNovaBridgeReadbackCallback> TimedOutCallbacks;
+	{
+		FScopeLock Lock(&NovaBridgeReadbackMutex);
+		SoftwareReadbacks = MoveTemp(NovaBridgeSoftwareReadbacks);
+		NovaBridgeSoftwareReadbacks.Reset();
+
+		const double NowSec = FPlatformTime::Seconds();
+		for (const TUniquePtr<FNovaBridgeReadbackSlot>& Slot : NovaBridgeReadbackSlots)
+		{
+			if (Slot->State == ENovaBridgeReadbackSlotState::Quarantined)
+			{
+				Slot->State = ENovaBridgeReadbackSlotState::Draining;
+				SlotsToDrain.Add(Slot.Get());
+				continue;
+			}
+			if (Slot->State != ENovaBridgeReadbackSlotState::Submitted)
+			{
+				continue;
+			}
+			if ((NowSec - Slot->SubmitTimeSec) > NovaBridgeReadbackTimeoutSec)
+			{
+				// Answer the caller now; the slot stays out of the ring until its copy has landed, without
+				// flushing the render thread to find out.
+				FNovaBridgeReadbackResult& Result = TimedOutResults.AddDefaulted_GetRef();
+				Result.Width = Slot->Width;
+				Result.Height = Slot->Height;
+				Result.Source = TEXT("gpu_async");
+				Result.Error = TEXT("GPU readback timed out");
+				TimedOutCallbacks.Add(MoveTemp(Slot->OnReady));
+				Slot->OnReady = nullptr;
+				Slot->State = ENovaBridgeReadbackSlotState::Quarantined;
+				NovaBridgeReadbackCounters.TimedOut++;
+				NovaBridgeReadbackCounters.Failed++;
+				continue;
+			}
+			Slot->State = ENovaBridgeReadbackSlotState::Polling;
+			SlotsToPoll.Add(Slot.Get());
+		}
+	}
+
+	for (FNovaBridgeSoftwareReadback& Pending : SoftwareReadbacks)
+	{
+		FNovaBridgeReadbackResult Result;
+		Result.Width = Pending.Width;
+		Result.Height = Pending.Height;
+		Result.Source = TEXT("software");
+		Result.bSuccess = true;
+		NovaBridgeCore::FillSoftwareCapturePattern(Pending.Width, Pending.Height, Result.Pixels);
+		{
+			FScopeLock Lock(&NovaBridgeReadbackMutex);
+			NovaBridgeReadbackCounters.Completed++;
+		}
+		DeliverReadback(MoveTemp(Pending.OnReady), MoveTemp(Result));
+	}
+
+	for (FNovaBridgeReadbackSlot* Slot : SlotsToPoll)
+	{
+		PollReadbackSlot(Slot);
+	}
+
+	for (FNovaBridgeReadbackSlot* Slot : SlotsToDrain)
+	{
+		DrainQuarantinedSlot(Slot);
+	}
+
+	for (int32 Index = 0; Index < TimedOutCallbacks.Num(); ++Index)
+	{
+		DeliverReadback(MoveTemp(TimedOutCallbacks[Index]), MoveTemp(TimedOutResults[Index]));
+	}
+
+	return true;
+}
+} // namespace
+
+void StartCaptureReadbackService()
+{
+	FScopeLock Lock(&NovaBridgeReadbackMutex);
+	if (NovaBridgeReadbackTickHandle.IsValid())
+	{
+		return;
+	}
+
+	NovaBridgeReadbackSlots.Reset();
+	for (int32 SlotIndex = 0; SlotIndex < NovaBridgeReadbackSlotCount; ++SlotIndex)
+	{
+		TUniquePtr<FNovaBridgeReadbackSlot> Slot = MakeUnique<FNovaBridgeReadbackSlot>();
+		Slot->Readback = MakeUnique<FRHIGPUTextureReadback>(*FString::Printf(TEXT("NovaBridgeReadback%d"), SlotIndex));
+		NovaBridgeReadbackSlots.Add(MoveTemp(Slot));
+	}
+	NovaBridgeReadbackCounters = FNovaBridgeReadbackStats();
+	NovaBridgeReadbackTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickCaptureReadbacks), 0.0f);
+}
+
+void StopCaptureReadbackService()
+{
+	{
+		FScopeLock Lock(&NovaBridgeReadbackMutex);
+		if (!NovaBridgeReadbackTickHandle.IsValid())
+		{
+			return;
+		}
+		FTSTicker::GetCoreTicker().RemoveTicker(NovaBridgeReadbackTickHandle);
+		NovaBridgeReadbackTickHandle.Reset();
+	}
+
+	// Render commands hold raw slot pointers; drain them before the slots go away.
+	FlushRenderingCommands();
+
+	FScopeLock Lock(&NovaBridgeReadbackMutex);
+	NovaBridgeReadbackSlots.Reset();
+	NovaBridgeSoftwareReadbacks.Reset();
+}
+
+void RequestRenderTargetReadback(UTextureRenderTarget2D* RenderTarget, FNovaBridgeReadbackCallback&& OnReady, bool bAllowPlaceholder)
+{
+	check(IsInGameThread());
+
+	if (!RenderTarget)
+	{
+		FNovaBridgeReadbackResult Result;
+		Result.Error = TEXT("No render target");
+		DeliverReadback(MoveTemp(OnReady), MoveTemp(Result));
+		return;
+	}
+
+	if (ShouldUseSoftwareReadback() && !bAllowPlaceholder)
+	{
+		{
+			FScopeLock Lock(&NovaBridgeReadbackMutex);
+			NovaBridgeReadbackCounters.Requested++;
+			NovaBridgeReadbackCounters.Failed++;
+		}
+		FNovaBridgeReadbackResult Result;
+		Result.Source = TEXT("software");
+		Result.Error = TEXT("No RHI readback available");
+		Result.bNoRhi = true;
+		DeliverReadback(MoveTemp(OnReady), MoveTemp(Result));
+		return;
+	}
+
+	const int32 Width = RenderTarget->SizeX;
+	const int32 Height = RenderTarget->SizeY;
+
+	FScopeLock Lock(&NovaBridgeReadbackMutex);
+	NovaBridgeReadbackCounters.Requested++;
+
+	if (ShouldUseSoftwareReadback())
+	{
+		FNovaBridgeSoftwareReadback& Pending = NovaBridgeSoftwareReadbacks.AddDefaulted_GetRef();
+		Pending.OnReady = MoveTemp(OnReady);
+		Pending.Width = Width;
+		Pending.Height = Height;
+		NovaBridgeReadbackCounters.SoftwareFallbacks++;
+		return;
+	}
+
+	FNovaBridgeReadbackSlot* FreeSlot = nullptr;
+	if (NovaBridgeReadbackTickHandle.IsValid() && RenderTarget->GetFormat() == PF_B8G8R8A8)
+	{
+		for (const TUniquePtr<FNovaBridgeReadbackSlot>& Slot : NovaBridgeReadbackSlots)
+		{
+			if (Slot->State == ENovaBridgeReadbackSlotState::Free)
+			{
+				FreeSlot = Slot.Get();
+				break;
+			}
+		}
+	}
+
+	FTextureRenderTargetResource* RTResource = RenderTarget->GameThread_GetRenderTargetResource();
+	if (!FreeSlot || !RTResource)
+	{
+		// Ring exhausted or unsupported format: keep the old blocking behaviour rather than dropping the request.
+		NovaBridgeReadbackCounters.SyncFallbacks++;
+		Lock.Unlock();
+
+		FNovaBridgeReadbackResult Result;
+		Result.bSuccess = ReadRenderTargetSynchronously(RenderTarget, Result);
+		{
+			FScopeLock CounterLock(&NovaBridgeReadbackMutex);
+			if (Result.bSuccess)
+			{
+				NovaBridgeReadbackCounters.Completed++;
+			}
+			else
+			{
+				NovaBridgeReadbackCounters.Failed++;
+			}
+		}
+		DeliverReadback(MoveTemp(OnReady), MoveTemp(Result));
+		return;
+	}
+
+	FreeSlot->OnReady = MoveTemp(OnReady);
+	FreeSlot->Width = Width;
+	FreeSlot->Height = Height;
+	FreeSlot->SubmitTimeSec = FPlatformTime::Seconds();
+	FreeSlot->State = ENovaBridgeReadbackSlotState::Submitted;
+	NovaBridgeReadbackCounters.GpuSubmitted++;
+
+	FRHIGPUTextureReadback* Readback = FreeSlot->Readback.Get();
+	ENQUEUE_RENDER_COMMAND(NovaBridgeEnqueueReadback)([RTResource, Readback](FRHICommandListImmediate& RHICmdList)
+	{
+		Readback->EnqueueCopy(RHICmdList, RTResource->GetRenderTargetTexture());
+	});
+}
+
+FNovaBridgeReadbackStats GetCaptureReadbackStats()
+{
+	FScopeLock Lock(&NovaBridgeReadbackMutex);
+	FNovaBridgeReadbackStats Stats = NovaBridgeReadbackCounters;
+	Stats.InFlight = 0;
+	for (const TUniquePtr<FNovaBridgeReadbackSlot>& Slot : NovaBridgeReadbackSlots)
+	{
+		if (Slot->State != ENovaBridgeReadbackSlotState::Free)
+		{
+			Stats.InFlight++;
+		}
+	}
+	Stats.InFlight += NovaBridgeSoftwareReadbacks.Num();
+	return Stats;
+}
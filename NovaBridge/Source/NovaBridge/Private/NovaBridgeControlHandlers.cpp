@@ -1,11 +1,16 @@
 #include "NovaBridgeModule.h"
 #include "NovaBridgeEditorInternals.h"
 
+#include "NovaBridgeAdmission.h"
 #include "NovaBridgeCapabilityRegistry.h"
 #include "NovaBridgeCoreTypes.h"
+#include "NovaBridgeEventRing.h"
 #include "NovaBridgeHttpUtils.h"
+#include "NovaBridgeMetrics.h"
 #include "NovaBridgePolicy.h"
 #include "NovaBridgePlanSchema.h"
+#include "NovaBridgeRoutePolicy.h"
+#include "NovaBridgeTaskLanes.h"
 #include "Async/Async.h"
 #include "Dom/JsonValue.h"
 #include "Misc/App.h"
@@ -29,6 +34,37 @@ bool FNovaBridgeModule::HandleHealth(const FHttpServerRequest& Request, const FH
 	JsonObj->SetNumberField(TEXT("routes"), ApiRouteCount);
 	JsonObj->SetBoolField(TEXT("api_key_required"), !RequiredApiKey.IsEmpty());
 	JsonObj->SetStringField(TEXT("default_role"), GetNovaBridgeDefaultRole());
+
+	// Health answers inline, so orchestrators can read queue depth while the game thread is backed up.
+	TSharedPtr<FJsonObject> Admission = MakeShared<FJsonObject>();
+	for (int32 ClassIndex = 0; ClassIndex < NovaBridgeCore::RouteClassCount; ++ClassIndex)
+	{
+		const NovaBridgeCore::ERouteClass RouteClass = static_cast<NovaBridgeCore::ERouteClass>(ClassIndex);
+		const NovaBridgeCore::FAdmissionStats Stats = GetAdmissionController().GetStats(RouteClass);
+		TSharedPtr<FJsonObject> ClassObj = MakeShared<FJsonObject>();
+		ClassObj->SetNumberField(TEXT("in_flight"), Stats.InFlight);
+		ClassObj->SetNumberField(TEXT("max_in_flight"), Stats.Limits.MaxInFlight);
+		ClassObj->SetNumberField(TEXT("estimated_wait_ms"), Stats.EstimatedWaitMs);
+		ClassObj->SetNumberField(TEXT("max_wait_ms"), Stats.Limits.MaxEstimatedWaitMs);
+		ClassObj->SetNumberField(TEXT("rejected"), static_cast<double>(Stats.Rejected));
+		Admission->SetObjectField(NovaBridgeCore::RouteClassToString(RouteClass), ClassObj);
+	}
+	JsonObj->SetObjectField(TEXT("admission"), Admission);
+
+	TSharedPtr<FJsonObject> Lanes = MakeShared<FJsonObject>();
+	for (int32 LaneIndex = 0; LaneIndex < NovaBridgeCore::TaskLaneCount; ++LaneIndex)
+	{
+		const NovaBridgeCore::ETaskLane Lane = static_cast<NovaBridgeCore::ETaskLane>(LaneIndex);
+		const NovaBridgeCore::FTaskLaneStats Stats = GetGameThreadLaneStats(Lane);
+		TSharedPtr<FJsonObject> LaneObj = MakeShared<FJsonObject>();
+		LaneObj->SetNumberField(TEXT("depth"), Stats.Depth);
+		LaneObj->SetNumberField(TEXT("peak_depth"), Stats.PeakDepth);
+		LaneObj->SetNumberField(TEXT("budget_ms"), Stats.BudgetMs);
+		LaneObj->SetNumberField(TEXT("ran"), static_cast<double>(Stats.Ran));
+		LaneObj->SetNumberField(TEXT("deferred"), static_cast<double>(Stats.Deferred));
+		Lanes->SetObjectField(NovaBridgeCore::TaskLaneToString(Lane), LaneObj);
+	}
+	JsonObj->SetObjectField(TEXT("lanes"), Lanes);
 	SendJsonResponse(OnComplete, JsonObj);
 	return true;
 }
@@ -88,11 +124,24 @@ static TSharedPtr<FJsonObject> BuildEditorPermissionsSnapshot(const FString& Rol
 	Permissions->SetStringField(TEXT("mode"), TEXT("editor"));
 	Permissions->SetStringField(TEXT("role"), Role);
 
-	const bool bSpawnRouteAllowed = IsRouteAllowedForRole(Role, TEXT("/nova/scene/spawn"), EHttpServerRequestVerbs::VERB_POST);
-	const bool bExecutePlanRouteAllowed = IsRouteAllowedForRole(Role, TEXT("/nova/executePlan"), EHttpServerRequestVerbs::VERB_POST);
-	const bool bUndoRouteAllowed = IsRouteAllowedForRole(Role, TEXT("/nova/undo"), EHttpServerRequestVerbs::VERB_POST);
-	const bool bEventsRouteAllowed = IsRouteAllowedForRole(Role, TEXT("/nova/events"), EHttpServerRequestVerbs::VERB_GET);
-	const bool bSceneDeleteRouteAllowed = IsRouteAllowedForRole(Role, TEXT("/nova/scene/delete"), EHttpServerRequestVerbs::VERB_POST);
+	// Answers come from the same compiled table the bind wrapper enforces.
+	const int32 RoleSlot = NovaBridgeCore::FTokenBucketRateLimiter::RoleSlotForName(Role);
+	auto IsAllowed = [RoleSlot](const TCHAR* RoutePath, EHttpServerRequestVerbs Verb)
+	{
+		const NovaBridgeCore::FRoutePolicy* Policy = FindRoutePolicy(RoutePath);
+		return Policy && Policy->Allows(RoleSlot, Verb);
+	};
+	auto RateLimitFor = [RoleSlot](const TCHAR* RoutePath)
+	{
+		const NovaBridgeCore::FRoutePolicy* Policy = FindRoutePolicy(RoutePath);
+		return Policy ? Policy->RateLimitFor(RoleSlot) : 0;
+	};
+
+	const bool bSpawnRouteAllowed = IsAllowed(TEXT("/nova/scene/spawn"), EHttpServerRequestVerbs::VERB_POST);
+	const bool bExecutePlanRouteAllowed = IsAllowed(TEXT("/nova/executePlan"), EHttpServerRequestVerbs::VERB_POST);
+	const bool bUndoRouteAllowed = IsAllowed(TEXT("/nova/undo"), EHttpServerRequestVerbs::VERB_POST);
+	const bool bEventsRouteAllowed = IsAllowed(TEXT("/nova/events"), EHttpServerRequestVerbs::VERB_GET);
+	const bool bSceneDeleteRouteAllowed = IsAllowed(TEXT("/nova/scene/delete"), EHttpServerRequestVerbs::VERB_POST);
 
 	TArray<TSharedPtr<FJsonValue>> AllowedClassValues;
 	for (const FString& AllowedClass : NovaBridgeCore::EditorAllowedSpawnClasses())
@@ -106,7 +155,7 @@ static TSharedPtr<FJsonObject> BuildEditorPermissionsSnapshot(const FString& Rol
 	SpawnPolicy->SetArrayField(TEXT("allowedClasses"), AllowedClassValues);
 	SpawnPolicy->SetObjectField(TEXT("bounds"), BuildSpawnBoundsJson());
 	SpawnPolicy->SetNumberField(TEXT("max_spawn_per_plan"), GetPlanSpawnLimit(Role));
-	SpawnPolicy->SetNumberField(TEXT("max_requests_per_minute"), bSpawnRouteAllowed ? GetRouteRateLimitPerMinute(Role, TEXT("/nova/scene/spawn")) : 0);
+	SpawnPolicy->SetNumberField(TEXT("max_requests_per_minute"), bSpawnRouteAllowed ? RateLimitFor(TEXT("/nova/scene/spawn")) : 0);
 	Permissions->SetObjectField(TEXT("spawn"), SpawnPolicy);
 
 	TArray<FString> AllowedPlanActions;
@@ -122,7 +171,7 @@ static TSharedPtr<FJsonObject> BuildEditorPermissionsSnapshot(const FString& Rol
 	ExecutePlanPolicy->SetBoolField(TEXT("allowed"), bExecutePlanRouteAllowed);
 	ExecutePlanPolicy->SetArrayField(TEXT("allowed_actions"), MakeJsonStringArray(AllowedPlanActions));
 	ExecutePlanPolicy->SetNumberField(TEXT("max_steps"), GetNovaBridgeEditorMaxPlanSteps());
-	ExecutePlanPolicy->SetNumberField(TEXT("max_requests_per_minute"), bExecutePlanRouteAllowed ? GetRouteRateLimitPerMinute(Role, TEXT("/nova/executePlan")) : 0);
+	ExecutePlanPolicy->SetNumberField(TEXT("max_requests_per_minute"), bExecutePlanRouteAllowed ? RateLimitFor(TEXT("/nova/executePlan")) : 0);
 	Permissions->SetObjectField(TEXT("executePlan"), ExecutePlanPolicy);
 
 	TSharedPtr<FJsonObject> UndoPolicy = MakeShared<FJsonObject>();
@@ -136,10 +185,11 @@ static TSharedPtr<FJsonObject> BuildEditorPermissionsSnapshot(const FString& Rol
 	Permissions->SetObjectField(TEXT("events"), EventsPolicy);
 
 	TSharedPtr<FJsonObject> RateLimits = MakeShared<FJsonObject>();
-	RateLimits->SetNumberField(TEXT("executePlan"), bExecutePlanRouteAllowed ? GetRouteRateLimitPerMinute(Role, TEXT("/nova/executePlan")) : 0);
-	RateLimits->SetNumberField(TEXT("scene_spawn"), bSpawnRouteAllowed ? GetRouteRateLimitPerMinute(Role, TEXT("/nova/scene/spawn")) : 0);
-	RateLimits->SetNumberField(TEXT("scene_delete"), bSceneDeleteRouteAllowed ? GetRouteRateLimitPerMinute(Role, TEXT("/nova/scene/delete")) : 0);
+	RateLimits->SetNumberField(TEXT("executePlan"), bExecutePlanRouteAllowed ? RateLimitFor(TEXT("/nova/executePlan")) : 0);
+	RateLimits->SetNumberField(TEXT("scene_spawn"), bSpawnRouteAllowed ? RateLimitFor(TEXT("/nova/scene/spawn")) : 0);
+	RateLimits->SetNumberField(TEXT("scene_delete"), bSceneDeleteRouteAllowed ? RateLimitFor(TEXT("/nova/scene/delete")) : 0);
 	Permissions->SetObjectField(TEXT("route_rate_limits_per_minute"), RateLimits);
+	Permissions->SetArrayField(TEXT("routes"), NovaBridgeCore::MakeRoutePolicyJson(GetRoutePolicies(), RoleSlot));
 
 	return Permissions;
 }
@@ -187,6 +237,8 @@ void RegisterEditorCapabilities(uint32 InEventWsPort)
 
 	TSharedPtr<FJsonObject> ExecutePlanData = MakeShared<FJsonObject>();
 	ExecutePlanData->SetNumberField(TEXT("max_steps"), GetNovaBridgeEditorMaxPlanSteps());
+	ExecutePlanData->SetNumberField(TEXT("frame_budget_ms"), GetNovaBridgeEditorPlanFrameBudgetMs());
+	ExecutePlanData->SetNumberField(TEXT("max_frame_budget_ms"), GetNovaBridgeEditorPlanMaxFrameBudgetMs());
 	ExecutePlanData->SetArrayField(
 		TEXT("actions"),
 		MakeJsonStringArray(NovaBridgeCore::GetSupportedPlanActionsRef(NovaBridgeCore::ENovaBridgePlanMode::Editor)));
@@ -288,6 +340,20 @@ bool FNovaBridgeModule::HandleEvents(const FHttpServerRequest& Request, const FH
 	Result->SetNumberField(TEXT("clients_pending_subscription"), PendingSubscriptionClients);
 	Result->SetNumberField(TEXT("pending_events"), PendingEvents);
 	Result->SetNumberField(TEXT("filtered_pending_events"), FilteredPendingEvents);
+	const NovaBridgeCore::FEventRingStats EventStats = GetEventQueueStats();
+	Result->SetNumberField(TEXT("head_seq"), static_cast<double>(EventStats.HeadSeq));
+	Result->SetNumberField(TEXT("tail_seq"), static_cast<double>(EventStats.TailSeq));
+	Result->SetNumberField(TEXT("retained_events"), EventStats.Count);
+	Result->SetNumberField(TEXT("queue_capacity"), EventStats.Capacity);
+	Result->SetNumberField(TEXT("dropped_events"), static_cast<double>(EventStats.Dropped));
+
+	const double EncodedEvents = static_cast<double>(EventStats.EncodedEvents);
+	TSharedPtr<FJsonObject> EncodingObj = MakeShared<FJsonObject>();
+	EncodingObj->SetNumberField(TEXT("events_encoded"), EncodedEvents);
+	EncodingObj->SetNumberField(TEXT("payload_bytes"), static_cast<double>(EventStats.PayloadBytes));
+	EncodingObj->SetNumberField(TEXT("fanout_sends"), static_cast<double>(EventStats.FanoutSends));
+	EncodingObj->SetNumberField(TEXT("sends_per_event"), EncodedEvents > 0.0 ? static_cast<double>(EventStats.FanoutSends) / EncodedEvents : 0.0);
+	Result->SetObjectField(TEXT("encoding"), EncodingObj);
 	Result->SetArrayField(TEXT("supported_types"), MakeJsonStringArray(SupportedEventTypes()));
 	Result->SetStringField(TEXT("subscription_action"), TEXT("{\"action\":\"subscribe\",\"types\":[\"spawn\",\"error\"]}"));
 	if (FilterTypes.Num() > 0)
@@ -345,6 +411,65 @@ bool FNovaBridgeModule::HandleAuditTrail(const FHttpServerRequest& Request, cons
 	return true;
 }
 
+bool FNovaBridgeModule::HandleMetrics(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	(void)Request;
+	FString Body = NovaBridgeCore::FRouteMetricsRegistry::Get().BuildPrometheusText(TEXT("novabridge"));
+
+	const FNovaBridgeEncodeStats EncodeStats = GetImageEncodeStats();
+	Body += TEXT("# HELP novabridge_encode_queue_depth Image encode jobs waiting for a worker.\n# TYPE novabridge_encode_queue_depth gauge\n");
+	Body += FString::Printf(TEXT("novabridge_encode_queue_depth %d\n"), EncodeStats.QueueDepth);
+	Body += TEXT("# HELP novabridge_encode_active Image encode jobs currently running.\n# TYPE novabridge_encode_active gauge\n");
+	Body += FString::Printf(TEXT("novabridge_encode_active{format=\"png\"} %d\n"), EncodeStats.ActivePng);
+	Body += FString::Printf(TEXT("novabridge_encode_active{format=\"jpeg\"} %d\n"), EncodeStats.ActiveJpeg);
+	Body += TEXT("# HELP novabridge_encode_rejected_total Image encode jobs rejected by a full queue.\n# TYPE novabridge_encode_rejected_total counter\n");
+	Body += FString::Printf(TEXT("novabridge_encode_rejected_total %lld\n"), EncodeStats.Rejected);
+
+	const FNovaBridgeReadbackStats ReadbackStats = GetCaptureReadbackStats();
+	Body += TEXT("# HELP novabridge_readback_in_flight Capture readbacks waiting on the GPU.\n# TYPE novabridge_readback_in_flight gauge\n");
+	Body += FString::Printf(TEXT("novabridge_readback_in_flight %d\n"), ReadbackStats.InFlight);
+	Body += TEXT("# HELP novabridge_readback_total Capture readbacks by path.\n# TYPE novabridge_readback_total counter\n");
+	Body += FString::Printf(TEXT("novabridge_readback_total{path=\"gpu_async\"} %lld\n"), ReadbackStats.GpuSubmitted);
+	Body += FString::Printf(TEXT("novabridge_readback_total{path=\"sync\"} %lld\n"), ReadbackStats.SyncFallbacks);
+	Body += FString::Printf(TEXT("novabridge_readback_total{path=\"software\"} %lld\n"), ReadbackStats.SoftwareFallbacks);
+
+	Body += TEXT("# HELP novabridge_admission_in_flight Admitted requests per route class that have not answered yet.\n# TYPE novabridge_admission_in_flight gauge\n");
+	FString EstimatedWait = TEXT("# HELP novabridge_admission_estimated_wait_seconds Estimated wait for a new request per route class.\n# TYPE novabridge_admission_estimated_wait_seconds gauge\n");
+	FString Rejected = TEXT("# HELP novabridge_admission_rejected_total Requests answered 503 by admission control.\n# TYPE novabridge_admission_rejected_total counter\n");
+	for (int32 ClassIndex = 0; ClassIndex < NovaBridgeCore::RouteClassCount; ++ClassIndex)
+	{
+		const NovaBridgeCore::ERouteClass RouteClass = static_cast<NovaBridgeCore::ERouteClass>(ClassIndex);
+		const NovaBridgeCore::FAdmissionStats Stats = GetAdmissionController().GetStats(RouteClass);
+		const TCHAR* ClassName = NovaBridgeCore::RouteClassToString(RouteClass);
+		Body += FString::Printf(TEXT("novabridge_admission_in_flight{class=\"%s\"} %d\n"), ClassName, Stats.InFlight);
+		EstimatedWait += FString::Printf(TEXT("novabridge_admission_estimated_wait_seconds{class=\"%s\"} %.3f\n"), ClassName, Stats.EstimatedWaitMs / 1000.0);
+		Rejected += FString::Printf(TEXT("novabridge_admission_rejected_total{class=\"%s\"} %lld\n"), ClassName, Stats.Rejected);
+	}
+	Body += EstimatedWait;
+	Body += Rejected;
+
+	Body += TEXT("# HELP novabridge_lane_depth Game-thread tasks waiting per priority lane.\n# TYPE novabridge_lane_depth gauge\n");
+	FString LaneRan = TEXT("# HELP novabridge_lane_tasks_total Game-thread tasks run per priority lane.\n# TYPE novabridge_lane_tasks_total counter\n");
+	FString LaneDeferred = TEXT("# HELP novabridge_lane_deferred_total Frames in which a lane used its budget with tasks still waiting.\n# TYPE novabridge_lane_deferred_total counter\n");
+	for (int32 LaneIndex = 0; LaneIndex < NovaBridgeCore::TaskLaneCount; ++LaneIndex)
+	{
+		const NovaBridgeCore::ETaskLane Lane = static_cast<NovaBridgeCore::ETaskLane>(LaneIndex);
+		const NovaBridgeCore::FTaskLaneStats Stats = GetGameThreadLaneStats(Lane);
+		const TCHAR* LaneName = NovaBridgeCore::TaskLaneToString(Lane);
+		Body += FString::Printf(TEXT("novabridge_lane_depth{lane=\"%s\"} %d\n"), LaneName, Stats.Depth);
+		LaneRan += FString::Printf(TEXT("novabridge_lane_tasks_total{lane=\"%s\"} %llu\n"), LaneName, Stats.Ran);
+		LaneDeferred += FString::Printf(TEXT("novabridge_lane_deferred_total{lane=\"%s\"} %llu\n"), LaneName, Stats.Deferred);
+	}
+	Body += LaneRan;
+	Body += LaneDeferred;
+
+	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(Body, TEXT("text/plain; version=0.0.4"));
+	Response->Code = EHttpServerResponseCodes::Ok;
+	AddCorsHeaders(Response);
+	OnComplete(MoveTemp(Response));
+	return true;
+}
+
 bool FNovaBridgeModule::HandleUndo(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
 	const FString Role = ResolveRoleFromRequest(Request);
@@ -354,7 +479,7 @@ bool FNovaBridgeModule::HandleUndo(const FHttpServerRequest& Request, const FHtt
 		return true;
 	}
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Role]()
+	DispatchGameThreadTask([this, OnComplete, Role]()
 	{
 		FNovaBridgeUndoEntry Entry;
 		if (!PopUndoEntry(Entry))
@@ -1,13 +1,40 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "NovaBridgeDeadline.h"
+#include "NovaBridgeResponseProfile.h"
+#include "NovaBridgeTaskLanes.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
+#include "HttpResultCallback.h"
 #include "HttpServerRequest.h"
 
+#include <atomic>
+
 class AActor;
+class FProperty;
 class UClass;
+class UEnum;
 class ULevelSequencePlayer;
+class UTextureRenderTarget2D;
+class UWorld;
+struct FMeshDescription;
+
+namespace NovaBridgeCore
+{
+class FAdmissionController;
+struct FEventRecord;
+struct FEventRingStats;
+struct FMeshBuffers;
+struct FRateLimitDecision;
+struct FRoutePolicy;
+struct FRouteMetrics;
+enum class ESceneField : uint32;
+template <typename HandleType>
+struct TSceneChange;
+struct FSceneQueryShape;
+struct FActorSnapshot;
+}
 
 struct FNovaBridgeUndoEntry
 {
@@ -26,21 +53,170 @@ struct FNovaBridgeAuditEntry
 	FString Message;
 };
 
+struct FNovaBridgeReadbackResult
+{
+	bool bSuccess = false;
+	TArray<FColor> Pixels;
+	int32 Width = 0;
+	int32 Height = 0;
+	FString Source;
+	FString Error;
+	// The session has no RHI to read back from (-nullrhi); retrying will not help.
+	bool bNoRhi = false;
+};
+
+struct FNovaBridgeReadbackStats
+{
+	int64 Requested = 0;
+	int64 GpuSubmitted = 0;
+	int64 SyncFallbacks = 0;
+	int64 SoftwareFallbacks = 0;
+	int64 Completed = 0;
+	int64 Failed = 0;
+	int64 TimedOut = 0;
+	int32 InFlight = 0;
+};
+
+using FNovaBridgeReadbackCallback = TFunction<void(FNovaBridgeReadbackResult&&)>;
+
+enum class ENovaBridgeEncodeFormat : uint8
+{
+	Png,
+	Jpeg,
+};
+
+enum class ENovaBridgeEncodeCallbackThread : uint8
+{
+	GameThread,
+	Worker,
+};
+
+struct FNovaBridgeEncodeResult
+{
+	bool bSuccess = false;
+	TArray64<uint8> Bytes;
+	FString Error;
+	double QueueWaitMs = 0.0;
+	double EncodeMs = 0.0;
+};
+
+struct FNovaBridgeEncodeStats
+{
+	int64 Queued = 0;
+	int64 Completed = 0;
+	int64 Failed = 0;
+	int64 Rejected = 0;
+	double TotalEncodeMs = 0.0;
+	int32 QueueDepth = 0;
+	int32 PeakQueueDepth = 0;
+	int32 ActivePng = 0;
+	int32 ActiveJpeg = 0;
+	int32 MaxWorkers = 0;
+	int32 MaxPng = 0;
+	int32 MaxJpeg = 0;
+	int32 QueueLimit = 0;
+};
+
+using FNovaBridgeEncodeCallback = TFunction<void(FNovaBridgeEncodeResult&&)>;
+
+enum class ENovaBridgePropertyExport : uint8
+{
+	Bool,
+	Integer,
+	Float,
+	Enum,
+	Name,
+	String,
+	Text,
+};
+
+// One editable or blueprint-visible property of a class and how its value is written to JSON.
+struct FNovaBridgePropertyDescriptor
+{
+	FName Name;
+	const FProperty* Property = nullptr;
+	int32 Offset = 0;
+	const UEnum* Enum = nullptr;
+	ENovaBridgePropertyExport Export = ENovaBridgePropertyExport::Text;
+};
+
+struct FNovaBridgeClassDescriptor
+{
+	TWeakObjectPtr<const UClass> Class;
+	TArray<FNovaBridgePropertyDescriptor> Properties;
+	// FName keys compare case-insensitively, matching SetActorPropertyValue's lookup.
+	TMap<FName, int32> ByName;
+
+	const FNovaBridgePropertyDescriptor* Find(FName Name) const
+	{
+		const int32* Index = ByName.Find(Name);
+		return Index ? &Properties[*Index] : nullptr;
+	}
+};
+
+// Per-request timing shared by the HTTP-thread handler, any game-thread tasks it dispatches and the response callback.
+// It also carries the response profile the request asked for, since it already follows the request across threads.
+struct FNovaBridgeRequestTiming
+{
+	NovaBridgeCore::FRouteMetrics* Route = nullptr;
+	NovaBridgeCore::FResponseProfile Profile;
+	std::atomic<uint64> HandlerUs { 0 };
+	std::atomic<uint64> SerializeUs { 0 };
+	std::atomic<bool> bResponded { false };
+	// Batch sub-requests already run inside a game-thread task, so their own game-thread dispatches run inline.
+	bool bInlineGameThreadDispatch = false;
+	// Set when the request carries a deadline; queued game-thread work past it is answered by ExpiredResponder
+	// (a 504) instead of running.
+	NovaBridgeCore::FCancellationTokenPtr Cancellation;
+	TFunction<void()> ExpiredResponder;
+	// Game-thread lane the request's tasks queue in, from its route class.
+	NovaBridgeCore::ETaskLane Lane = NovaBridgeCore::ETaskLane::Mutating;
+};
+
+// Attributes handler time on the current thread to a request until destroyed.
+class FNovaBridgeRequestScope
+{
+public:
+	explicit FNovaBridgeRequestScope(const TSharedPtr<FNovaBridgeRequestTiming>& InTiming);
+	~FNovaBridgeRequestScope();
+
+private:
+	TSharedPtr<FNovaBridgeRequestTiming> Timing;
+	TSharedPtr<FNovaBridgeRequestTiming> PreviousTiming;
+	double PreviousStartSec = 0.0;
+	double StartSec = 0.0;
+};
+
 FString ResolveRoleFromRequest(const FHttpServerRequest& Request);
 void SetNovaBridgeDefaultRole(const FString& InRole);
 const TArray<FString>& SupportedEventTypes();
 const FString& GetNovaBridgeDefaultRole();
 int32 GetNovaBridgeEditorMaxPlanSteps();
+double GetNovaBridgeEditorPlanFrameBudgetMs();
+void SetNovaBridgeEditorPlanFrameBudgetMs(double BudgetMs);
+// Upper bound for a per-plan "frame_budget_ms"; plans can never ask for an unbounded slice.
+double GetNovaBridgeEditorPlanMaxFrameBudgetMs();
+void SetNovaBridgeEditorPlanMaxFrameBudgetMs(double BudgetMs);
 void ResetNovaBridgeEditorControlState();
 TArray<FNovaBridgeAuditEntry> GetAuditTrailSnapshot();
 void GetPendingEventSnapshot(int32& OutPendingEvents, TArray<FString>& OutPendingTypes);
-void DrainPendingEventQueue(TArray<FString>& OutPendingPayloads, TArray<FString>& OutPendingTypes);
+bool ReadEventsSince(uint64 AfterSeq, TArray<NovaBridgeCore::FEventRecord>& OutEvents);
+bool CanReplayEventsFrom(uint64 AfterSeq);
+void MarkEventsPumped(uint64 Seq);
+void RecordEventFanoutSends(uint64 Sends);
+NovaBridgeCore::FEventRingStats GetEventQueueStats();
 
 bool IsRouteAllowedForRole(const FString& Role, const FString& RoutePath, EHttpServerRequestVerbs Verb);
 int32 GetRouteRateLimitPerMinute(const FString& Role, const FString& RoutePath);
 int32 GetPlanSpawnLimit(const FString& Role);
 bool IsPlanActionAllowedForRole(const FString& Role, const FString& Action);
-bool ConsumeRateLimit(const FString& BucketKey, int32 LimitPerMinute, FString& OutError);
+const NovaBridgeCore::FRoutePolicy* CompileRoutePolicy(const FString& RoutePath);
+const NovaBridgeCore::FRoutePolicy* FindRoutePolicy(const FString& RoutePath);
+TArray<const NovaBridgeCore::FRoutePolicy*> GetRoutePolicies();
+int32 RegisterRateLimitRoute(const FString& RouteKey);
+bool ConsumeRateLimit(int32 RouteId, int32 RoleSlot, int32 LimitPerMinute, NovaBridgeCore::FRateLimitDecision& OutDecision, FString& OutError);
+// Per-class count of admitted requests that have not answered yet; the bind wrapper sheds load with it.
+NovaBridgeCore::FAdmissionController& GetAdmissionController();
 bool IsSpawnClassAllowedForRole(const FString& Role, const FString& ClassName);
 bool IsSpawnLocationInBounds(const FVector& Location);
 bool JsonValueToVector(const TSharedPtr<FJsonValue>& Value, FVector& OutVector);
@@ -56,8 +232,89 @@ void QueueEventObject(const TSharedPtr<FJsonObject>& EventObj);
 
 AActor* FindActorByName(const FString& Name);
 TSharedPtr<FJsonObject> ActorToJson(AActor* Actor);
+TSharedPtr<FJsonObject> ActorToJson(AActor* Actor, NovaBridgeCore::ESceneField Fields);
+// Game-thread half of ActorToJson: copies only the requested fields so encoding can run on a worker.
+void SnapshotActor(AActor* Actor, NovaBridgeCore::ESceneField Fields, NovaBridgeCore::FActorSnapshot& OutSnapshot);
+// True when the actor's class or any superclass has this short name; Cache memoizes per class across a scan.
+bool ActorMatchesClassName(const AActor* Actor, FName ClassName, TMap<const UClass*, bool>* Cache = nullptr);
 UClass* ResolveActorClassByName(const FString& InClassName);
 bool SetActorPropertyValue(AActor* Actor, const FString& PropertyName, const FString& Value, FString& OutError);
+// Property path cache behind SetActorPropertyValue and the per-class reflection descriptors used by
+// scene/get and scene/get-many: both are flushed on blueprint compile, reinstancing and hot reload.
+void StartPropertyPathCacheService();
+void StopPropertyPathCacheService();
+TSharedRef<const FNovaBridgeClassDescriptor> GetClassDescriptor(const UClass* Class);
+TSharedPtr<FJsonValue> ExportPropertyJson(const FNovaBridgePropertyDescriptor& Descriptor, UObject* Container);
+FString ExportPropertyText(const FNovaBridgePropertyDescriptor& Descriptor, UObject* Container);
 void NovaBridgeSetPlaybackTime(ULevelSequencePlayer* Player, float TimeSeconds, bool bScrub);
 
 void RegisterEditorCapabilities(uint32 InEventWsPort);
+
+// Actor index: name and label lookups against a per-world index kept current by actor spawn, destroy and label delegates.
+void StartActorIndexService();
+void StopActorIndexService();
+AActor* FindIndexedActor(UWorld* World, const FString& Name);
+
+// Scene change log: revision counter and dirty log for the indexed world, fed by the same delegates plus
+// actor moves and property edits. Transforms applied through SetActorLocation and friends fire no
+// delegate, so handlers report them with NoteSceneActorModified.
+uint64 GetSceneRevision(UWorld* World);
+bool CollectSceneChanges(UWorld* World, uint64 Since, TArray<NovaBridgeCore::TSceneChange<TWeakObjectPtr<AActor>>>& OutChanges);
+void NoteSceneActorModified(AActor* Actor);
+
+// Asset registry generation: bumped by every asset add, remove, rename and update so asset listings can
+// be revalidated without a registry query. Safe to read from any thread.
+void StartAssetRevisionService();
+void StopAssetRevisionService();
+uint64 GetAssetRegistryRevision();
+
+// Spatial index: loose octree over actor bounds for the indexed world, kept current by the same
+// notifications as the change log. Hits are re-checked against live bounds before they are returned.
+void QueryIndexedActors(UWorld* World, const NovaBridgeCore::FSceneQueryShape& Shape, TArray<AActor*>& OutActors);
+AActor* FindNearestIndexedActor(UWorld* World, const FVector& Point, double Radius, FName ClassName = NAME_None);
+
+// Capture readback: callbacks always run on the game thread, usually a frame or two after the request.
+void StartCaptureReadbackService();
+void StopCaptureReadbackService();
+// Without an RHI the readback fails with bNoRhi, unless bAllowPlaceholder asks for a "software" test pattern.
+void RequestRenderTargetReadback(UTextureRenderTarget2D* RenderTarget, FNovaBridgeReadbackCallback&& OnReady, bool bAllowPlaceholder = false);
+FNovaBridgeReadbackStats GetCaptureReadbackStats();
+
+// Image encoding: QueueImageEncode returns false (leaving Pixels untouched) when the bounded queue is full.
+void StartImageEncodeService();
+void StopImageEncodeService();
+bool QueueImageEncode(
+	ENovaBridgeEncodeFormat Format,
+	TArray<FColor>&& Pixels,
+	int32 Width,
+	int32 Height,
+	int32 Quality,
+	ENovaBridgeEncodeCallbackThread CallbackThread,
+	FNovaBridgeEncodeCallback&& OnEncoded);
+FNovaBridgeEncodeStats GetImageEncodeStats();
+
+// Mesh building: fills a static mesh description from validated buffers; safe to call off the game thread.
+TSharedRef<FMeshDescription> BuildMeshDescriptionFromBuffers(const NovaBridgeCore::FMeshBuffers& Mesh);
+
+// Request metrics: handlers hop to the game thread through DispatchGameThreadTask so queue wait is measured.
+// Tasks queue in the request's lane and are drained once per frame; outside StartGameThreadLanes they go
+// straight to the game thread.
+void DispatchGameThreadTask(TUniqueFunction<void()>&& Task);
+void StartGameThreadLanes(double MutatingBudgetMs, double HeavyBudgetMs);
+void StopGameThreadLanes();
+NovaBridgeCore::FTaskLaneStats GetGameThreadLaneStats(NovaBridgeCore::ETaskLane Lane);
+void ResetGameThreadLaneStats();
+// Continuations queue in the request's lane like its first task, but never run before the next frame's drain.
+void DispatchGameThreadTaskNextTick(TUniqueFunction<void()>&& Task);
+void DispatchBackgroundTask(TUniqueFunction<void()>&& Task);
+FHttpResultCallback WrapResultCallbackWithMetrics(const TSharedRef<FNovaBridgeRequestTiming>& Timing, const FHttpResultCallback& OnComplete);
+void RecordResponseSerializeTime(double SerializeSec);
+// Profile of the request whose scope is open on this thread; the full profile outside any request.
+NovaBridgeCore::FResponseProfile GetCurrentResponseProfile();
+// Deadline token of the request whose scope is open on this thread; null when it has none.
+NovaBridgeCore::FCancellationTokenPtr GetCurrentCancellationToken();
+// Long-running work that reports its own partial result at the deadline calls this once it has started, so
+// its queued continuations still run instead of being answered with a bare 504.
+void ClaimDeadlineResponse();
+// Counts a request whose long-running work stopped early at its deadline.
+void RecordRequestCancelled();
@@ -1,8 +1,13 @@
 #include "NovaBridgeEditorInternals.h"
 
+#include "NovaBridgeAdmission.h"
 #include "NovaBridgeCoreTypes.h"
+#include "NovaBridgeEventRing.h"
 #include "NovaBridgeHttpUtils.h"
+#include "NovaBridgePlanDispatch.h"
 #include "NovaBridgePolicy.h"
+#include "NovaBridgeRateLimiter.h"
+#include "NovaBridgeRoutePolicy.h"
 #include "HAL/PlatformTime.h"
 #include "Misc/ScopeLock.h"
 #include "Serialization/JsonSerializer.h"
@@ -13,26 +18,23 @@ using NovaBridgeCore::NormalizeEventType;
 
 namespace
 {
-struct FNovaBridgeRateBucket
-{
-	double WindowStartSec = 0.0;
-	int32 Count = 0;
-};
-
-FCriticalSection NovaBridgeRateLimitMutex;
-TMap<FString, FNovaBridgeRateBucket> NovaBridgeRateBuckets;
+NovaBridgeCore::FTokenBucketRateLimiter NovaBridgeRateLimiter;
+NovaBridgeCore::FRoutePolicyTable NovaBridgeRoutePolicies;
+NovaBridgeCore::FAdmissionController NovaBridgeAdmission;
 FCriticalSection NovaBridgeUndoMutex;
 TArray<FNovaBridgeUndoEntry> NovaBridgeUndoStack;
 FCriticalSection NovaBridgeAuditMutex;
 TArray<FNovaBridgeAuditEntry> NovaBridgeAuditTrail;
-FCriticalSection NovaBridgeEventQueueMutex;
-TArray<FString> NovaBridgePendingEventPayloads;
-TArray<FString> NovaBridgePendingEventTypes;
 FString NovaBridgeDefaultRole;
 const int32 NovaBridgeUndoLimit = 128;
 const int32 NovaBridgeAuditLimit = 512;
 const int32 NovaBridgePendingEventsLimit = 2048;
+NovaBridgeCore::FEventRing NovaBridgeEventRing(NovaBridgePendingEventsLimit);
+FCriticalSection NovaBridgeEventPumpMutex;
+uint64 NovaBridgeEventPumpedSeq = 0;
 const int32 NovaBridgeEditorMaxPlanSteps = 128;
+std::atomic<double> NovaBridgeEditorPlanFrameBudgetMs { 8.0 };
+std::atomic<double> NovaBridgeEditorPlanMaxFrameBudgetMs { NovaBridgeCore::DefaultMaxRequestedPlanFrameBudgetMs };
 
 const TArray<FString>& NovaBridgeSpawnClassAllowList()
 {
@@ -46,8 +48,12 @@ bool IsReadOnlyRoute(const FString& RoutePath)
 		|| RoutePath == TEXT("/nova/caps")
 		|| RoutePath == TEXT("/nova/events")
 		|| RoutePath == TEXT("/nova/audit")
+		|| RoutePath == TEXT("/nova/metrics")
 		|| RoutePath == TEXT("/nova/scene/list")
+		|| RoutePath == TEXT("/nova/scene/changes")
+		|| RoutePath == TEXT("/nova/scene/query")
 		|| RoutePath == TEXT("/nova/scene/get")
+		|| RoutePath == TEXT("/nova/scene/get-many")
 		|| RoutePath == TEXT("/nova/asset/list")
 		|| RoutePath == TEXT("/nova/asset/info")
 		|| RoutePath == TEXT("/nova/mesh/get")
@@ -59,6 +65,39 @@ bool IsReadOnlyRoute(const FString& RoutePath)
 		|| RoutePath == TEXT("/nova/sequencer/info")
 		|| RoutePath == TEXT("/nova/optimize/stats");
 }
+
+// Read-only routes that take their parameters as a POST body.
+bool IsPostReadRoute(const FString& RoutePath)
+{
+	return RoutePath == TEXT("/nova/scene/query")
+		|| RoutePath == TEXT("/nova/scene/get-many");
+}
+
+NovaBridgeCore::ERouteClass ClassifyRoute(const FString& RoutePath)
+{
+	if (RoutePath == TEXT("/nova/health")
+		|| RoutePath == TEXT("/nova/project/info")
+		|| RoutePath == TEXT("/nova/caps")
+		|| RoutePath == TEXT("/nova/events")
+		|| RoutePath == TEXT("/nova/audit")
+		|| RoutePath == TEXT("/nova/metrics"))
+	{
+		return NovaBridgeCore::ERouteClass::Control;
+	}
+	if (RoutePath == TEXT("/nova/viewport/screenshot")
+		|| RoutePath == TEXT("/nova/executePlan")
+		|| RoutePath == TEXT("/nova/asset/import")
+		|| RoutePath == TEXT("/nova/mesh/create")
+		|| RoutePath == TEXT("/nova/blueprint/compile")
+		|| RoutePath == TEXT("/nova/build/lighting")
+		|| RoutePath == TEXT("/nova/pcg/generate")
+		|| RoutePath == TEXT("/nova/sequencer/render")
+		|| (RoutePath.StartsWith(TEXT("/nova/optimize/")) && RoutePath != TEXT("/nova/optimize/stats")))
+	{
+		return NovaBridgeCore::ERouteClass::Heavy;
+	}
+	return IsReadOnlyRoute(RoutePath) ? NovaBridgeCore::ERouteClass::Read : NovaBridgeCore::ERouteClass::Write;
+}
 } // namespace
 
 FString ResolveRoleFromRequest(const FHttpServerRequest& Request)
@@ -96,12 +135,31 @@ int32 GetNovaBridgeEditorMaxPlanSteps()
 	return NovaBridgeEditorMaxPlanSteps;
 }
 
+double GetNovaBridgeEditorPlanFrameBudgetMs()
+{
+	return NovaBridgeEditorPlanFrameBudgetMs.load();
+}
+
+void SetNovaBridgeEditorPlanFrameBudgetMs(const double BudgetMs)
+{
+	NovaBridgeEditorPlanFrameBudgetMs.store(FMath::Max(0.0, BudgetMs));
+}
+
+double GetNovaBridgeEditorPlanMaxFrameBudgetMs()
+{
+	return NovaBridgeEditorPlanMaxFrameBudgetMs.load();
+}
+
+void SetNovaBridgeEditorPlanMaxFrameBudgetMs(const double BudgetMs)
+{
+	NovaBridgeEditorPlanMaxFrameBudgetMs.store(FMath::Max(NovaBridgeCore::MinRequestedPlanFrameBudgetMs, BudgetMs));
+}
+
 void ResetNovaBridgeEditorControlState()
 {
-	{
-		FScopeLock RateLock(&NovaBridgeRateLimitMutex);
-		NovaBridgeRateBuckets.Empty();
-	}
+	NovaBridgeRateLimiter.Reset();
+	NovaBridgeAdmission.ResetStats();
+	ResetGameThreadLaneStats();
 	{
 		FScopeLock UndoLock(&NovaBridgeUndoMutex);
 		NovaBridgeUndoStack.Empty();
@@ -110,15 +168,17 @@ void ResetNovaBridgeEditorControlState()
 		FScopeLock AuditLock(&NovaBridgeAuditMutex);
 		NovaBridgeAuditTrail.Empty();
 	}
-	{
-		FScopeLock EventLock(&NovaBridgeEventQueueMutex);
-		NovaBridgePendingEventPayloads.Empty();
-		NovaBridgePendingEventTypes.Empty();
-	}
+	NovaBridgeEventRing.Reset();
 }
 
 bool IsRouteAllowedForRole(const FString& Role, const FString& RoutePath, EHttpServerRequestVerbs Verb)
 {
+	// Each batch entry is checked against its own route's policy.
+	if (RoutePath == TEXT("/nova/batch"))
+	{
+		return !Role.IsEmpty();
+	}
+
 	if (Role == TEXT("admin"))
 	{
 		return true;
@@ -139,7 +199,7 @@ bool IsRouteAllowedForRole(const FString& Role, const FString& RoutePath, EHttpS
 		{
 			return IsReadOnlyRoute(RoutePath);
 		}
-		return false;
+		return IsPostReadRoute(RoutePath);
 	}
 
 	return false;
@@ -181,25 +241,66 @@ int32 GetRouteRateLimitPerMinute(const FString& Role, const FString& RoutePath)
 	return 0;
 }
 
-bool ConsumeRateLimit(const FString& BucketKey, const int32 LimitPerMinute, FString& OutError)
+const NovaBridgeCore::FRoutePolicy* CompileRoutePolicy(const FString& RoutePath)
 {
-	if (LimitPerMinute <= 0)
+	// The string-based rules above stay the source of truth; they only run here, once per bound route.
+	NovaBridgeCore::FRoutePolicy Policy;
+	Policy.Path = RoutePath;
+	Policy.RateRouteId = RegisterRateLimitRoute(RoutePath);
+	Policy.bReadOnly = IsReadOnlyRoute(RoutePath);
+	Policy.RouteClass = ClassifyRoute(RoutePath);
+	// Reads and screenshots are worthless once the caller has timed out; writes run unless the client asks otherwise.
+	Policy.DefaultDeadlineMs = Policy.RouteClass == NovaBridgeCore::ERouteClass::Read || RoutePath == TEXT("/nova/viewport/screenshot")
+		? NovaBridgeCore::DefaultReadDeadlineMs
+		: 0;
+	Policy.AuditLevel = RoutePath == TEXT("/nova/metrics") ? NovaBridgeCore::ERouteAuditLevel::Quiet : NovaBridgeCore::ERouteAuditLevel::Denials;
+	for (int32 RoleSlot = 0; RoleSlot < NovaBridgeCore::FTokenBucketRateLimiter::RoleSlotCount; ++RoleSlot)
 	{
-		OutError = TEXT("Rate limit denied for this role/action");
-		return false;
+		const FString Role = NovaBridgeCore::FRoutePolicyTable::RoleNameForSlot(RoleSlot);
+		if (IsRouteAllowedForRole(Role, RoutePath, EHttpServerRequestVerbs::VERB_GET))
+		{
+			Policy.ReadRoleMask |= static_cast<uint8>(1u << RoleSlot);
+		}
+		if (IsRouteAllowedForRole(Role, RoutePath, EHttpServerRequestVerbs::VERB_POST))
+		{
+			Policy.WriteRoleMask |= static_cast<uint8>(1u << RoleSlot);
+		}
+		Policy.RateLimitPerMinute[RoleSlot] = GetRouteRateLimitPerMinute(Role, RoutePath);
 	}
+	return NovaBridgeRoutePolicies.Add(Policy);
+}
 
-	const double NowSec = FPlatformTime::Seconds();
-	FScopeLock Lock(&NovaBridgeRateLimitMutex);
-	FNovaBridgeRateBucket& Bucket = NovaBridgeRateBuckets.FindOrAdd(BucketKey);
-	if (Bucket.WindowStartSec <= 0.0 || (NowSec - Bucket.WindowStartSec) >= 60.0)
+NovaBridgeCore::FAdmissionController& GetAdmissionController()
+{
+	return NovaBridgeAdmission;
+}
+
+const NovaBridgeCore::FRoutePolicy* FindRoutePolicy(const FString& RoutePath)
+{
+	return NovaBridgeRoutePolicies.Find(RoutePath);
+}
+
+TArray<const NovaBridgeCore::FRoutePolicy*> GetRoutePolicies()
+{
+	return NovaBridgeRoutePolicies.GetAll();
+}
+
+int32 RegisterRateLimitRoute(const FString& RouteKey)
+{
+	return NovaBridgeRateLimiter.RegisterRoute(RouteKey);
+}
+
+bool ConsumeRateLimit(const int32 RouteId, const int32 RoleSlot, const int32 LimitPerMinute, NovaBridgeCore::FRateLimitDecision& OutDecision, FString& OutError)
+{
+	if (LimitPerMinute <= 0)
 	{
-		Bucket.WindowStartSec = NowSec;
-		Bucket.Count = 0;
+		OutDecision = NovaBridgeCore::FRateLimitDecision();
+		OutError = TEXT("Rate limit denied for this role/action");
+		return false;
 	}
 
-	Bucket.Count++;
-	if (Bucket.Count > LimitPerMinute)
+	OutDecision = NovaBridgeRateLimiter.Consume(RouteId, RoleSlot, LimitPerMinute, FPlatformTime::Seconds());
+	if (!OutDecision.bAllowed)
 	{
 		OutError = FString::Printf(TEXT("Rate limit: max %d requests/minute for this role/action"), LimitPerMinute);
 		return false;
@@ -263,39 +364,57 @@ void QueueEventObject(const TSharedPtr<FJsonObject>& EventObj)
 		EventObj->SetStringField(TEXT("timestamp_utc"), FDateTime::UtcNow().ToIso8601());
 	}
 
-	const FString EventType = NormalizeEventType(EventObj->GetStringField(TEXT("type")));
-
-	FString SerializedEvent;
+	FString EventType = NormalizeEventType(EventObj->GetStringField(TEXT("type")));
+	if (EventType.IsEmpty())
+	{
+		EventType = TEXT("audit");
+	}
+	NovaBridgeEventRing.Push(EventType, [&EventObj](uint64 Seq)
 	{
+		EventObj->SetNumberField(TEXT("seq"), static_cast<double>(Seq));
+		FString SerializedEvent;
 		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&SerializedEvent);
 		FJsonSerializer::Serialize(EventObj.ToSharedRef(), Writer);
-	}
+		return SerializedEvent;
+	});
+}
 
-	FScopeLock EventLock(&NovaBridgeEventQueueMutex);
-	NovaBridgePendingEventPayloads.Add(MoveTemp(SerializedEvent));
-	NovaBridgePendingEventTypes.Add(EventType);
-	if (NovaBridgePendingEventPayloads.Num() > NovaBridgePendingEventsLimit)
+void GetPendingEventSnapshot(int32& OutPendingEvents, TArray<FString>& OutPendingTypes)
+{
+	uint64 PumpedSeq = 0;
 	{
-		const int32 RemoveCount = NovaBridgePendingEventPayloads.Num() - NovaBridgePendingEventsLimit;
-		NovaBridgePendingEventPayloads.RemoveAt(0, RemoveCount, EAllowShrinking::No);
-		NovaBridgePendingEventTypes.RemoveAt(0, RemoveCount, EAllowShrinking::No);
+		FScopeLock PumpLock(&NovaBridgeEventPumpMutex);
+		PumpedSeq = NovaBridgeEventPumpedSeq;
 	}
+	OutPendingTypes.Reset();
+	NovaBridgeEventRing.CopyTypesSince(PumpedSeq, OutPendingTypes);
+	OutPendingEvents = OutPendingTypes.Num();
 }
 
-void GetPendingEventSnapshot(int32& OutPendingEvents, TArray<FString>& OutPendingTypes)
+bool ReadEventsSince(uint64 AfterSeq, TArray<NovaBridgeCore::FEventRecord>& OutEvents)
+{
+	return NovaBridgeEventRing.CopySince(AfterSeq, OutEvents);
+}
+
+bool CanReplayEventsFrom(uint64 AfterSeq)
+{
+	return NovaBridgeEventRing.CanReplayFrom(AfterSeq);
+}
+
+void MarkEventsPumped(uint64 Seq)
+{
+	FScopeLock PumpLock(&NovaBridgeEventPumpMutex);
+	NovaBridgeEventPumpedSeq = FMath::Max(NovaBridgeEventPumpedSeq, Seq);
+}
+
+void RecordEventFanoutSends(uint64 Sends)
 {
-	FScopeLock EventLock(&NovaBridgeEventQueueMutex);
-	OutPendingEvents = NovaBridgePendingEventPayloads.Num();
-	OutPendingTypes = NovaBridgePendingEventTypes;
+	NovaBridgeEventRing.RecordFanoutSends(Sends);
 }
 
-void DrainPendingEventQueue(TArray<FString>& OutPendingPayloads, TArray<FString>& OutPendingTypes)
+NovaBridgeCore::FEventRingStats GetEventQueueStats()
 {
-	FScopeLock EventLock(&NovaBridgeEventQueueMutex);
-	OutPendingPayloads = MoveTemp(NovaBridgePendingEventPayloads);
-	OutPendingTypes = MoveTemp(NovaBridgePendingEventTypes);
-	NovaBridgePendingEventPayloads.Reset();
-	NovaBridgePendingEventTypes.Reset();
+	return NovaBridgeEventRing.GetStats();
 }
 
 void PushAuditEntry(const FString& Route, const FString& Action, const FString& Role, const FString& Status, const FString& Message)
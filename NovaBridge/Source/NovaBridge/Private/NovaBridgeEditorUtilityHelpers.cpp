@@ -1,5 +1,8 @@
 #include "NovaBridgeEditorInternals.h"
 
+#include "NovaBridgePropertyPath.h"
+#include "NovaBridgeSceneList.h"
+#include "NovaBridgeSceneSnapshot.h"
 #include "Components/ActorComponent.h"
 #include "Components/PrimitiveComponent.h"
 #include "Editor.h"
@@ -8,7 +11,6 @@
 #include "Engine/SkyLight.h"
 #include "Engine/StaticMeshActor.h"
 #include "Engine/World.h"
-#include "EngineUtils.h"
 #include "GameFramework/Actor.h"
 #include "Materials/MaterialInterface.h"
 #include "UObject/UObjectGlobals.h"
@@ -16,25 +18,185 @@
 
 namespace
 {
-FString NormalizeComponentKey(FString Value)
+// What a "Component.Property" path resolved to on one actor class. Component entries are re-found on
+// each actor by name and must still have the cached class.
+struct FResolvedPropertyPath
 {
-	FString Out;
-	Out.Reserve(Value.Len());
-	for (TCHAR Ch : Value)
+	TWeakObjectPtr<const UClass> ActorClass;
+	FName ComponentName;
+	TWeakObjectPtr<const UClass> ComponentClass;
+	FProperty* Property = nullptr;
+	int32 MaterialSlot = INDEX_NONE;
+};
+
+NovaBridgeCore::TPropertyPathCache<UClass, FResolvedPropertyPath> NovaBridgePropertyPathCache;
+TMap<const UClass*, TSharedRef<const FNovaBridgeClassDescriptor>> NovaBridgeClassDescriptors;
+FDelegateHandle NovaBridgeBlueprintCompiledHandle;
+FDelegateHandle NovaBridgeObjectsReinstancedHandle;
+FDelegateHandle NovaBridgeReloadCompleteHandle;
+
+FProperty* FindPropertyIgnoreCase(const UClass* Class, const FString& Name)
+{
+	if (FProperty* Prop = Class->FindPropertyByName(*Name))
+	{
+		return Prop;
+	}
+	for (TFieldIterator<FProperty> It(Class); It; ++It)
+	{
+		if (It->GetName().Equals(Name, ESearchCase::IgnoreCase))
+		{
+			return *It;
+		}
+	}
+	return nullptr;
+}
+
+// The uncached walk: pick the component, then find the property (or material slot) on it.
+bool ResolvePropertyPath(AActor* Actor, const FString& PropertyName, FResolvedPropertyPath& OutPath, UActorComponent*& OutComponent, FString& OutError)
+{
+	FString CompName;
+	FString PropName = PropertyName;
+	OutComponent = nullptr;
+	if (PropertyName.Split(TEXT("."), &CompName, &PropName))
+	{
+		TInlineComponentArray<UActorComponent*> Components;
+		Actor->GetComponents(Components);
+		TArray<NovaBridgeCore::FComponentIdentity, TInlineAllocator<16>> Identities;
+		Identities.Reserve(Components.Num());
+		for (UActorComponent* Comp : Components)
+		{
+			Identities.Add(NovaBridgeCore::FComponentIdentity { Comp->GetName(), Comp->GetClass()->GetName() });
+		}
+
+		const int32 Found = NovaBridgeCore::FindComponentForSelector(CompName, Identities);
+		if (Found != INDEX_NONE)
+		{
+			OutComponent = Components[Found];
+		}
+		else
+		{
+			PropName = PropertyName;
+		}
+	}
+
+	OutPath = FResolvedPropertyPath();
+	OutPath.ActorClass = Actor->GetClass();
+	if (OutComponent)
+	{
+		OutPath.ComponentName = OutComponent->GetFName();
+		OutPath.ComponentClass = OutComponent->GetClass();
+		if (PropName.StartsWith(TEXT("Material")) && Cast<UPrimitiveComponent>(OutComponent))
+		{
+			int32 SlotIndex = 0;
+			int32 BracketIdx = INDEX_NONE;
+			if (PropName.FindChar('[', BracketIdx))
+			{
+				FString IdxStr = PropName.Mid(BracketIdx + 1).LeftChop(1);
+				SlotIndex = FCString::Atoi(*IdxStr);
+			}
+			OutPath.MaterialSlot = FMath::Max(0, SlotIndex);
+			return true;
+		}
+	}
+
+	const UObject* TargetObj = OutComponent ? static_cast<const UObject*>(OutComponent) : Actor;
+	OutPath.Property = FindPropertyIgnoreCase(TargetObj->GetClass(), PropName);
+	if (!OutPath.Property)
+	{
+		OutError = FString::Printf(TEXT("Property not found: %s"), *PropertyName);
+		return false;
+	}
+	return true;
+}
+
+// A cached path only applies if the actor still has a component of that name and class.
+bool ApplyCachedPropertyPath(AActor* Actor, const FResolvedPropertyPath& Path, UActorComponent*& OutComponent)
+{
+	OutComponent = nullptr;
+	if (Path.ActorClass.Get() != Actor->GetClass())
+	{
+		return false;
+	}
+	if (Path.ComponentName.IsNone())
 	{
-		if (FChar::IsAlnum(Ch))
+		return true;
+	}
+	OutComponent = FindObjectFast<UActorComponent>(Actor, Path.ComponentName);
+	return OutComponent && OutComponent->GetClass() == Path.ComponentClass.Get();
+}
+
+void ResetPropertyPathCache()
+{
+	NovaBridgePropertyPathCache.Reset();
+	NovaBridgeClassDescriptors.Reset();
+}
+
+ENovaBridgePropertyExport ClassifyPropertyExport(const FProperty* Prop, const UEnum*& OutEnum)
+{
+	OutEnum = nullptr;
+	if (Prop->ArrayDim != 1)
+	{
+		return ENovaBridgePropertyExport::Text;
+	}
+	if (Prop->IsA<FBoolProperty>())
+	{
+		return ENovaBridgePropertyExport::Bool;
+	}
+	if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Prop))
+	{
+		OutEnum = EnumProp->GetEnum();
+		return OutEnum ? ENovaBridgePropertyExport::Enum : ENovaBridgePropertyExport::Text;
+	}
+	if (const FNumericProperty* Numeric = CastField<FNumericProperty>(Prop))
+	{
+		if (Numeric->IsEnum())
 		{
-			Out.AppendChar(FChar::ToLower(Ch));
+			OutEnum = Numeric->GetIntPropertyEnum();
+			return ENovaBridgePropertyExport::Enum;
 		}
+		return Numeric->IsFloatingPoint() ? ENovaBridgePropertyExport::Float : ENovaBridgePropertyExport::Integer;
+	}
+	if (Prop->IsA<FNameProperty>())
+	{
+		return ENovaBridgePropertyExport::Name;
+	}
+	if (Prop->IsA<FStrProperty>())
+	{
+		return ENovaBridgePropertyExport::String;
 	}
+	return ENovaBridgePropertyExport::Text;
+}
 
-	// Ignore trailing numeric suffixes often used in component names (e.g. LightComponent0).
-	while (Out.Len() > 0 && FChar::IsDigit(Out[Out.Len() - 1]))
+TSharedRef<const FNovaBridgeClassDescriptor> BuildClassDescriptor(const UClass* Class)
+{
+	TSharedRef<FNovaBridgeClassDescriptor> Descriptor = MakeShared<FNovaBridgeClassDescriptor>();
+	Descriptor->Class = Class;
+	for (TFieldIterator<FProperty> It(Class); It; ++It)
 	{
-		Out.LeftChopInline(1, EAllowShrinking::No);
+		const FProperty* Prop = *It;
+		if (!Prop->HasAnyPropertyFlags(CPF_Edit | CPF_BlueprintVisible))
+		{
+			continue;
+		}
+
+		FNovaBridgePropertyDescriptor& Entry = Descriptor->Properties.AddDefaulted_GetRef();
+		Entry.Name = Prop->GetFName();
+		Entry.Property = Prop;
+		Entry.Offset = Prop->GetOffset_ForInternal();
+		Entry.Export = ClassifyPropertyExport(Prop, Entry.Enum);
+		// Iteration runs most-derived first; a shadowing subclass property wins.
+		Descriptor->ByName.FindOrAdd(Entry.Name, Descriptor->Properties.Num() - 1);
 	}
+	return Descriptor;
+}
 
-	return Out;
+// GEditor does not exist yet when the module starts, so the compile hook is bound on first use.
+void BindBlueprintCompiledReset()
+{
+	if (!NovaBridgeBlueprintCompiledHandle.IsValid() && GEditor)
+	{
+		NovaBridgeBlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&ResetPropertyPathCache);
+	}
 }
 } // namespace
 
@@ -42,25 +204,67 @@ AActor* FindActorByName(const FString& Name)
 {
 	if (!GEditor) return nullptr;
 	UWorld* World = GEditor->GetEditorWorldContext().World();
-	if (!World) return nullptr;
+	return FindIndexedActor(World, Name);
+}
 
-	for (TActorIterator<AActor> It(World); It; ++It)
+bool ActorMatchesClassName(const AActor* Actor, FName ClassName, TMap<const UClass*, bool>* Cache)
+{
+	const UClass* ActorClass = Actor->GetClass();
+	if (const bool* Cached = Cache ? Cache->Find(ActorClass) : nullptr)
 	{
-		if (It->GetName() == Name || It->GetActorLabel() == Name)
-		{
-			return *It;
-		}
+		return *Cached;
 	}
-	return nullptr;
+
+	bool bMatches = false;
+	for (const UClass* Class = ActorClass; Class && !bMatches; Class = Class->GetSuperClass())
+	{
+		bMatches = Class->GetFName() == ClassName;
+	}
+	if (Cache)
+	{
+		Cache->Add(ActorClass, bMatches);
+	}
+	return bMatches;
 }
 
 TSharedPtr<FJsonObject> ActorToJson(AActor* Actor)
 {
+	return ActorToJson(Actor, NovaBridgeCore::ESceneField::Default);
+}
+
+TSharedPtr<FJsonObject> ActorToJson(AActor* Actor, NovaBridgeCore::ESceneField Fields)
+{
+	using NovaBridgeCore::ESceneField;
 	TSharedPtr<FJsonObject> Obj = MakeShareable(new FJsonObject);
-	Obj->SetStringField(TEXT("name"), Actor->GetName());
-	Obj->SetStringField(TEXT("label"), Actor->GetActorLabel());
-	Obj->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
-	Obj->SetStringField(TEXT("path"), Actor->GetPathName());
+	if (EnumHasAnyFlags(Fields, ESceneField::Name))
+	{
+		Obj->SetStringField(TEXT("name"), Actor->GetName());
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Label))
+	{
+		Obj->SetStringField(TEXT("label"), Actor->GetActorLabel());
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Class))
+	{
+		Obj->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Path))
+	{
+		Obj->SetStringField(TEXT("path"), Actor->GetPathName());
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Tags))
+	{
+		TArray<TSharedPtr<FJsonValue>> Tags;
+		for (const FName& Tag : Actor->Tags)
+		{
+			Tags.Add(MakeShared<FJsonValueString>(Tag.ToString()));
+		}
+		Obj->SetArrayField(TEXT("tags"), Tags);
+	}
+	if (!EnumHasAnyFlags(Fields, ESceneField::Transform))
+	{
+		return Obj;
+	}
 
 	FVector Loc = Actor->GetActorLocation();
 	FRotator Rot = Actor->GetActorRotation();
@@ -89,6 +293,32 @@ TSharedPtr<FJsonObject> ActorToJson(AActor* Actor)
 	return Obj;
 }
 
+void SnapshotActor(AActor* Actor, NovaBridgeCore::ESceneField Fields, NovaBridgeCore::FActorSnapshot& OutSnapshot)
+{
+	using NovaBridgeCore::ESceneField;
+	OutSnapshot.Name = Actor->GetFName();
+	OutSnapshot.ClassName = Actor->GetClass()->GetFName();
+	if (EnumHasAnyFlags(Fields, ESceneField::Label))
+	{
+		OutSnapshot.Label = Actor->GetActorLabel();
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Path))
+	{
+		OutSnapshot.Path = Actor->GetPathName();
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Tags))
+	{
+		OutSnapshot.Tags = Actor->Tags;
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Transform))
+	{
+		const FTransform& Transform = Actor->GetActorTransform();
+		OutSnapshot.Location = Transform.GetLocation();
+		OutSnapshot.Rotation = Transform.Rotator();
+		OutSnapshot.Scale = Transform.GetScale3D();
+	}
+}
+
 bool JsonValueToVector(const TSharedPtr<FJsonValue>& Value, FVector& OutVector)
 {
 	if (!Value.IsValid())
@@ -332,129 +562,129 @@ bool SetActorPropertyValue(AActor* Actor, const FString& PropertyName, const FSt
 		return false;
 	}
 
-	FString CompName;
-	FString PropName;
-	UObject* TargetObj = Actor;
-	UActorComponent* FoundComp = nullptr;
-	if (PropertyName.Split(TEXT("."), &CompName, &PropName))
+	// Plans set the same path on many actors of one class; only the first pays for the component and
+	// property search.
+	BindBlueprintCompiledReset();
+	FResolvedPropertyPath Path;
+	UActorComponent* Component = nullptr;
+	const FResolvedPropertyPath* Cached = NovaBridgePropertyPathCache.Find(Actor->GetClass(), PropertyName);
+	if (Cached && ApplyCachedPropertyPath(Actor, *Cached, Component))
 	{
-		TInlineComponentArray<UActorComponent*> Components;
-		Actor->GetComponents(Components);
-		for (UActorComponent* Comp : Components)
-		{
-			if (Comp->GetName() == CompName || Comp->GetClass()->GetName() == CompName
-				|| Comp->GetName().Contains(CompName))
-			{
-				FoundComp = Comp;
-				break;
-			}
-		}
-		if (!FoundComp)
-		{
-			const FString RequestedKey = NormalizeComponentKey(CompName);
-			if (!RequestedKey.IsEmpty())
-			{
-				for (UActorComponent* Comp : Components)
-				{
-					const FString CompNameKey = NormalizeComponentKey(Comp->GetName());
-					FString ClassName = Comp->GetClass()->GetName();
-					const FString ClassNameKey = NormalizeComponentKey(ClassName);
-					if (ClassName.StartsWith(TEXT("U")))
-					{
-						ClassName.RightChopInline(1, EAllowShrinking::No);
-					}
-					const FString ClassNameNoPrefixKey = NormalizeComponentKey(ClassName);
-
-					const bool bClassMatch =
-						(RequestedKey == ClassNameKey) ||
-						(RequestedKey == ClassNameNoPrefixKey) ||
-						(RequestedKey.Contains(ClassNameKey)) ||
-						(RequestedKey.Contains(ClassNameNoPrefixKey)) ||
-						(ClassNameKey.Contains(RequestedKey)) ||
-						(ClassNameNoPrefixKey.Contains(RequestedKey));
-
-					const bool bNameMatch =
-						(RequestedKey == CompNameKey) ||
-						(RequestedKey.Contains(CompNameKey)) ||
-						(CompNameKey.Contains(RequestedKey));
-
-					if (bClassMatch || bNameMatch)
-					{
-						FoundComp = Comp;
-						break;
-					}
-				}
-			}
-		}
-		if (FoundComp)
-		{
-			TargetObj = FoundComp;
-
-			if (PropName.StartsWith(TEXT("Material")))
-			{
-				if (UPrimitiveComponent* PrimComp = Cast<UPrimitiveComponent>(FoundComp))
-				{
-					int32 SlotIndex = 0;
-					int32 BracketIdx = INDEX_NONE;
-					if (PropName.FindChar('[', BracketIdx))
-					{
-						FString IdxStr = PropName.Mid(BracketIdx + 1).LeftChop(1);
-						SlotIndex = FCString::Atoi(*IdxStr);
-					}
-
-					UMaterialInterface* Mat = LoadObject<UMaterialInterface>(nullptr, *Value);
-					if (!Mat)
-					{
-						OutError = FString::Printf(TEXT("Material not found: %s"), *Value);
-						return false;
-					}
-
-					PrimComp->SetMaterial(SlotIndex, Mat);
-					PrimComp->MarkRenderStateDirty();
-					Actor->PostEditChange();
-					return true;
-				}
-			}
-		}
-		else
-		{
-			PropName = PropertyName;
-		}
+		Path = *Cached;
 	}
 	else
 	{
-		PropName = PropertyName;
+		if (!ResolvePropertyPath(Actor, PropertyName, Path, Component, OutError))
+		{
+			return false;
+		}
+		NovaBridgePropertyPathCache.Add(Actor->GetClass(), PropertyName, Path);
 	}
 
-	FProperty* Prop = TargetObj->GetClass()->FindPropertyByName(*PropName);
-	if (!Prop)
+	if (Path.MaterialSlot != INDEX_NONE)
 	{
-		for (TFieldIterator<FProperty> It(TargetObj->GetClass()); It; ++It)
+		UPrimitiveComponent* PrimComp = CastChecked<UPrimitiveComponent>(Component);
+		UMaterialInterface* Mat = LoadObject<UMaterialInterface>(nullptr, *Value);
+		if (!Mat)
 		{
-			if (It->GetName().Equals(PropName, ESearchCase::IgnoreCase))
-			{
-				Prop = *It;
-				break;
-			}
+			OutError = FString::Printf(TEXT("Material not found: %s"), *Value);
+			return false;
 		}
-	}
-	if (!Prop)
-	{
-		OutError = FString::Printf(TEXT("Property not found: %s"), *PropertyName);
-		return false;
+
+		PrimComp->SetMaterial(Path.MaterialSlot, Mat);
+		PrimComp->MarkRenderStateDirty();
+		Actor->PostEditChange();
+		return true;
 	}
 
-	void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(TargetObj);
-	if (!Prop->ImportText_Direct(*Value, ValuePtr, TargetObj, PPF_None))
+	UObject* TargetObj = Component ? static_cast<UObject*>(Component) : Actor;
+	void* ValuePtr = Path.Property->ContainerPtrToValuePtr<void>(TargetObj);
+	if (!Path.Property->ImportText_Direct(*Value, ValuePtr, TargetObj, PPF_None))
 	{
 		OutError = FString::Printf(TEXT("Failed to set property: %s"), *PropertyName);
 		return false;
 	}
 
-	if (UActorComponent* Comp = Cast<UActorComponent>(TargetObj))
+	if (Component)
 	{
-		Comp->MarkRenderStateDirty();
+		Component->MarkRenderStateDirty();
 	}
 	Actor->PostEditChange();
 	return true;
 }
+
+void StartPropertyPathCacheService()
+{
+	// Blueprint compiles rebuild properties inside the same UClass and hot reload swaps native ones, so
+	// either leaves cached FProperty pointers dangling.
+	BindBlueprintCompiledReset();
+	NovaBridgeObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([](const TMap<UObject*, UObject*>&)
+	{
+		ResetPropertyPathCache();
+	});
+	NovaBridgeReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason)
+	{
+		ResetPropertyPathCache();
+	});
+}
+
+void StopPropertyPathCacheService()
+{
+	if (GEditor && NovaBridgeBlueprintCompiledHandle.IsValid())
+	{
+		GEditor->OnBlueprintCompiled().Remove(NovaBridgeBlueprintCompiledHandle);
+	}
+	NovaBridgeBlueprintCompiledHandle.Reset();
+	FCoreUObjectDelegates::OnObjectsReinstanced.Remove(NovaBridgeObjectsReinstancedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(NovaBridgeReloadCompleteHandle);
+	ResetPropertyPathCache();
+}
+
+TSharedRef<const FNovaBridgeClassDescriptor> GetClassDescriptor(const UClass* Class)
+{
+	check(IsInGameThread());
+	BindBlueprintCompiledReset();
+	if (const TSharedRef<const FNovaBridgeClassDescriptor>* Existing = NovaBridgeClassDescriptors.Find(Class))
+	{
+		if ((*Existing)->Class.Get() == Class)
+		{
+			return *Existing;
+		}
+	}
+	return NovaBridgeClassDescriptors.Add(Class, BuildClassDescriptor(Class));
+}
+
+TSharedPtr<FJsonValue> ExportPropertyJson(const FNovaBridgePropertyDescriptor& Descriptor, UObject* Container)
+{
+	const void* ValuePtr = reinterpret_cast<const uint8*>(Container) + Descriptor.Offset;
+	switch (Descriptor.Export)
+	{
+	case ENovaBridgePropertyExport::Bool:
+		return MakeShared<FJsonValueBoolean>(CastFieldChecked<FBoolProperty>(Descriptor.Property)->GetPropertyValue(ValuePtr));
+	case ENovaBridgePropertyExport::Integer:
+		return MakeShared<FJsonValueNumber>(static_cast<double>(CastFieldChecked<FNumericProperty>(Descriptor.Property)->GetSignedIntPropertyValue(ValuePtr)));
+	case ENovaBridgePropertyExport::Float:
+		return MakeShared<FJsonValueNumber>(CastFieldChecked<FNumericProperty>(Descriptor.Property)->GetFloatingPointPropertyValue(ValuePtr));
+	case ENovaBridgePropertyExport::Enum:
+	{
+		const FEnumProperty* EnumProp = CastField<FEnumProperty>(Descriptor.Property);
+		const FNumericProperty* Underlying = EnumProp ? EnumProp->GetUnderlyingProperty() : CastFieldChecked<FNumericProperty>(Descriptor.Property);
+		const int64 Value = Underlying->GetSignedIntPropertyValue(ValuePtr);
+		return MakeShared<FJsonValueString>(Descriptor.Enum ? Descriptor.Enum->GetNameStringByValue(Value) : LexToString(Value));
+	}
+	case ENovaBridgePropertyExport::Name:
+		return MakeShared<FJsonValueString>(CastFieldChecked<FNameProperty>(Descriptor.Property)->GetPropertyValue(ValuePtr).ToString());
+	case ENovaBridgePropertyExport::String:
+		return MakeShared<FJsonValueString>(CastFieldChecked<FStrProperty>(Descriptor.Property)->GetPropertyValue(ValuePtr));
+	default:
+		return MakeShared<FJsonValueString>(ExportPropertyText(Descriptor, Container));
+	}
+}
+
+FString ExportPropertyText(const FNovaBridgePropertyDescriptor& Descriptor, UObject* Container)
+{
+	FString ValueStr;
+	const void* ValuePtr = reinterpret_cast<const uint8*>(Container) + Descriptor.Offset;
+	Descriptor.Property->ExportTextItem_Direct(ValueStr, ValuePtr, nullptr, Container, PPF_None);
+	return ValueStr;
+}
@@ -5,6 +5,10 @@
 #include "NovaBridgePlanEvents.h"
 #include "NovaBridgePlanSchema.h"
 #include "NovaBridgeCoreTypes.h"
+#include "NovaBridgeDeadline.h"
+#include "NovaBridgeRateLimiter.h"
+#include "NovaBridgeRoutePolicy.h"
+#include "NovaBridgeSceneList.h"
 #include "Async/Async.h"
 #include "Dom/JsonValue.h"
 #include "Editor.h"
@@ -15,8 +19,196 @@
 #include "TextureResource.h"
 #include "IImageWrapperModule.h"
 #include "IImageWrapper.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/Base64.h"
 
+namespace
+{
+// Everything a time-sliced plan carries between frames. Command handlers hold references into this object,
+// so it lives on the heap until the last slice has run.
+struct FNovaBridgePlanExecution
+{
+	FNovaBridgePlanExecution(const TArray<TSharedPtr<FJsonValue>>& InSteps, double FrameBudgetMs)
+		: Steps(InSteps)
+		, Runner(InSteps.Num(), FrameBudgetMs)
+	{
+		StepResults.Reserve(Steps.Num());
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Steps;
+	TArray<TSharedPtr<FJsonValue>> StepResults;
+	NovaBridgeCore::FPlanCommandRouter CommandRouter;
+	NovaBridgeCore::FPlanSliceRunner Runner;
+	FString PlanId;
+	FString Role;
+	// The request's token: the plan stops between steps once its caller's deadline has passed.
+	NovaBridgeCore::FCancellationTokenPtr Cancellation;
+	TFunction<void(TSharedPtr<FJsonObject>, int32)> SendResult;
+	int32 SpawnedInPlan = 0;
+	int32 SuccessCount = 0;
+	int32 ErrorCount = 0;
+};
+
+constexpr double PlanNearDefaultRadius = 100.0;
+
+// delete/set targets may be given by location instead of name: "near" picks the closest actor (optionally of
+// "class") whose bounds lie within "radius" of the point, through the spatial index.
+AActor* ResolveNearPlanTarget(const TSharedPtr<FJsonObject>& Params, FString& OutTargetName, FString& OutError)
+{
+	FVector Point = FVector::ZeroVector;
+	if (!JsonValueToVector(Params->TryGetField(TEXT("near")), Point))
+	{
+		OutError = TEXT("params.near must be [x,y,z] or {x,y,z}");
+		return nullptr;
+	}
+
+	double Radius = PlanNearDefaultRadius;
+	Params->TryGetNumberField(TEXT("radius"), Radius);
+	FString ClassName;
+	Params->TryGetStringField(TEXT("class"), ClassName);
+
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	AActor* Actor = FindNearestIndexedActor(World, Point, Radius, NovaBridgeCore::NormalizeSceneClassName(ClassName));
+	if (!Actor)
+	{
+		OutError = FString::Printf(TEXT("No actor within %.0f of (%.0f, %.0f, %.0f)"), Radius, Point.X, Point.Y, Point.Z);
+		return nullptr;
+	}
+	OutTargetName = Actor->GetActorLabel();
+	return Actor;
+}
+
+TSharedPtr<FJsonObject> RunEditorPlanStep(FNovaBridgePlanExecution& Execution, int32 StepIndex, FString& OutAction)
+{
+	NovaBridgeCore::FPlanStepContext StepContext;
+	TSharedPtr<FJsonObject> ParseErrorResult;
+	if (!NovaBridgeCore::ExtractPlanStep(Execution.Steps[StepIndex], StepIndex, StepContext, ParseErrorResult))
+	{
+		OutAction = TEXT("unknown");
+		return ParseErrorResult.IsValid()
+			? ParseErrorResult
+			: NovaBridgeCore::MakePlanStepResult(StepIndex, TEXT("error"), TEXT("Invalid plan step"));
+	}
+
+	const FString& Action = StepContext.Action;
+	OutAction = Action;
+	if (!IsPlanActionAllowedForRole(Execution.Role, Action))
+	{
+		const FString Message = FString::Printf(TEXT("Role '%s' cannot execute action '%s'"), *Execution.Role, *Action);
+		PushAuditEntry(TEXT("/nova/executePlan"), Action, Execution.Role, TEXT("denied"), Message);
+		return NovaBridgeCore::MakePlanStepResult(StepIndex, TEXT("error"), Message);
+	}
+
+	if (!Execution.CommandRouter.HasHandler(Action))
+	{
+		PushAuditEntry(TEXT("/nova/executePlan"), Action, Execution.Role, TEXT("error"), TEXT("Unsupported action"));
+		return NovaBridgeCore::MakePlanStepResult(StepIndex, TEXT("error"), FString::Printf(TEXT("Unsupported action: %s"), *Action));
+	}
+
+	TSharedPtr<FJsonObject> StepResult = Execution.CommandRouter.Dispatch(StepContext);
+	return StepResult.IsValid() ? StepResult : NovaBridgeCore::MakePlanStepResult(StepIndex, TEXT("error"), TEXT("Step execution failed"));
+}
+
+bool IsEditorPlanCancelled(const FNovaBridgePlanExecution& Execution)
+{
+	return Execution.Cancellation.IsValid() && Execution.Cancellation->IsCancelled();
+}
+
+void RunEditorPlanSlice(const TSharedRef<FNovaBridgePlanExecution>& Execution)
+{
+	if (IsEditorPlanCancelled(*Execution))
+	{
+		Execution->Runner.Cancel();
+	}
+	Execution->Runner.RunSlice(
+		[&Execution](int32 StepIndex)
+		{
+			FString Action;
+			const TSharedPtr<FJsonObject> StepResult = RunEditorPlanStep(*Execution, StepIndex, Action);
+			Execution->StepResults.Add(MakeShared<FJsonValueObject>(StepResult));
+
+			const FString StatusValue = StepResult->HasTypedField<EJson::String>(TEXT("status"))
+				? NovaBridgeCore::NormalizePlanAction(StepResult->GetStringField(TEXT("status")))
+				: FString();
+			if (StatusValue == TEXT("success"))
+			{
+				Execution->SuccessCount++;
+			}
+			else if (StatusValue == TEXT("error"))
+			{
+				Execution->ErrorCount++;
+			}
+
+			// Published as soon as the step finishes so subscribers see progress while the plan is still running.
+			const TSharedPtr<FJsonObject> PlanStepEvent = NovaBridgeCore::BuildPlanStepEvent(TEXT("editor"), Execution->PlanId, Action, StepResult);
+			if (PlanStepEvent.IsValid())
+			{
+				QueueEventObject(PlanStepEvent);
+			}
+
+			if (IsEditorPlanCancelled(*Execution))
+			{
+				Execution->Runner.Cancel();
+			}
+		},
+		[]() { return FPlatformTime::Seconds(); });
+
+	if (!Execution->Runner.IsFinished())
+	{
+		// Yield the frame; queued requests and editor ticking run before the next slice.
+		DispatchGameThreadTaskNextTick([Execution]()
+		{
+			RunEditorPlanSlice(Execution);
+		});
+		return;
+	}
+
+	const int32 StepCount = Execution->Steps.Num();
+	const bool bCancelled = Execution->Runner.IsCancelled();
+	TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+	Result->SetStringField(TEXT("status"), bCancelled ? TEXT("cancelled") : TEXT("ok"));
+	Result->SetStringField(TEXT("plan_id"), Execution->PlanId);
+	Result->SetStringField(TEXT("mode"), TEXT("editor"));
+	Result->SetStringField(TEXT("role"), Execution->Role);
+	Result->SetArrayField(TEXT("results"), Execution->StepResults);
+	Result->SetNumberField(TEXT("step_count"), StepCount);
+	Result->SetNumberField(TEXT("success_count"), Execution->SuccessCount);
+	Result->SetNumberField(TEXT("error_count"), Execution->ErrorCount);
+	Result->SetNumberField(TEXT("frame_budget_ms"), Execution->Runner.GetFrameBudgetMs());
+	Result->SetNumberField(TEXT("slices"), Execution->Runner.GetSliceCount());
+	Result->SetNumberField(TEXT("longest_slice_ms"), Execution->Runner.GetLongestSliceMs());
+	if (bCancelled)
+	{
+		Result->SetNumberField(TEXT("skipped_count"), StepCount - Execution->Runner.GetNextStep());
+	}
+
+	const TSharedPtr<FJsonObject> PlanCompleteEvent = NovaBridgeCore::BuildPlanCompleteEvent(
+		TEXT("editor"),
+		Execution->PlanId,
+		StepCount,
+		Execution->SuccessCount,
+		Execution->ErrorCount,
+		Execution->Role);
+	QueueEventObject(PlanCompleteEvent);
+
+	if (bCancelled)
+	{
+		RecordRequestCancelled();
+		PushAuditEntry(TEXT("/nova/executePlan"), TEXT("executePlan.cancelled"), Execution->Role, TEXT("cancelled"),
+			FString::Printf(TEXT("Plan %s stopped at its deadline after %d of %d steps"), *Execution->PlanId, Execution->Runner.GetNextStep(), StepCount));
+	}
+	else
+	{
+		PushAuditEntry(TEXT("/nova/executePlan"), TEXT("executePlan.complete"), Execution->Role, TEXT("success"),
+			FString::Printf(TEXT("Plan %s complete: %d success, %d error"), *Execution->PlanId, Execution->SuccessCount, Execution->ErrorCount));
+	}
+	Execution->SendResult(Result, bCancelled ? 504 : 200);
+
+	// Handlers capture references into the execution; drop them so nothing outlives the plan.
+	Execution->CommandRouter = NovaBridgeCore::FPlanCommandRouter();
+}
+} // namespace
+
 bool FNovaBridgeModule::HandleExecutePlan(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
 	TSharedPtr<FJsonObject> Body = ParseRequestBody(Request);
@@ -52,15 +244,22 @@ bool FNovaBridgeModule::HandleExecutePlan(const FHttpServerRequest& Request, con
 		}
 	}
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Steps, PlanId, Role]()
+	const double FrameBudgetMs = Body->HasTypedField<EJson::Number>(TEXT("frame_budget_ms"))
+		? NovaBridgeCore::ClampRequestedPlanFrameBudgetMs(Body->GetNumberField(TEXT("frame_budget_ms")), GetNovaBridgeEditorPlanMaxFrameBudgetMs())
+		: GetNovaBridgeEditorPlanFrameBudgetMs();
+	const TSharedRef<FNovaBridgePlanExecution> Execution = MakeShared<FNovaBridgePlanExecution>(Steps, FrameBudgetMs);
+	Execution->PlanId = PlanId;
+	Execution->Role = Role;
+	Execution->Cancellation = GetCurrentCancellationToken();
+	Execution->SendResult = [this, OnComplete](TSharedPtr<FJsonObject> Result, int32 StatusCode)
 	{
-		TArray<TSharedPtr<FJsonValue>> StepResults;
-		StepResults.Reserve(Steps.Num());
-		TArray<FString> StepActions;
-		StepActions.SetNum(Steps.Num());
-		int32 SpawnedInPlan = 0;
+		SendJsonResponse(OnComplete, Result, StatusCode);
+	};
 
-		NovaBridgeCore::FPlanCommandRouter CommandRouter;
+	DispatchGameThreadTask([this, Execution, PlanId, Role]()
+	{
+		int32& SpawnedInPlan = Execution->SpawnedInPlan;
+		NovaBridgeCore::FPlanCommandRouter& CommandRouter = Execution->CommandRouter;
 		CommandRouter.Register(TEXT("spawn"), [this, Role, PlanId, &SpawnedInPlan](const NovaBridgeCore::FPlanStepContext& Step)
 		{
 			const TSharedPtr<FJsonObject> Params = Step.Params.IsValid() ? Step.Params : MakeShared<FJsonObject>();
@@ -109,9 +308,13 @@ bool FNovaBridgeModule::HandleExecutePlan(const FHttpServerRequest& Request, con
 				return NovaBridgeCore::MakePlanStepResult(Step.StepIndex, TEXT("error"), Message);
 			}
 
-			const int32 SpawnRateLimit = GetRouteRateLimitPerMinute(Role, TEXT("/nova/scene/spawn"));
+			const int32 RoleSlot = NovaBridgeCore::FTokenBucketRateLimiter::RoleSlotForName(Role);
+			const NovaBridgeCore::FRoutePolicy* SpawnPolicy = FindRoutePolicy(TEXT("/nova/scene/spawn"));
+			const int32 SpawnRateLimit = SpawnPolicy ? SpawnPolicy->RateLimitFor(RoleSlot) : 0;
+			static const int32 PlanSpawnRateRouteId = RegisterRateLimitRoute(TEXT("plan.spawn"));
+			NovaBridgeCore::FRateLimitDecision SpawnRateDecision;
 			FString SpawnRateError;
-			if (!ConsumeRateLimit(Role + TEXT("|plan.spawn"), SpawnRateLimit, SpawnRateError))
+			if (!ConsumeRateLimit(PlanSpawnRateRouteId, RoleSlot, SpawnRateLimit, SpawnRateDecision, SpawnRateError))
 			{
 				PushAuditEntry(TEXT("/nova/executePlan"), Step.Action, Role, TEXT("rate_limited"), SpawnRateError);
 				return NovaBridgeCore::MakePlanStepResult(Step.StepIndex, TEXT("error"), SpawnRateError);
@@ -194,12 +397,22 @@ bool FNovaBridgeModule::HandleExecutePlan(const FHttpServerRequest& Request, con
 			{
 				ActorName = Params->GetStringField(TEXT("target"));
 			}
+			AActor* Actor = nullptr;
+			if (ActorName.IsEmpty() && Params->HasField(TEXT("near")))
+			{
+				FString NearError;
+				Actor = ResolveNearPlanTarget(Params, ActorName, NearError);
+				if (!Actor)
+				{
+					return NovaBridgeCore::MakePlanStepResult(Step.StepIndex, TEXT("error"), NearError);
+				}
+			}
 			if (ActorName.IsEmpty())
 			{
-				return NovaBridgeCore::MakePlanStepResult(Step.StepIndex, TEXT("error"), TEXT("delete.params.name is required"));
+				return NovaBridgeCore::MakePlanStepResult(Step.StepIndex, TEXT("error"), TEXT("delete.params.name or near is required"));
 			}
 
-			AActor* Actor = FindActorByName(ActorName);
+			Actor = Actor ? Actor : FindActorByName(ActorName);
 			if (!Actor)
 			{
 				return NovaBridgeCore::MakePlanStepResult(
@@ -252,12 +465,22 @@ bool FNovaBridgeModule::HandleExecutePlan(const FHttpServerRequest& Request, con
 			{
 				Target = Params->GetStringField(TEXT("name"));
 			}
+			AActor* Actor = nullptr;
+			if (Target.IsEmpty() && Params->HasField(TEXT("near")))
+			{
+				FString NearError;
+				Actor = ResolveNearPlanTarget(Params, Target, NearError);
+				if (!Actor)
+				{
+					return NovaBridgeCore::MakePlanStepResult(Step.StepIndex, TEXT("error"), NearError);
+				}
+			}
 			if (Target.IsEmpty())
 			{
-				return NovaBridgeCore::MakePlanStepResult(Step.StepIndex, TEXT("error"), TEXT("set.params.target is required"));
+				return NovaBridgeCore::MakePlanStepResult(Step.StepIndex, TEXT("error"), TEXT("set.params.target or near is required"));
 			}
 
-			AActor* Actor = FindActorByName(Target);
+			Actor = Actor ? Actor : FindActorByName(Target);
 			if (!Actor)
 			{
 				return NovaBridgeCore::MakePlanStepResult(
@@ -370,6 +593,7 @@ bool FNovaBridgeModule::HandleExecutePlan(const FHttpServerRequest& Request, con
 			{
 				CaptureWidth = FMath::Clamp(RequestedWidth, 64, 3840);
 				CaptureHeight = FMath::Clamp(RequestedHeight, 64, 2160);
+				++CameraRevision;
 				CleanupCapture();
 			}
 
@@ -420,128 +644,9 @@ bool FNovaBridgeModule::HandleExecutePlan(const FHttpServerRequest& Request, con
 			return StepResult;
 		});
 
-		for (int32 StepIndex = 0; StepIndex < Steps.Num(); ++StepIndex)
-		{
-			NovaBridgeCore::FPlanStepContext StepContext;
-			TSharedPtr<FJsonObject> ParseErrorResult;
-			if (!NovaBridgeCore::ExtractPlanStep(Steps[StepIndex], StepIndex, StepContext, ParseErrorResult))
-			{
-				StepActions[StepIndex] = TEXT("unknown");
-				StepResults.Add(MakeShareable(new FJsonValueObject(
-					ParseErrorResult.IsValid()
-						? ParseErrorResult
-						: NovaBridgeCore::MakePlanStepResult(StepIndex, TEXT("error"), TEXT("Invalid plan step")))));
-				continue;
-			}
-
-			const FString& Action = StepContext.Action;
-			StepActions[StepIndex] = Action;
-
-			if (!IsPlanActionAllowedForRole(Role, Action))
-			{
-				const FString Message = FString::Printf(TEXT("Role '%s' cannot execute action '%s'"), *Role, *Action);
-				StepResults.Add(MakeShareable(new FJsonValueObject(
-					NovaBridgeCore::MakePlanStepResult(StepIndex, TEXT("error"), Message))));
-				PushAuditEntry(TEXT("/nova/executePlan"), Action, Role, TEXT("denied"), Message);
-				continue;
-			}
-
-			TSharedPtr<FJsonObject> StepResult;
-			if (!CommandRouter.HasHandler(Action))
-			{
-				StepResult = NovaBridgeCore::MakePlanStepResult(
-					StepIndex,
-					TEXT("error"),
-					FString::Printf(TEXT("Unsupported action: %s"), *Action));
-				PushAuditEntry(TEXT("/nova/executePlan"), Action, Role, TEXT("error"), TEXT("Unsupported action"));
-			}
-			else
-			{
-				StepResult = CommandRouter.Dispatch(StepContext);
-			}
-
-			if (!StepResult.IsValid())
-			{
-				StepResult = NovaBridgeCore::MakePlanStepResult(StepIndex, TEXT("error"), TEXT("Step execution failed"));
-			}
-			StepResults.Add(MakeShareable(new FJsonValueObject(StepResult)));
-		}
-
-		TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
-		Result->SetStringField(TEXT("status"), TEXT("ok"));
-		Result->SetStringField(TEXT("plan_id"), PlanId);
-		Result->SetStringField(TEXT("mode"), TEXT("editor"));
-		Result->SetStringField(TEXT("role"), Role);
-		Result->SetArrayField(TEXT("results"), StepResults);
-		Result->SetNumberField(TEXT("step_count"), Steps.Num());
-
-		int32 SuccessCount = 0;
-		int32 ErrorCount = 0;
-		for (const TSharedPtr<FJsonValue>& StepResultValue : StepResults)
-		{
-			if (!StepResultValue.IsValid() || StepResultValue->Type != EJson::Object)
-			{
-				continue;
-			}
-			const TSharedPtr<FJsonObject> StepResultObj = StepResultValue->AsObject();
-			if (!StepResultObj.IsValid())
-			{
-				continue;
-			}
-
-			const FString StatusValue = StepResultObj->HasTypedField<EJson::String>(TEXT("status"))
-				? NovaBridgeCore::NormalizePlanAction(StepResultObj->GetStringField(TEXT("status")))
-				: FString();
-			if (StatusValue == TEXT("success"))
-			{
-				SuccessCount++;
-			}
-			else if (StatusValue == TEXT("error"))
-			{
-				ErrorCount++;
-			}
-		}
-		Result->SetNumberField(TEXT("success_count"), SuccessCount);
-		Result->SetNumberField(TEXT("error_count"), ErrorCount);
-
-		for (const TSharedPtr<FJsonValue>& StepResultValue : StepResults)
-		{
-			if (!StepResultValue.IsValid() || StepResultValue->Type != EJson::Object)
-			{
-				continue;
-			}
-			const TSharedPtr<FJsonObject> StepResultObj = StepResultValue->AsObject();
-			if (!StepResultObj.IsValid())
-			{
-				continue;
-			}
-
-			const int32 ResultStepIndex = StepResultObj->HasTypedField<EJson::Number>(TEXT("step"))
-				? static_cast<int32>(StepResultObj->GetNumberField(TEXT("step")))
-				: INDEX_NONE;
-			const FString ResultAction = (ResultStepIndex >= 0 && ResultStepIndex < StepActions.Num() && !StepActions[ResultStepIndex].IsEmpty())
-				? StepActions[ResultStepIndex]
-				: TEXT("unknown");
-
-			const TSharedPtr<FJsonObject> PlanStepEvent = NovaBridgeCore::BuildPlanStepEvent(TEXT("editor"), PlanId, ResultAction, StepResultObj);
-			if (PlanStepEvent.IsValid())
-			{
-				QueueEventObject(PlanStepEvent);
-			}
-		}
-
-		const TSharedPtr<FJsonObject> PlanCompleteEvent = NovaBridgeCore::BuildPlanCompleteEvent(
-			TEXT("editor"),
-			PlanId,
-			Steps.Num(),
-			SuccessCount,
-			ErrorCount,
-			Role);
-		QueueEventObject(PlanCompleteEvent);
-
-		PushAuditEntry(TEXT("/nova/executePlan"), TEXT("executePlan.complete"), Role, TEXT("success"),
-			FString::Printf(TEXT("Plan %s complete: %d success, %d error"), *PlanId, SuccessCount, ErrorCount));
-		SendJsonResponse(OnComplete, Result);
+		// From here the plan answers its own deadline with the steps it ran and skipped_count.
+		ClaimDeadlineResponse();
+		RunEditorPlanSlice(Execution);
 	});
 	return true;
 }
@@ -1,10 +1,23 @@
 #include "NovaBridgeModule.h"
+#include "NovaBridgeAdmission.h"
+#include "NovaBridgeCapabilityRegistry.h"
 #include "NovaBridgeCoreTypes.h"
+#include "NovaBridgeDeadline.h"
 #include "NovaBridgeEditorInternals.h"
+#include "NovaBridgeEntityTag.h"
 #include "NovaBridgeHttpUtils.h"
+#include "NovaBridgeMetrics.h"
+#include "NovaBridgeRateLimiter.h"
+#include "NovaBridgeResponseCompression.h"
+#include "NovaBridgeResponseProfile.h"
+#include "NovaBridgeRoutePolicy.h"
+#include "NovaBridgeSceneSnapshot.h"
+#include "NovaBridgeTaskLanes.h"
 
 #include "Dom/JsonObject.h"
+#include "Editor.h"
 #include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
 #include "HttpPath.h"
 #include "HttpServerModule.h"
 #include "HttpServerRequest.h"
@@ -12,6 +25,7 @@
 #include "IHttpRouter.h"
 #include "Misc/CommandLine.h"
 #include "Misc/Parse.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -82,6 +96,42 @@ void FNovaBridgeModule::StartHttpServer()
 		SetNovaBridgeDefaultRole(TEXT("admin"));
 	}
 
+	// Responses at least this large are compressed when the client accepts it; 0 turns compression off.
+	CompressionMinBytes = NovaBridgeCore::DefaultCompressionMinBytes;
+	FParse::Value(FCommandLine::Get(), TEXT("NovaBridgeCompressMinBytes="), CompressionMinBytes);
+
+	// Game-thread admission per route class; 0 turns a limit off. Heavy routes are capped by depth only,
+	// since a single render or lighting build holds its slot for minutes.
+	int32 MaxInFlight = NovaBridgeCore::DefaultAdmissionMaxInFlight;
+	int32 MaxHeavyInFlight = NovaBridgeCore::DefaultAdmissionMaxHeavyInFlight;
+	int32 MaxQueueWaitMs = NovaBridgeCore::DefaultAdmissionMaxWaitMs;
+	FParse::Value(FCommandLine::Get(), TEXT("NovaBridgeMaxInFlight="), MaxInFlight);
+	FParse::Value(FCommandLine::Get(), TEXT("NovaBridgeMaxHeavyInFlight="), MaxHeavyInFlight);
+	FParse::Value(FCommandLine::Get(), TEXT("NovaBridgeMaxQueueWaitMs="), MaxQueueWaitMs);
+	NovaBridgeCore::FAdmissionController& AdmissionController = GetAdmissionController();
+	AdmissionController.Configure(NovaBridgeCore::ERouteClass::Control, {});
+	AdmissionController.Configure(NovaBridgeCore::ERouteClass::Read, { MaxInFlight, MaxQueueWaitMs });
+	AdmissionController.Configure(NovaBridgeCore::ERouteClass::Write, { MaxInFlight, MaxQueueWaitMs });
+	AdmissionController.Configure(NovaBridgeCore::ERouteClass::Heavy, { MaxHeavyInFlight, 0 });
+
+	// Reads always drain first and in full; writes and heavy work get a per-frame budget after them.
+	float MutatingLaneBudgetMs = static_cast<float>(NovaBridgeCore::DefaultMutatingLaneBudgetMs);
+	float HeavyLaneBudgetMs = static_cast<float>(NovaBridgeCore::DefaultHeavyLaneBudgetMs);
+	FParse::Value(FCommandLine::Get(), TEXT("NovaBridgeMutatingLaneBudgetMs="), MutatingLaneBudgetMs);
+	FParse::Value(FCommandLine::Get(), TEXT("NovaBridgeHeavyLaneBudgetMs="), HeavyLaneBudgetMs);
+	StartGameThreadLanes(MutatingLaneBudgetMs, HeavyLaneBudgetMs);
+
+	float ParsedPlanFrameBudgetMs = 0.0f;
+	if (FParse::Value(FCommandLine::Get(), TEXT("NovaBridgePlanFrameBudgetMs="), ParsedPlanFrameBudgetMs))
+	{
+		SetNovaBridgeEditorPlanFrameBudgetMs(ParsedPlanFrameBudgetMs);
+	}
+	float ParsedPlanMaxFrameBudgetMs = 0.0f;
+	if (FParse::Value(FCommandLine::Get(), TEXT("NovaBridgePlanMaxFrameBudgetMs="), ParsedPlanMaxFrameBudgetMs))
+	{
+		SetNovaBridgeEditorPlanMaxFrameBudgetMs(ParsedPlanMaxFrameBudgetMs);
+	}
+
 	UE_LOG(LogNovaBridge, Log, TEXT("NovaBridge default role: %s"), *GetNovaBridgeDefaultRole());
 	ResetNovaBridgeEditorControlState();
 	RegisterEditorCapabilities(EventWsPort);
@@ -96,41 +146,133 @@ void FNovaBridgeModule::StartHttpServer()
 	auto Bind = [this](const TCHAR* Path, EHttpServerRequestVerbs Verbs, bool (FNovaBridgeModule::*Handler)(const FHttpServerRequest&, const FHttpResultCallback&))
 	{
 		const FString RoutePath(Path);
+		NovaBridgeCore::FRouteMetrics* RouteMetrics = NovaBridgeCore::FRouteMetricsRegistry::Get().RegisterRoute(RoutePath);
+		const NovaBridgeCore::FRoutePolicy* Policy = CompileRoutePolicy(RoutePath);
+		TFunction<uint64()> RevisionSource = MakeRouteRevisionSource(RoutePath);
+		BatchRoutes.Add(RoutePath, FBatchRoute { Handler, Verbs, RouteMetrics, Policy });
 		ApiRouteCount++;
 		RouteHandles.Add(HttpRouter->BindRoute(
 			FHttpPath(Path), Verbs,
-			FHttpRequestHandler::CreateLambda([this, Handler, RoutePath](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) -> bool
+			FHttpRequestHandler::CreateLambda([this, Handler, RoutePath, RouteMetrics, Policy, RevisionSource](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) -> bool
 			{
-				if (!IsApiKeyAuthorized(Request, OnComplete))
+				const double CheckStartSec = FPlatformTime::Seconds();
+				const TSharedRef<FNovaBridgeRequestTiming> Timing = MakeShared<FNovaBridgeRequestTiming>();
+				Timing->Route = RouteMetrics;
+				Timing->Profile = NovaBridgeCore::ParseResponseProfile(Request);
+				Timing->Lane = NovaBridgeCore::TaskLaneForRouteClass(Policy->RouteClass);
+				const NovaBridgeCore::EContentEncoding Encoding = NovaBridgeCore::NegotiateContentEncoding(
+					NovaBridgeCore::GetHeaderValueCaseInsensitive(Request, TEXT("Accept-Encoding")));
+				const FHttpResultCallback TimedOnComplete = WrapResultCallbackWithMetrics(Timing,
+					NovaBridgeCore::WrapResultCallbackWithCompression(Encoding, CompressionMinBytes, RouteMetrics, OnComplete));
+				auto RecordCheckTime = [RouteMetrics, CheckStartSec]()
+				{
+					RouteMetrics->CheckUs.Record(static_cast<uint64>((FPlatformTime::Seconds() - CheckStartSec) * 1000000.0));
+				};
+				const bool bAuditDenials = Policy->AuditLevel != NovaBridgeCore::ERouteAuditLevel::Quiet;
+
+				if (!IsApiKeyAuthorized(Request, TimedOnComplete))
 				{
-					PushAuditEntry(RoutePath, RoutePath, TEXT("n/a"), TEXT("denied"), TEXT("API key unauthorized"));
+					RecordCheckTime();
+					if (bAuditDenials)
+					{
+						PushAuditEntry(RoutePath, RoutePath, TEXT("n/a"), TEXT("denied"), TEXT("API key unauthorized"));
+					}
 					return true;
 				}
 
 				const FString Role = ResolveRoleFromRequest(Request);
-				if (!IsRouteAllowedForRole(Role, RoutePath, Request.Verb))
+				const int32 RoleSlot = NovaBridgeCore::FTokenBucketRateLimiter::RoleSlotForName(Role);
+				if (!Policy->Allows(RoleSlot, Request.Verb))
 				{
-					PushAuditEntry(RoutePath, RoutePath, Role, TEXT("denied"), TEXT("Role does not have permission for this endpoint"));
-					SendErrorResponse(OnComplete, TEXT("Permission denied for role on this endpoint"), 403);
+					RecordCheckTime();
+					if (bAuditDenials)
+					{
+						PushAuditEntry(RoutePath, RoutePath, Role, TEXT("denied"), TEXT("Role does not have permission for this endpoint"));
+					}
+					SendErrorResponse(TimedOnComplete, TEXT("Permission denied for role on this endpoint"), 403);
 					return true;
 				}
 
-				const int32 RateLimit = GetRouteRateLimitPerMinute(Role, RoutePath);
+				NovaBridgeCore::FRateLimitDecision RateDecision;
 				FString RateError;
-				const FString RateBucket = Role + TEXT("|") + RoutePath;
-				if (!ConsumeRateLimit(RateBucket, RateLimit, RateError))
+				const bool bRateAllowed = ConsumeRateLimit(Policy->RateRouteId, RoleSlot, Policy->RateLimitFor(RoleSlot), RateDecision, RateError);
+				const FHttpResultCallback LimitedOnComplete = NovaBridgeCore::WrapResultCallbackWithRateLimitHeaders(RateDecision, TimedOnComplete);
+				if (!bRateAllowed)
 				{
-					PushAuditEntry(RoutePath, RoutePath, Role, TEXT("rate_limited"), RateError);
-					SendErrorResponse(OnComplete, RateError, 429);
+					RecordCheckTime();
+					if (bAuditDenials)
+					{
+						PushAuditEntry(RoutePath, RoutePath, Role, TEXT("rate_limited"), RateError);
+					}
+					SendErrorResponse(LimitedOnComplete, RateError, 429);
 					return true;
 				}
+				RecordCheckTime();
+
+				FHttpResultCallback HandlerOnComplete = LimitedOnComplete;
+				if (RevisionSource && Request.Verb == EHttpServerRequestVerbs::VERB_GET)
+				{
+					// The listener ticks on the game thread, so the counter is read inline; a match is answered
+					// here without queueing the handler's game-thread task.
+					const FString ETag = NovaBridgeCore::MakeRevisionETag(RevisionSource(), NovaBridgeCore::HashRequestVariant(Request, Role));
+					if (NovaBridgeCore::MatchesIfNoneMatch(Request, ETag))
+					{
+						TUniquePtr<FHttpServerResponse> NotModified = NovaBridgeCore::MakeNotModifiedResponse(ETag);
+						AddCorsHeaders(NotModified);
+						LimitedOnComplete(MoveTemp(NotModified));
+						return true;
+					}
+					HandlerOnComplete = NovaBridgeCore::WrapResultCallbackWithETag(ETag, LimitedOnComplete);
+				}
+
+				// Admitted last, so denials and 304s never count against the game-thread queue.
+				const NovaBridgeCore::FAdmissionDecision Admission = GetAdmissionController().TryAdmit(Policy->RouteClass);
+				if (!Admission.bAdmitted)
+				{
+					const FString Message = FString::Printf(TEXT("Editor busy: %d %s requests in flight, estimated wait %d ms"),
+						Admission.InFlight, NovaBridgeCore::RouteClassToString(Admission.Class), Admission.EstimatedWaitMs);
+					if (bAuditDenials)
+					{
+						PushAuditEntry(RoutePath, RoutePath, Role, TEXT("overloaded"), Message);
+					}
+					SendErrorResponse(NovaBridgeCore::WrapResultCallbackWithAdmissionHeaders(Admission, LimitedOnComplete), Message, 503);
+					return true;
+				}
+				HandlerOnComplete = NovaBridgeCore::WrapResultCallbackWithAdmission(GetAdmissionController(), Policy->RouteClass,
+					NovaBridgeCore::WrapResultCallbackWithAdmissionHeaders(Admission, HandlerOnComplete));
+
+				int32 DeadlineMs = NovaBridgeCore::ParseRequestDeadlineMs(Request);
+				if (DeadlineMs <= 0)
+				{
+					DeadlineMs = Policy->DefaultDeadlineMs;
+				}
+				if (DeadlineMs > 0)
+				{
+					// The expiry responder holds the callback weakly, so a handler that drops its callback still
+					// releases the admission slot.
+					const TSharedRef<FHttpResultCallback, ESPMode::ThreadSafe> SharedOnComplete = MakeShared<FHttpResultCallback, ESPMode::ThreadSafe>(HandlerOnComplete);
+					const TWeakPtr<FHttpResultCallback, ESPMode::ThreadSafe> WeakOnComplete = SharedOnComplete;
+					HandlerOnComplete = [SharedOnComplete](TUniquePtr<FHttpServerResponse>&& Response)
+					{
+						(*SharedOnComplete)(MoveTemp(Response));
+					};
+					Timing->Cancellation = MakeShared<NovaBridgeCore::FCancellationToken, ESPMode::ThreadSafe>(CheckStartSec + DeadlineMs / 1000.0);
+					Timing->ExpiredResponder = [this, WeakOnComplete, DeadlineMs]()
+					{
+						if (const TSharedPtr<FHttpResultCallback, ESPMode::ThreadSafe> PinnedOnComplete = WeakOnComplete.Pin())
+						{
+							SendErrorResponse(*PinnedOnComplete, FString::Printf(TEXT("Request deadline of %d ms passed before it ran"), DeadlineMs), 504);
+						}
+					};
+				}
 
 				UE_LOG(LogNovaBridge, Verbose, TEXT("[%s] %s %s role=%s"),
 					*FDateTime::Now().ToString(),
 					HttpVerbToString(Request.Verb),
 					*Request.RelativePath.GetPath(),
 					*Role);
-				return (this->*Handler)(Request, OnComplete);
+				FNovaBridgeRequestScope RequestScope(Timing);
+				return (this->*Handler)(Request, HandlerOnComplete);
 			})
 		));
 
@@ -156,13 +298,19 @@ void FNovaBridgeModule::StartHttpServer()
 	BindWithAuditName(TEXT("/nova/audit"), EHttpServerRequestVerbs::VERB_GET, &FNovaBridgeModule::HandleAuditTrail);
 	BindWithAuditName(TEXT("/nova/executePlan"), EHttpServerRequestVerbs::VERB_POST, &FNovaBridgeModule::HandleExecutePlan);
 	BindWithAuditName(TEXT("/nova/undo"), EHttpServerRequestVerbs::VERB_POST, &FNovaBridgeModule::HandleUndo);
+	BindWithAuditName(TEXT("/nova/metrics"), EHttpServerRequestVerbs::VERB_GET, &FNovaBridgeModule::HandleMetrics);
+	BindWithAuditName(TEXT("/nova/batch"), EHttpServerRequestVerbs::VERB_POST, &FNovaBridgeModule::HandleBatch);
 
 	// Scene
 	BindWithAuditName(TEXT("/nova/scene/list"), EHttpServerRequestVerbs::VERB_GET, &FNovaBridgeModule::HandleSceneList);
+	BindWithAuditName(TEXT("/nova/scene/changes"), EHttpServerRequestVerbs::VERB_GET, &FNovaBridgeModule::HandleSceneChanges);
+	BindWithAuditName(TEXT("/nova/scene/query"), EHttpServerRequestVerbs::VERB_POST, &FNovaBridgeModule::HandleSceneQuery);
 	BindWithAuditName(TEXT("/nova/scene/spawn"), EHttpServerRequestVerbs::VERB_POST, &FNovaBridgeModule::HandleSceneSpawn);
 	BindWithAuditName(TEXT("/nova/scene/delete"), EHttpServerRequestVerbs::VERB_POST, &FNovaBridgeModule::HandleSceneDelete);
 	BindWithAuditName(TEXT("/nova/scene/transform"), EHttpServerRequestVerbs::VERB_POST, &FNovaBridgeModule::HandleSceneTransform);
+	BindWithAuditName(TEXT("/nova/scene/transform-batch"), EHttpServerRequestVerbs::VERB_POST, &FNovaBridgeModule::HandleSceneTransformBatch);
 	BindWithAuditName(TEXT("/nova/scene/get"), EHttpServerRequestVerbs::VERB_GET | EHttpServerRequestVerbs::VERB_POST, &FNovaBridgeModule::HandleSceneGet);
+	BindWithAuditName(TEXT("/nova/scene/get-many"), EHttpServerRequestVerbs::VERB_POST, &FNovaBridgeModule::HandleSceneGetMany);
 	BindWithAuditName(TEXT("/nova/scene/set-property"), EHttpServerRequestVerbs::VERB_POST, &FNovaBridgeModule::HandleSceneSetProperty);
 
 	// Assets
@@ -248,6 +396,8 @@ void FNovaBridgeModule::StopHttpServer()
 		}
 		RouteHandles.Empty();
 	}
+	BatchRoutes.Empty();
+	StopGameThreadLanes();
 
 	ApiRouteCount = 0;
 	FHttpServerModule::Get().StopAllListeners();
@@ -284,7 +434,8 @@ void FNovaBridgeModule::AddCorsHeaders(TUniquePtr<FHttpServerResponse>& Response
 
 	Response->Headers.FindOrAdd(TEXT("Access-Control-Allow-Origin")).Add(TEXT("*"));
 	Response->Headers.FindOrAdd(TEXT("Access-Control-Allow-Methods")).Add(TEXT("GET, POST, OPTIONS"));
-	Response->Headers.FindOrAdd(TEXT("Access-Control-Allow-Headers")).Add(TEXT("Content-Type, Authorization, X-API-Key, X-NovaBridge-Role"));
+	Response->Headers.FindOrAdd(TEXT("Access-Control-Allow-Headers")).Add(TEXT("Content-Type, Authorization, X-API-Key, X-NovaBridge-Role, X-NovaBridge-Deadline, If-None-Match"));
+	Response->Headers.FindOrAdd(TEXT("Access-Control-Expose-Headers")).Add(TEXT("ETag, Retry-After, X-NovaBridge-Queue-Depth"));
 	Response->Headers.FindOrAdd(TEXT("Access-Control-Max-Age")).Add(TEXT("86400"));
 }
 
@@ -330,6 +481,44 @@ bool FNovaBridgeModule::IsApiKeyAuthorized(const FHttpServerRequest& Request, co
 	return false;
 }
 
+TFunction<uint64()> FNovaBridgeModule::MakeRouteRevisionSource(const FString& RoutePath)
+{
+	if (RoutePath == TEXT("/nova/scene/list"))
+	{
+		return []()
+		{
+			return GetSceneRevision(GEditor ? GEditor->GetEditorWorldContext().World() : nullptr);
+		};
+	}
+	if (RoutePath == TEXT("/nova/asset/list"))
+	{
+		return &GetAssetRegistryRevision;
+	}
+	if (RoutePath == TEXT("/nova/caps"))
+	{
+		return []()
+		{
+			return NovaBridgeCore::FCapabilityRegistry::Get().GetVersion();
+		};
+	}
+	if (RoutePath == TEXT("/nova/project/info"))
+	{
+		// Fixed for the life of the process; the tag's epoch covers restarts.
+		return []()
+		{
+			return static_cast<uint64>(0);
+		};
+	}
+	if (RoutePath == TEXT("/nova/viewport/camera/get"))
+	{
+		return [this]()
+		{
+			return CameraRevision;
+		};
+	}
+	return nullptr;
+}
+
 bool FNovaBridgeModule::HandleCorsPreflight(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
 	(void)Request;
@@ -339,15 +528,47 @@ bool FNovaBridgeModule::HandleCorsPreflight(const FHttpServerRequest& Request, c
 
 void FNovaBridgeModule::SendJsonResponse(const FHttpResultCallback& OnComplete, TSharedPtr<FJsonObject> JsonObj, int32 StatusCode)
 {
+	const double SerializeStartSec = FPlatformTime::Seconds();
 	FString ResponseStr;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResponseStr);
-	FJsonSerializer::Serialize(JsonObj.ToSharedRef(), Writer);
+	const NovaBridgeCore::FResponseProfile Profile = GetCurrentResponseProfile();
+	if (Profile.bCompact)
+	{
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ResponseStr);
+		NovaBridgeCore::WriteCompactJson(*Writer, *JsonObj, Profile.Precision);
+		Writer->Close();
+	}
+	else
+	{
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResponseStr);
+		FJsonSerializer::Serialize(JsonObj.ToSharedRef(), Writer);
+	}
 	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(ResponseStr, TEXT("application/json"));
+	RecordResponseSerializeTime(FPlatformTime::Seconds() - SerializeStartSec);
 	Response->Code = static_cast<EHttpServerResponseCodes>(StatusCode);
 	AddCorsHeaders(Response);
 	OnComplete(MoveTemp(Response));
 }
 
+void FNovaBridgeModule::SendEncodedJsonResponse(const FHttpResultCallback& OnComplete, TSharedRef<FJsonObject> Envelope, const FString& ArrayField, TUniqueFunction<FString(const NovaBridgeCore::FResponseProfile&)>&& EncodeArray)
+{
+	const NovaBridgeCore::FResponseProfile Profile = GetCurrentResponseProfile();
+	DispatchBackgroundTask([this, OnComplete, Envelope, ArrayField, Profile, EncodeArray = MoveTemp(EncodeArray)]()
+	{
+		const double SerializeStartSec = FPlatformTime::Seconds();
+		const FString Body = NovaBridgeCore::ComposeJsonBody(Envelope, *ArrayField, EncodeArray(Profile), Profile);
+		const FTCHARToUTF8 Utf8(*Body, Body.Len());
+		TArray<uint8> Bytes(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		RecordResponseSerializeTime(FPlatformTime::Seconds() - SerializeStartSec);
+
+		DispatchGameThreadTask([this, OnComplete, Bytes = MoveTemp(Bytes)]() mutable
+		{
+			TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(MoveTemp(Bytes), TEXT("application/json"));
+			AddCorsHeaders(Response);
+			OnComplete(MoveTemp(Response));
+		});
+	});
+}
+
 void FNovaBridgeModule::SendErrorResponse(const FHttpResultCallback& OnComplete, const FString& Error, int32 StatusCode)
 {
 	const TSharedPtr<FJsonObject> JsonObj = MakeShared<FJsonObject>();
@@ -0,0 +1,238 @@
+#include "NovaBridgeEditorInternals.h"
+
+#include "NovaBridgeModule.h"
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Misc/ScopeLock.h"
+#include "Modules/ModuleManager.h"
+
+namespace
+{
+struct FNovaBridgeEncodeJob
+{
+	ENovaBridgeEncodeFormat Format = ENovaBridgeEncodeFormat::Png;
+	ENovaBridgeEncodeCallbackThread CallbackThread = ENovaBridgeEncodeCallbackThread::GameThread;
+	TArray<FColor> Pixels;
+	int32 Width = 0;
+	int32 Height = 0;
+	int32 Quality = 0;
+	double QueuedTimeSec = 0.0;
+	FNovaBridgeEncodeCallback OnEncoded;
+};
+
+FCriticalSection NovaBridgeEncodeMutex;
+TArray<FNovaBridgeEncodeJob> NovaBridgeEncodeQueue;
+IImageWrapperModule* NovaBridgeImageWrapperModule = nullptr;
+bool bNovaBridgeEncodeAccepting = false;
+int32 NovaBridgeEncodeActiveTotal = 0;
+int32 NovaBridgeEncodeActiveByFormat[2] = { 0, 0 };
+FNovaBridgeEncodeStats NovaBridgeEncodeCounters;
+const int32 NovaBridgeEncodeMaxWorkers = 4;
+const int32 NovaBridgeEncodeMaxPng = 3;
+const int32 NovaBridgeEncodeMaxJpeg = 2;
+const int32 NovaBridgeEncodeQueueLimit = 32;
+
+int32 FormatIndex(ENovaBridgeEncodeFormat Format)
+{
+	return Format == ENovaBridgeEncodeFormat::Jpeg ? 1 : 0;
+}
+
+int32 FormatConcurrencyLimit(ENovaBridgeEncodeFormat Format)
+{
+	return Format == ENovaBridgeEncodeFormat::Jpeg ? NovaBridgeEncodeMaxJpeg : NovaBridgeEncodeMaxPng;
+}
+
+FNovaBridgeEncodeResult EncodePixels(
+	IImageWrapperModule* ImageWrapperModule,
+	ENovaBridgeEncodeFormat Format,
+	const TArray<FColor>& Pixels,
+	int32 Width,
+	int32 Height,
+	int32 Quality,
+	double QueuedTimeSec)
+{
+	FNovaBridgeEncodeResult Result;
+	const double StartSec = FPlatformTime::Seconds();
+	Result.QueueWaitMs = (StartSec - QueuedTimeSec) * 1000.0;
+
+	const EImageFormat ImageFormat = Format == ENovaBridgeEncodeFormat::Jpeg ? EImageFormat::JPEG : EImageFormat::PNG;
+	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule ? ImageWrapperModule->CreateImageWrapper(ImageFormat) : nullptr;
+	if (!ImageWrapper.IsValid()
+		|| !ImageWrapper->SetRaw(Pixels.GetData(), Pixels.Num() * sizeof(FColor), Width, Height, ERGBFormat::BGRA, 8))
+	{
+		Result.Error = TEXT("Failed to initialize image encoder");
+	}
+	else
+	{
+		Result.Bytes = ImageWrapper->GetCompressed(Quality);
+		Result.bSuccess = Result.Bytes.Num() > 0;
+		if (!Result.bSuccess)
+		{
+			Result.Error = Format == ENovaBridgeEncodeFormat::Jpeg ? TEXT("Failed to encode JPEG") : TEXT("Failed to encode PNG");
+		}
+	}
+
+	Result.EncodeMs = (FPlatformTime::Seconds() - StartSec) * 1000.0;
+	return Result;
+}
+
+void DispatchEncodeJobs();
+
+void RunEncodeJob(FNovaBridgeEncodeJob&& Job)
+{
+	FNovaBridgeEncodeResult Result = EncodePixels(
+		NovaBridgeImageWrapperModule, Job.Format, Job.Pixels, Job.Width, Job.Height, Job.Quality, Job.QueuedTimeSec);
+
+	{
+		FScopeLock Lock(&NovaBridgeEncodeMutex);
+		if (Result.bSuccess)
+		{
+			NovaBridgeEncodeCounters.Completed++;
+		}
+		else
+		{
+			NovaBridgeEncodeCounters.Failed++;
+		}
+		NovaBridgeEncodeCounters.TotalEncodeMs += Result.EncodeMs;
+	}
+
+	if (Job.OnEncoded)
+	{
+		if (Job.CallbackThread == ENovaBridgeEncodeCallbackThread::Worker)
+		{
+			Job.OnEncoded(MoveTemp(Result));
+		}
+		else
+		{
+			AsyncTask(ENamedThreads::GameThread, [OnEncoded = MoveTemp(Job.OnEncoded), Result = MoveTemp(Result)]() mutable
+			{
+				OnEncoded(MoveTemp(Result));
+			});
+		}
+	}
+
+	// Release the worker slot last so shutdown also waits for worker-thread callbacks.
+	{
+		FScopeLock Lock(&NovaBridgeEncodeMutex);
+		NovaBridgeEncodeActiveTotal--;
+		NovaBridgeEncodeActiveByFormat[FormatIndex(Job.Format)]--;
+	}
+	DispatchEncodeJobs();
+}
+
+// Pops the oldest job whose format still has headroom, so a burst of one format cannot starve the other.
+void DispatchEncodeJobs()
+{
+	TArray<FNovaBridgeEncodeJob> JobsToRun;
+	{
+		FScopeLock Lock(&NovaBridgeEncodeMutex);
+		for (int32 JobIndex = 0; JobIndex < NovaBridgeEncodeQueue.Num() && NovaBridgeEncodeActiveTotal < NovaBridgeEncodeMaxWorkers;)
+		{
+			const ENovaBridgeEncodeFormat Format = NovaBridgeEncodeQueue[JobIndex].Format;
+			if (NovaBridgeEncodeActiveByFormat[FormatIndex(Format)] >= FormatConcurrencyLimit(Format))
+			{
+				++JobIndex;
+				continue;
+			}
+
+			NovaBridgeEncodeActiveTotal++;
+			NovaBridgeEncodeActiveByFormat[FormatIndex(Format)]++;
+			JobsToRun.Add(MoveTemp(NovaBridgeEncodeQueue[JobIndex]));
+			NovaBridgeEncodeQueue.RemoveAt(JobIndex);
+		}
+	}
+
+	for (FNovaBridgeEncodeJob& Job : JobsToRun)
+	{
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Job = MoveTemp(Job)]() mutable
+		{
+			RunEncodeJob(MoveTemp(Job));
+		});
+	}
+}
+} // namespace
+
+void StartImageEncodeService()
+{
+	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+
+	FScopeLock Lock(&NovaBridgeEncodeMutex);
+	NovaBridgeImageWrapperModule = &ImageWrapperModule;
+	bNovaBridgeEncodeAccepting = true;
+	NovaBridgeEncodeCounters = FNovaBridgeEncodeStats();
+}
+
+void StopImageEncodeService()
+{
+	{
+		FScopeLock Lock(&NovaBridgeEncodeMutex);
+		bNovaBridgeEncodeAccepting = false;
+		NovaBridgeEncodeCounters.Rejected += NovaBridgeEncodeQueue.Num();
+		NovaBridgeEncodeQueue.Reset();
+	}
+
+	// Workers still reference the image wrapper module; let them finish before unloading.
+	for (;;)
+	{
+		{
+			FScopeLock Lock(&NovaBridgeEncodeMutex);
+			if (NovaBridgeEncodeActiveTotal == 0)
+			{
+				NovaBridgeImageWrapperModule = nullptr;
+				break;
+			}
+		}
+		FPlatformProcess::Sleep(0.001f);
+	}
+}
+
+bool QueueImageEncode(
+	ENovaBridgeEncodeFormat Format,
+	TArray<FColor>&& Pixels,
+	int32 Width,
+	int32 Height,
+	int32 Quality,
+	ENovaBridgeEncodeCallbackThread CallbackThread,
+	FNovaBridgeEncodeCallback&& OnEncoded)
+{
+	{
+		FScopeLock Lock(&NovaBridgeEncodeMutex);
+		if (!bNovaBridgeEncodeAccepting || NovaBridgeEncodeQueue.Num() >= NovaBridgeEncodeQueueLimit)
+		{
+			NovaBridgeEncodeCounters.Rejected++;
+			return false;
+		}
+
+		FNovaBridgeEncodeJob& Job = NovaBridgeEncodeQueue.AddDefaulted_GetRef();
+		Job.Format = Format;
+		Job.CallbackThread = CallbackThread;
+		Job.Pixels = MoveTemp(Pixels);
+		Job.Width = Width;
+		Job.Height = Height;
+		Job.Quality = Quality;
+		Job.QueuedTimeSec = FPlatformTime::Seconds();
+		Job.OnEncoded = MoveTemp(OnEncoded);
+		NovaBridgeEncodeCounters.Queued++;
+		NovaBridgeEncodeCounters.PeakQueueDepth = FMath::Max(NovaBridgeEncodeCounters.PeakQueueDepth, NovaBridgeEncodeQueue.Num());
+	}
+
+	DispatchEncodeJobs();
+	return true;
+}
+
+FNovaBridgeEncodeStats GetImageEncodeStats()
+{
+	FScopeLock Lock(&NovaBridgeEncodeMutex);
+	FNovaBridgeEncodeStats Stats = NovaBridgeEncodeCounters;
+	Stats.QueueDepth = NovaBridgeEncodeQueue.Num();
+	Stats.ActivePng = NovaBridgeEncodeActiveByFormat[0];
+	Stats.ActiveJpeg = NovaBridgeEncodeActiveByFormat[1];
+	Stats.MaxWorkers = NovaBridgeEncodeMaxWorkers;
+	Stats.MaxPng = NovaBridgeEncodeMaxPng;
+	Stats.MaxJpeg = NovaBridgeEncodeMaxJpeg;
+	Stats.QueueLimit = NovaBridgeEncodeQueueLimit;
+	return Stats;
+}
@@ -1,4 +1,5 @@
 #include "NovaBridgeModule.h"
+#include "NovaBridgeEditorInternals.h"
 
 #include "Async/Async.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -21,7 +22,7 @@ bool FNovaBridgeModule::HandleMaterialCreate(const FHttpServerRequest& Request,
 	const FString Name = Body->GetStringField(TEXT("name"));
 	const FString Path = Body->HasField(TEXT("path")) ? Body->GetStringField(TEXT("path")) : TEXT("/Game");
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Body, Name, Path]()
+	DispatchGameThreadTask([this, OnComplete, Body, Name, Path]()
 	{
 		const FString PackagePath = Path / Name;
 		UPackage* Package = CreatePackage(*PackagePath);
@@ -77,7 +78,7 @@ bool FNovaBridgeModule::HandleMaterialSetParam(const FHttpServerRequest& Request
 	const FString ParamName = Body->GetStringField(TEXT("param"));
 	const FString ParamType = Body->HasField(TEXT("type")) ? Body->GetStringField(TEXT("type")) : TEXT("scalar");
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Body, MaterialPath, ParamName, ParamType]()
+	DispatchGameThreadTask([this, OnComplete, Body, MaterialPath, ParamName, ParamType]()
 	{
 		UMaterialInstanceConstant* MatInst = LoadObject<UMaterialInstanceConstant>(nullptr, *MaterialPath);
 		if (!MatInst)
@@ -132,7 +133,7 @@ bool FNovaBridgeModule::HandleMaterialGet(const FHttpServerRequest& Request, con
 		return true;
 	}
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, MaterialPath]()
+	DispatchGameThreadTask([this, OnComplete, MaterialPath]()
 	{
 		UMaterialInterface* Material = LoadObject<UMaterialInterface>(nullptr, *MaterialPath);
 		if (!Material)
@@ -201,7 +202,7 @@ bool FNovaBridgeModule::HandleMaterialCreateInstance(const FHttpServerRequest& R
 	const FString Name = Body->GetStringField(TEXT("name"));
 	const FString Path = Body->HasField(TEXT("path")) ? Body->GetStringField(TEXT("path")) : TEXT("/Game");
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, ParentPath, Name, Path]()
+	DispatchGameThreadTask([this, OnComplete, ParentPath, Name, Path]()
 	{
 		UMaterialInterface* Parent = LoadObject<UMaterialInterface>(nullptr, *ParentPath);
 		if (!Parent)
@@ -1,4 +1,7 @@
 #include "NovaBridgeModule.h"
+#include "NovaBridgeEditorInternals.h"
+#include "NovaBridgeHttpUtils.h"
+#include "NovaBridgeMeshBuffers.h"
 
 #include "Async/Async.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -14,94 +17,139 @@
 // Mesh Handlers
 // ============================================================
 
-bool FNovaBridgeModule::HandleMeshCreate(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+namespace
 {
-	TSharedPtr<FJsonObject> Body = ParseRequestBody(Request);
-	if (!Body)
+bool IsBinaryMeshRequest(const FHttpServerRequest& Request)
+{
+	return NovaBridgeCore::GetHeaderValueCaseInsensitive(Request, TEXT("Content-Type")).StartsWith(TEXT("application/octet-stream"));
+}
+} // namespace
+
+TSharedRef<FMeshDescription> BuildMeshDescriptionFromBuffers(const NovaBridgeCore::FMeshBuffers& Mesh)
+{
+	TSharedRef<FMeshDescription> MeshDesc = MakeShared<FMeshDescription>();
+	FStaticMeshAttributes Attributes(*MeshDesc);
+	Attributes.Register();
+
+	FMeshDescriptionBuilder Builder;
+	Builder.SetMeshDescription(&MeshDesc.Get());
+	Builder.EnablePolyGroups();
+	Builder.SetNumUVLayers(1);
+	MeshDesc->ReserveNewVertices(Mesh.NumVertices());
+	MeshDesc->ReserveNewVertexInstances(Mesh.NumVertices());
+	MeshDesc->ReserveNewTriangles(Mesh.NumTriangles());
+
+	// Create polygon group
+	FPolygonGroupID PolyGroup = Builder.AppendPolygonGroup();
+
+	// Add vertices
+	TArray<FVertexInstanceID> VertexInstances;
+	VertexInstances.Reserve(Mesh.NumVertices());
+	for (int32 Index = 0; Index < Mesh.NumVertices(); ++Index)
 	{
-		SendErrorResponse(OnComplete, TEXT("Invalid JSON body"));
-		return true;
+		FVertexID VertID = Builder.AppendVertex(FVector(Mesh.Positions[Index]));
+		FVertexInstanceID InstanceID = Builder.AppendInstance(VertID);
+		if (Mesh.UVs.Num() > 0)
+		{
+			Builder.SetInstanceUV(InstanceID, FVector2D(Mesh.UVs[Index]), 0);
+		}
+		if (Mesh.Normals.Num() > 0)
+		{
+			Builder.SetInstanceNormal(InstanceID, FVector(Mesh.Normals[Index]));
+		}
+		VertexInstances.Add(InstanceID);
 	}
 
-	FString Name = Body->GetStringField(TEXT("name"));
-	FString Path = Body->HasField(TEXT("path")) ? Body->GetStringField(TEXT("path")) : TEXT("/Game");
-	TArray<TSharedPtr<FJsonValue>> Vertices = Body->GetArrayField(TEXT("vertices"));
-	TArray<TSharedPtr<FJsonValue>> Triangles = Body->GetArrayField(TEXT("triangles"));
-
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Name, Path, Vertices, Triangles]()
+	// Add triangles; indices were range-checked by ValidateMeshBuffers.
+	for (int32 Tri = 0; Tri < Mesh.NumTriangles(); ++Tri)
 	{
-		FString PackagePath = Path / Name;
-		UPackage* Package = CreatePackage(*PackagePath);
-		UStaticMesh* StaticMesh = NewObject<UStaticMesh>(Package, FName(*Name), RF_Public | RF_Standalone);
-
-		StaticMesh->GetStaticMaterials().Add(FStaticMaterial());
-
-		FMeshDescription MeshDesc;
-		FStaticMeshAttributes Attributes(MeshDesc);
-		Attributes.Register();
-
-		FMeshDescriptionBuilder Builder;
-		Builder.SetMeshDescription(&MeshDesc);
-		Builder.EnablePolyGroups();
-		Builder.SetNumUVLayers(1);
+		Builder.AppendTriangle(
+			VertexInstances[Mesh.Indices[Tri * 3]],
+			VertexInstances[Mesh.Indices[Tri * 3 + 1]],
+			VertexInstances[Mesh.Indices[Tri * 3 + 2]],
+			PolyGroup);
+	}
+	return MeshDesc;
+}
 
-		// Create polygon group
-		FPolygonGroupID PolyGroup = Builder.AppendPolygonGroup();
+bool FNovaBridgeModule::HandleMeshCreate(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	// Binary bodies carry name/path in the query string; JSON bodies carry them alongside the mesh data.
+	const bool bBinary = IsBinaryMeshRequest(Request);
+	TSharedRef<FHttpServerRequest> RequestCopy = MakeShared<FHttpServerRequest>(Request);
 
-		// Add vertices
-		TArray<FVertexInstanceID> VertexInstances;
-		for (const TSharedPtr<FJsonValue>& VertVal : Vertices)
+	// Decoding, validation and mesh description building stay off the game thread; only asset creation needs it.
+	DispatchBackgroundTask([this, OnComplete, bBinary, RequestCopy]()
+	{
+		FString Name;
+		FString Path = TEXT("/Game");
+		FString Error;
+		NovaBridgeCore::FMeshBuffers Mesh;
+		bool bParsed = false;
+		if (bBinary)
 		{
-			TSharedPtr<FJsonObject> V = VertVal->AsObject();
-			FVector Position(V->GetNumberField(TEXT("x")), V->GetNumberField(TEXT("y")), V->GetNumberField(TEXT("z")));
-
-			FVertexID VertID = Builder.AppendVertex(Position);
-			FVertexInstanceID InstanceID = Builder.AppendInstance(VertID);
-
-			// Set UV if provided
-			if (V->HasField(TEXT("u")))
+			if (const FString* QueryName = RequestCopy->QueryParams.Find(TEXT("name")))
 			{
-				Builder.SetInstanceUV(InstanceID, FVector2D(V->GetNumberField(TEXT("u")), V->GetNumberField(TEXT("v"))), 0);
+				Name = *QueryName;
 			}
-
-			// Set normal if provided
-			if (V->HasField(TEXT("nx")))
+			if (const FString* QueryPath = RequestCopy->QueryParams.Find(TEXT("path")))
 			{
-				Builder.SetInstanceNormal(InstanceID, FVector(V->GetNumberField(TEXT("nx")), V->GetNumberField(TEXT("ny")), V->GetNumberField(TEXT("nz"))));
+				Path = *QueryPath;
 			}
-
-			VertexInstances.Add(InstanceID);
+			bParsed = NovaBridgeCore::ParseMeshBinary(RequestCopy->Body.GetData(), RequestCopy->Body.Num(), Mesh, Error);
 		}
-
-		// Add triangles
-		for (const TSharedPtr<FJsonValue>& TriVal : Triangles)
+		else if (TSharedPtr<FJsonObject> Body = ParseRequestBody(*RequestCopy))
+		{
+			Body->TryGetStringField(TEXT("name"), Name);
+			Body->TryGetStringField(TEXT("path"), Path);
+			bParsed = NovaBridgeCore::ParseMeshJson(*Body, Mesh, Error);
+		}
+		else
 		{
-			TSharedPtr<FJsonObject> T = TriVal->AsObject();
-			int32 I0 = (int32)T->GetNumberField(TEXT("i0"));
-			int32 I1 = (int32)T->GetNumberField(TEXT("i1"));
-			int32 I2 = (int32)T->GetNumberField(TEXT("i2"));
-
-			TArray<FVertexInstanceID> TriVerts;
-			TriVerts.Add(VertexInstances[I0]);
-			TriVerts.Add(VertexInstances[I1]);
-			TriVerts.Add(VertexInstances[I2]);
-			Builder.AppendTriangle(TriVerts[0], TriVerts[1], TriVerts[2], PolyGroup);
+			Error = TEXT("Invalid JSON body");
 		}
 
-		// Build mesh
-		TArray<const FMeshDescription*> MeshDescriptions;
-		MeshDescriptions.Add(&MeshDesc);
-		StaticMesh->BuildFromMeshDescriptions(MeshDescriptions);
+		if (bParsed && Name.IsEmpty())
+		{
+			Error = TEXT("Missing 'name' parameter");
+			bParsed = false;
+		}
+		if (!bParsed || !NovaBridgeCore::ValidateMeshBuffers(Mesh, Error))
+		{
+			DispatchGameThreadTask([this, OnComplete, Error]()
+			{
+				SendErrorResponse(OnComplete, Error);
+			});
+			return;
+		}
 
-		FAssetRegistryModule::AssetCreated(StaticMesh);
-		StaticMesh->MarkPackageDirty();
+		const int32 NumVertices = Mesh.NumVertices();
+		const int32 NumTriangles = Mesh.NumTriangles();
+		TSharedRef<FMeshDescription> MeshDesc = BuildMeshDescriptionFromBuffers(Mesh);
 
-		TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
-		Result->SetStringField(TEXT("status"), TEXT("ok"));
-		Result->SetStringField(TEXT("path"), StaticMesh->GetPathName());
-		Result->SetNumberField(TEXT("vertices"), Vertices.Num());
-		Result->SetNumberField(TEXT("triangles"), Triangles.Num());
-		SendJsonResponse(OnComplete, Result);
+		DispatchGameThreadTask([this, OnComplete, Name, Path, MeshDesc, NumVertices, NumTriangles]()
+		{
+			FString PackagePath = Path / Name;
+			UPackage* Package = CreatePackage(*PackagePath);
+			UStaticMesh* StaticMesh = NewObject<UStaticMesh>(Package, FName(*Name), RF_Public | RF_Standalone);
+
+			StaticMesh->GetStaticMaterials().Add(FStaticMaterial());
+
+			// Build mesh
+			TArray<const FMeshDescription*> MeshDescriptions;
+			MeshDescriptions.Add(&MeshDesc.Get());
+			StaticMesh->BuildFromMeshDescriptions(MeshDescriptions);
+
+			FAssetRegistryModule::AssetCreated(StaticMesh);
+			StaticMesh->MarkPackageDirty();
+
+			TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+			Result->SetStringField(TEXT("status"), TEXT("ok"));
+			Result->SetStringField(TEXT("path"), StaticMesh->GetPathName());
+			Result->SetNumberField(TEXT("vertices"), NumVertices);
+			Result->SetNumberField(TEXT("triangles"), NumTriangles);
+			SendJsonResponse(OnComplete, Result);
+		});
 	});
 	return true;
 }
@@ -125,7 +173,7 @@ bool FNovaBridgeModule::HandleMeshGet(const FHttpServerRequest& Request, const F
 		return true;
 	}
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, MeshPath]()
+	DispatchGameThreadTask([this, OnComplete, MeshPath]()
 	{
 		UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
 		if (!Mesh)
@@ -168,7 +216,7 @@ bool FNovaBridgeModule::HandleMeshPrimitive(const FHttpServerRequest& Request, c
 	FString Path = Body->HasField(TEXT("path")) ? Body->GetStringField(TEXT("path")) : TEXT("/Game");
 	double Size = Body->HasField(TEXT("size")) ? Body->GetNumberField(TEXT("size")) : 100.0;
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Type, Name, Path, Size]()
+	DispatchGameThreadTask([this, OnComplete, Type, Name, Path, Size]()
 	{
 		// Generate primitive vertices and triangles
 		TArray<FVector> Verts;
@@ -1,4 +1,5 @@
 #include "NovaBridgeModule.h"
+#include "NovaBridgeEditorInternals.h"
 
 #if NOVABRIDGE_WITH_WEBSOCKET_NETWORKING
 #include "IWebSocketServer.h"
@@ -9,6 +10,11 @@ DEFINE_LOG_CATEGORY(LogNovaBridge);
 void FNovaBridgeModule::StartupModule()
 {
 	UE_LOG(LogNovaBridge, Log, TEXT("NovaBridge starting up..."));
+	StartActorIndexService();
+	StartAssetRevisionService();
+	StartPropertyPathCacheService();
+	StartCaptureReadbackService();
+	StartImageEncodeService();
 	StartHttpServer();
 	StartWebSocketServer();
 	StartEventWebSocketServer();
@@ -22,6 +28,11 @@ void FNovaBridgeModule::ShutdownModule()
 	CleanupStreamCapture();
 	CleanupCapture();
 	StopHttpServer();
+	StopCaptureReadbackService();
+	StopImageEncodeService();
+	StopActorIndexService();
+	StopAssetRevisionService();
+	StopPropertyPathCacheService();
 }
 
 IMPLEMENT_MODULE(FNovaBridgeModule, NovaBridge)
@@ -28,7 +28,7 @@ bool FNovaBridgeModule::HandleOptimizeNanite(const FHttpServerRequest& Request,
 	const FString ActorName = Body->HasField(TEXT("actor_name")) ? Body->GetStringField(TEXT("actor_name")) : FString();
 	const bool bEnable = !Body->HasField(TEXT("enable")) || Body->GetBoolField(TEXT("enable"));
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, MeshPath, ActorName, bEnable]()
+	DispatchGameThreadTask([this, OnComplete, MeshPath, ActorName, bEnable]()
 	{
 		UStaticMesh* Mesh = nullptr;
 		FString ResolvedPath = MeshPath;
@@ -83,7 +83,7 @@ bool FNovaBridgeModule::HandleOptimizeLod(const FHttpServerRequest& Request, con
 	const FString MeshPath = Body->HasField(TEXT("mesh_path")) ? Body->GetStringField(TEXT("mesh_path")) : FString();
 	const int32 NumLods = Body->HasField(TEXT("num_lods")) ? FMath::Clamp(static_cast<int32>(Body->GetNumberField(TEXT("num_lods"))), 2, 8) : 4;
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, MeshPath, NumLods]()
+	DispatchGameThreadTask([this, OnComplete, MeshPath, NumLods]()
 	{
 		UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
 		if (!Mesh)
@@ -119,7 +119,7 @@ bool FNovaBridgeModule::HandleOptimizeLumen(const FHttpServerRequest& Request, c
 	const bool bEnabled = !Body->HasField(TEXT("enabled")) || Body->GetBoolField(TEXT("enabled"));
 	const FString Quality = Body->HasField(TEXT("quality")) ? Body->GetStringField(TEXT("quality")).ToLower() : TEXT("high");
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, bEnabled, Quality]()
+	DispatchGameThreadTask([this, OnComplete, bEnabled, Quality]()
 	{
 		UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
 		if (!GEditor || !World)
@@ -164,7 +164,7 @@ bool FNovaBridgeModule::HandleOptimizeLumen(const FHttpServerRequest& Request, c
 bool FNovaBridgeModule::HandleOptimizeStats(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
 	(void)Request;
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete]()
+	DispatchGameThreadTask([this, OnComplete]()
 	{
 		UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
 		if (!World)
@@ -245,7 +245,7 @@ bool FNovaBridgeModule::HandleOptimizeTextures(const FHttpServerRequest& Request
 	const int32 MaxSize = Body->HasField(TEXT("max_size")) ? FMath::Clamp(static_cast<int32>(Body->GetNumberField(TEXT("max_size"))), 256, 8192) : 2048;
 	const FString Compression = Body->HasField(TEXT("compression")) ? Body->GetStringField(TEXT("compression")).ToLower() : TEXT("default");
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, RootPath, MaxSize, Compression]()
+	DispatchGameThreadTask([this, OnComplete, RootPath, MaxSize, Compression]()
 	{
 		FAssetRegistryModule& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 		TArray<FAssetData> Assets;
@@ -309,7 +309,7 @@ bool FNovaBridgeModule::HandleOptimizeCollision(const FHttpServerRequest& Reques
 	const FString ActorName = Body->HasField(TEXT("actor_name")) ? Body->GetStringField(TEXT("actor_name")) : FString();
 	const FString Type = Body->HasField(TEXT("type")) ? Body->GetStringField(TEXT("type")).ToLower() : TEXT("complex");
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, MeshPath, ActorName, Type]()
+	DispatchGameThreadTask([this, OnComplete, MeshPath, ActorName, Type]()
 	{
 		UStaticMesh* Mesh = nullptr;
 		FString ResolvedPath = MeshPath;
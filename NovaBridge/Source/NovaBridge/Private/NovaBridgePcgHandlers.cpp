@@ -20,7 +20,7 @@ bool FNovaBridgeModule::HandlePcgListGraphs(const FHttpServerRequest& Request, c
 {
 	(void)Request;
 #if NOVABRIDGE_WITH_PCG
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete]()
+	DispatchGameThreadTask([this, OnComplete]()
 	{
 		FAssetRegistryModule& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 		TArray<FAssetData> Assets;
@@ -65,7 +65,7 @@ bool FNovaBridgeModule::HandlePcgCreateVolume(const FHttpServerRequest& Request,
 	const double SizeY = Body->HasField(TEXT("size_y")) ? Body->GetNumberField(TEXT("size_y")) : 5000.0;
 	const double SizeZ = Body->HasField(TEXT("size_z")) ? Body->GetNumberField(TEXT("size_z")) : 1000.0;
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, GraphPath, Label, X, Y, Z, SizeX, SizeY, SizeZ]()
+	DispatchGameThreadTask([this, OnComplete, GraphPath, Label, X, Y, Z, SizeX, SizeY, SizeZ]()
 	{
 		UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
 		if (!World)
@@ -129,7 +129,7 @@ bool FNovaBridgeModule::HandlePcgGenerate(const FHttpServerRequest& Request, con
 	const bool bForce = !Body->HasField(TEXT("force_regenerate")) || Body->GetBoolField(TEXT("force_regenerate"));
 	const int32 Seed = Body->HasField(TEXT("seed")) ? static_cast<int32>(Body->GetNumberField(TEXT("seed"))) : INT32_MIN;
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, ActorName, bForce, Seed]()
+	DispatchGameThreadTask([this, OnComplete, ActorName, bForce, Seed]()
 	{
 		AActor* Actor = FindActorByName(ActorName);
 		if (!Actor)
@@ -186,7 +186,7 @@ bool FNovaBridgeModule::HandlePcgSetParam(const FHttpServerRequest& Request, con
 	const FString ParamName = Body->GetStringField(TEXT("param_name"));
 	const FString ParamType = Body->HasField(TEXT("param_type")) ? Body->GetStringField(TEXT("param_type")).ToLower() : TEXT("");
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, ActorName, ParamName, ParamType, Body]()
+	DispatchGameThreadTask([this, OnComplete, ActorName, ParamName, ParamType, Body]()
 	{
 		AActor* Actor = FindActorByName(ActorName);
 		if (!Actor)
@@ -250,7 +250,7 @@ bool FNovaBridgeModule::HandlePcgCleanup(const FHttpServerRequest& Request, cons
 
 #if NOVABRIDGE_WITH_PCG
 	const FString ActorName = Body->GetStringField(TEXT("actor_name"));
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, ActorName]()
+	DispatchGameThreadTask([this, OnComplete, ActorName]()
 	{
 		AActor* Actor = FindActorByName(ActorName);
 		if (!Actor)
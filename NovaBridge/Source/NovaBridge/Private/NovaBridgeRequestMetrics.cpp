@@ -0,0 +1,219 @@
+#include "NovaBridgeEditorInternals.h"
+
+#include "NovaBridgeMetrics.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformTime.h"
+#include "HttpServerResponse.h"
+
+namespace
+{
+thread_local TSharedPtr<FNovaBridgeRequestTiming> NovaBridgeCurrentTiming;
+thread_local double NovaBridgeCurrentScopeStartSec = 0.0;
+
+NovaBridgeCore::FTaskLaneQueue NovaBridgeGameThreadLanes;
+FTSTicker::FDelegateHandle NovaBridgeLaneTickerHandle;
+std::atomic<bool> bNovaBridgeLanesRunning { false };
+
+uint64 SecondsToMicros(double Seconds)
+{
+	return static_cast<uint64>(FMath::Max(0.0, Seconds) * 1000000.0);
+}
+
+// Wraps a game-thread task with the request's scope and deadline check. EnqueueSec <= 0 skips the queue-wait
+// sample, for continuations whose request already paid its wait.
+TUniqueFunction<void()> MakeLaneTask(const TSharedPtr<FNovaBridgeRequestTiming>& Timing, double EnqueueSec, TUniqueFunction<void()>&& Task)
+{
+	return [Timing, EnqueueSec, Task = MoveTemp(Task)]() mutable
+	{
+		if (EnqueueSec > 0.0 && Timing.IsValid() && Timing->Route)
+		{
+			Timing->Route->QueueWaitUs.Record(SecondsToMicros(FPlatformTime::Seconds() - EnqueueSec));
+		}
+		FNovaBridgeRequestScope Scope(Timing);
+		if (Timing.IsValid() && Timing->Cancellation.IsValid() && Timing->Cancellation->IsCancelled()
+			&& Timing->ExpiredResponder && !Timing->bResponded.load())
+		{
+			// The client has given up; answer it and skip the work rather than run it late.
+			if (Timing->Route)
+			{
+				Timing->Route->DroppedExpired.fetch_add(1, std::memory_order_relaxed);
+			}
+			const TFunction<void()> Responder = MoveTemp(Timing->ExpiredResponder);
+			Timing->ExpiredResponder = TFunction<void()>();
+			Responder();
+			return;
+		}
+		Task();
+	};
+}
+} // namespace
+
+FNovaBridgeRequestScope::FNovaBridgeRequestScope(const TSharedPtr<FNovaBridgeRequestTiming>& InTiming)
+	: Timing(InTiming)
+	, PreviousTiming(NovaBridgeCurrentTiming)
+	, PreviousStartSec(NovaBridgeCurrentScopeStartSec)
+	, StartSec(FPlatformTime::Seconds())
+{
+	NovaBridgeCurrentTiming = Timing;
+	NovaBridgeCurrentScopeStartSec = StartSec;
+}
+
+FNovaBridgeRequestScope::~FNovaBridgeRequestScope()
+{
+	if (Timing.IsValid() && !Timing->bResponded.load())
+	{
+		Timing->HandlerUs.fetch_add(SecondsToMicros(FPlatformTime::Seconds() - StartSec));
+	}
+	NovaBridgeCurrentTiming = PreviousTiming;
+	NovaBridgeCurrentScopeStartSec = PreviousStartSec;
+}
+
+void DispatchGameThreadTask(TUniqueFunction<void()>&& Task)
+{
+	TSharedPtr<FNovaBridgeRequestTiming> Timing = NovaBridgeCurrentTiming;
+	if (Timing.IsValid() && Timing->bInlineGameThreadDispatch && IsInGameThread())
+	{
+		// The caller's scope is already open; there is no queue to wait in.
+		Task();
+		return;
+	}
+	TUniqueFunction<void()> TimedTask = MakeLaneTask(Timing, FPlatformTime::Seconds(), MoveTemp(Task));
+	if (bNovaBridgeLanesRunning.load())
+	{
+		NovaBridgeGameThreadLanes.Enqueue(Timing.IsValid() ? Timing->Lane : NovaBridgeCore::ETaskLane::Mutating, MoveTemp(TimedTask));
+	}
+	else
+	{
+		AsyncTask(ENamedThreads::GameThread, MoveTemp(TimedTask));
+	}
+}
+
+void StartGameThreadLanes(double MutatingBudgetMs, double HeavyBudgetMs)
+{
+	StopGameThreadLanes();
+	NovaBridgeGameThreadLanes.SetBudgetMs(NovaBridgeCore::ETaskLane::Interactive, 0.0);
+	NovaBridgeGameThreadLanes.SetBudgetMs(NovaBridgeCore::ETaskLane::Mutating, MutatingBudgetMs);
+	NovaBridgeGameThreadLanes.SetBudgetMs(NovaBridgeCore::ETaskLane::Heavy, HeavyBudgetMs);
+	NovaBridgeLaneTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float DeltaTime)
+	{
+		(void)DeltaTime;
+		NovaBridgeGameThreadLanes.Drain([]() { return FPlatformTime::Seconds(); });
+		return true;
+	}));
+	bNovaBridgeLanesRunning.store(true);
+}
+
+void StopGameThreadLanes()
+{
+	if (!bNovaBridgeLanesRunning.exchange(false))
+	{
+		return;
+	}
+	FTSTicker::GetCoreTicker().RemoveTicker(NovaBridgeLaneTickerHandle);
+	NovaBridgeLaneTickerHandle.Reset();
+	// Queued requests still get their answer; new tasks go straight to the game thread from here on.
+	while (NovaBridgeGameThreadLanes.Drain([]() { return FPlatformTime::Seconds(); }) > 0)
+	{
+	}
+}
+
+NovaBridgeCore::FTaskLaneStats GetGameThreadLaneStats(NovaBridgeCore::ETaskLane Lane)
+{
+	return NovaBridgeGameThreadLanes.GetStats(Lane);
+}
+
+void ResetGameThreadLaneStats()
+{
+	NovaBridgeGameThreadLanes.ResetStats();
+}
+
+void DispatchGameThreadTaskNextTick(TUniqueFunction<void()>&& Task)
+{
+	// Continuations of long-running work; the request already paid its queue wait, so only handler time counts.
+	TSharedPtr<FNovaBridgeRequestTiming> Timing = NovaBridgeCurrentTiming;
+	TUniqueFunction<void()> TimedTask = MakeLaneTask(Timing, 0.0, MoveTemp(Task));
+	if (bNovaBridgeLanesRunning.load())
+	{
+		// Same lane and budget as the request's first task, held back until the next frame's drain.
+		NovaBridgeGameThreadLanes.EnqueueNextDrain(Timing.IsValid() ? Timing->Lane : NovaBridgeCore::ETaskLane::Mutating, MoveTemp(TimedTask));
+		return;
+	}
+
+	TSharedRef<TUniqueFunction<void()>> SharedTask = MakeShared<TUniqueFunction<void()>>(MoveTemp(TimedTask));
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([SharedTask](float DeltaTime)
+	{
+		(void)DeltaTime;
+		(*SharedTask)();
+		return false;
+	}));
+}
+
+void DispatchBackgroundTask(TUniqueFunction<void()>&& Task)
+{
+	// Worker time counts as handler time, and game-thread tasks dispatched from the worker keep the request's timing.
+	TSharedPtr<FNovaBridgeRequestTiming> Timing = NovaBridgeCurrentTiming;
+	Async(EAsyncExecution::ThreadPool, [Timing, Task = MoveTemp(Task)]() mutable
+	{
+		FNovaBridgeRequestScope Scope(Timing);
+		Task();
+	});
+}
+
+FHttpResultCallback WrapResultCallbackWithMetrics(const TSharedRef<FNovaBridgeRequestTiming>& Timing, const FHttpResultCallback& OnComplete)
+{
+	return [Timing, OnComplete](TUniquePtr<FHttpServerResponse>&& Response)
+	{
+		bool bExpected = false;
+		if (Response && Timing->Route && Timing->bResponded.compare_exchange_strong(bExpected, true))
+		{
+			// Count the open scope on this thread too; the response usually goes out mid-task.
+			uint64 HandlerUs = Timing->HandlerUs.load();
+			if (NovaBridgeCurrentTiming.Get() == &Timing.Get())
+			{
+				HandlerUs += SecondsToMicros(FPlatformTime::Seconds() - NovaBridgeCurrentScopeStartSec);
+			}
+
+			NovaBridgeCore::FRouteMetrics& Route = *Timing->Route;
+			Route.HandlerUs.Record(HandlerUs);
+			Route.SerializeUs.Record(Timing->SerializeUs.load());
+			Route.ResponseBytes.Record(static_cast<uint64>(Response->Body.Num()));
+			Route.RecordStatus(static_cast<int32>(Response->Code));
+		}
+		OnComplete(MoveTemp(Response));
+	};
+}
+
+void RecordResponseSerializeTime(double SerializeSec)
+{
+	if (NovaBridgeCurrentTiming.IsValid())
+	{
+		NovaBridgeCurrentTiming->SerializeUs.fetch_add(SecondsToMicros(SerializeSec));
+	}
+}
+
+NovaBridgeCore::FResponseProfile GetCurrentResponseProfile()
+{
+	return NovaBridgeCurrentTiming.IsValid() ? NovaBridgeCurrentTiming->Profile : NovaBridgeCore::FResponseProfile();
+}
+
+NovaBridgeCore::FCancellationTokenPtr GetCurrentCancellationToken()
+{
+	return NovaBridgeCurrentTiming.IsValid() ? NovaBridgeCurrentTiming->Cancellation : NovaBridgeCore::FCancellationTokenPtr();
+}
+
+void ClaimDeadlineResponse()
+{
+	if (NovaBridgeCurrentTiming.IsValid())
+	{
+		NovaBridgeCurrentTiming->ExpiredResponder = TFunction<void()>();
+	}
+}
+
+void RecordRequestCancelled()
+{
+	if (NovaBridgeCurrentTiming.IsValid() && NovaBridgeCurrentTiming->Route)
+	{
+		NovaBridgeCurrentTiming->Route->Cancelled.fetch_add(1, std::memory_order_relaxed);
+	}
+}
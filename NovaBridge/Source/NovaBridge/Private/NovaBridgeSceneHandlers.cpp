@@ -1,5 +1,12 @@
 #include "NovaBridgeModule.h"
 #include "NovaBridgeEditorInternals.h"
+#include "NovaBridgeHttpUtils.h"
+#include "NovaBridgePropertyPath.h"
+#include "NovaBridgeSceneChangeLog.h"
+#include "NovaBridgeSceneList.h"
+#include "NovaBridgeSceneQuery.h"
+#include "NovaBridgeSceneSnapshot.h"
+#include "NovaBridgeTransformBatch.h"
 
 #include "Async/Async.h"
 #include "Components/ActorComponent.h"
@@ -8,13 +15,36 @@
 #include "Engine/World.h"
 #include "EngineUtils.h"
 #include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
 #include "Subsystems/EditorActorSubsystem.h"
 #include "UObject/UnrealType.h"
 
+namespace
+{
+// The game-thread phase of a listing: one tight copy loop, no JSON.
+TSharedRef<TArray<NovaBridgeCore::FActorSnapshot>> SnapshotScenePage(const TArray<TPair<NovaBridgeCore::FSceneListKey, AActor*>>& Page, NovaBridgeCore::ESceneField Fields)
+{
+	TSharedRef<TArray<NovaBridgeCore::FActorSnapshot>> Snapshots = MakeShared<TArray<NovaBridgeCore::FActorSnapshot>>();
+	Snapshots->SetNum(Page.Num());
+	for (int32 Index = 0; Index < Page.Num(); ++Index)
+	{
+		SnapshotActor(Page[Index].Value, Fields, (*Snapshots)[Index]);
+	}
+	return Snapshots;
+}
+} // namespace
+
 bool FNovaBridgeModule::HandleSceneList(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
-	(void)Request;
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete]()
+	NovaBridgeCore::FSceneListQuery Query;
+	FString QueryError;
+	if (!NovaBridgeCore::ParseSceneListQuery(Request.QueryParams, NovaBridgeCore::SceneListDefaultLimit, Query, QueryError))
+	{
+		SendErrorResponse(OnComplete, QueryError);
+		return true;
+	}
+
+	DispatchGameThreadTask([this, OnComplete, Query]()
 	{
 		if (!GEditor)
 		{
@@ -29,21 +59,221 @@ bool FNovaBridgeModule::HandleSceneList(const FHttpServerRequest& Request, const
 			return;
 		}
 
-		TArray<TSharedPtr<FJsonValue>> ActorArray;
+		// Taken before the scan so a client that pages through and then polls scene/changes misses nothing.
+		const uint64 Revision = GetSceneRevision(World);
+
+		// Filter and order on cheap keys; only the selected page is serialized.
+		NovaBridgeCore::TScenePageCollector<AActor*> Collector(Query);
+		TMap<const UClass*, bool> ClassMatches;
 		for (TActorIterator<AActor> It(World); It; ++It)
 		{
-			ActorArray.Add(MakeShared<FJsonValueObject>(ActorToJson(*It)));
+			AActor* Actor = *It;
+			if ((!Query.ClassName.IsNone() && !ActorMatchesClassName(Actor, Query.ClassName, &ClassMatches))
+				|| (!Query.Tag.IsNone() && !Actor->ActorHasTag(Query.Tag)))
+			{
+				continue;
+			}
+			Collector.Offer(NovaBridgeCore::FSceneListKey { Actor->GetFName(), Actor->GetUniqueID() }, Actor);
 		}
 
+		bool bHasMore = false;
+		const TArray<TPair<NovaBridgeCore::FSceneListKey, AActor*>> Page = Collector.Finish(bHasMore);
+		TSharedRef<TArray<NovaBridgeCore::FActorSnapshot>> Snapshots = SnapshotScenePage(Page, Query.Fields);
+
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetNumberField(TEXT("count"), Page.Num());
+		Result->SetNumberField(TEXT("total"), Collector.GetMatched());
+		if (bHasMore)
+		{
+			Result->SetStringField(TEXT("next_cursor"), NovaBridgeCore::MakeSceneListCursor(Page.Last().Key));
+		}
+		Result->SetStringField(TEXT("level"), World->GetMapName());
+		Result->SetNumberField(TEXT("revision"), static_cast<double>(Revision));
+		SendEncodedJsonResponse(OnComplete, Result, TEXT("actors"), [Snapshots, Fields = Query.Fields](const NovaBridgeCore::FResponseProfile& Profile)
+		{
+			return NovaBridgeCore::EncodeActorSnapshotsJson(*Snapshots, Fields, Profile);
+		});
+	});
+	return true;
+}
+
+bool FNovaBridgeModule::HandleSceneChanges(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	const FString* SinceParam = Request.QueryParams.Find(TEXT("since"));
+	if (!SinceParam || !SinceParam->IsNumeric() || SinceParam->StartsWith(TEXT("-")))
+	{
+		SendErrorResponse(OnComplete, TEXT("'since' must be a revision from scene/list or scene/changes"));
+		return true;
+	}
+	const uint64 Since = FCString::Strtoui64(**SinceParam, nullptr, 10);
+
+	NovaBridgeCore::ESceneField Fields = NovaBridgeCore::ESceneField::Default;
+	FString FieldsError;
+	if (const FString* FieldsParam = Request.QueryParams.Find(TEXT("fields")))
+	{
+		if (!NovaBridgeCore::ParseSceneFields(*FieldsParam, Fields, FieldsError))
+		{
+			SendErrorResponse(OnComplete, FieldsError);
+			return true;
+		}
+	}
+
+	DispatchGameThreadTask([this, OnComplete, Since, Fields]()
+	{
+		UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+		if (!World)
+		{
+			SendErrorResponse(OnComplete, TEXT("No world"), 500);
+			return;
+		}
+
+		TArray<NovaBridgeCore::TSceneChange<TWeakObjectPtr<AActor>>> Changes;
+		const bool bReplayed = CollectSceneChanges(World, Since, Changes);
 		TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-		Result->SetArrayField(TEXT("actors"), ActorArray);
-		Result->SetNumberField(TEXT("count"), ActorArray.Num());
+		Result->SetStringField(TEXT("status"), TEXT("ok"));
+		Result->SetNumberField(TEXT("revision"), static_cast<double>(GetSceneRevision(World)));
 		Result->SetStringField(TEXT("level"), World->GetMapName());
+		Result->SetBoolField(TEXT("resync_required"), !bReplayed);
+		if (!bReplayed)
+		{
+			// The log rolled over, the world changed or undo ran: the caller must re-list the scene.
+			SendJsonResponse(OnComplete, Result);
+			return;
+		}
+
+		TArray<TSharedPtr<FJsonValue>> ChangeArray;
+		ChangeArray.Reserve(Changes.Num());
+		for (const NovaBridgeCore::TSceneChange<TWeakObjectPtr<AActor>>& Change : Changes)
+		{
+			AActor* Actor = Change.Handle.Get();
+			const NovaBridgeCore::ESceneChangeKind Kind = IsValid(Actor) ? Change.Kind : NovaBridgeCore::ESceneChangeKind::Removed;
+			TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+			Entry->SetStringField(TEXT("change"), NovaBridgeCore::SceneChangeKindName(Kind));
+			Entry->SetStringField(TEXT("name"), Change.Name.ToString());
+			Entry->SetNumberField(TEXT("revision"), static_cast<double>(Change.Revision));
+			if (Kind != NovaBridgeCore::ESceneChangeKind::Removed)
+			{
+				Entry->SetObjectField(TEXT("actor"), ActorToJson(Actor, Fields));
+			}
+			ChangeArray.Add(MakeShared<FJsonValueObject>(Entry));
+		}
+		Result->SetNumberField(TEXT("since"), static_cast<double>(Since));
+		Result->SetNumberField(TEXT("count"), ChangeArray.Num());
+		Result->SetArrayField(TEXT("changes"), ChangeArray);
 		SendJsonResponse(OnComplete, Result);
 	});
 	return true;
 }
 
+bool FNovaBridgeModule::HandleSceneQuery(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	TSharedPtr<FJsonObject> Body = ParseRequestBody(Request);
+	if (!Body)
+	{
+		SendErrorResponse(OnComplete, TEXT("Invalid JSON body"));
+		return true;
+	}
+
+	NovaBridgeCore::FSceneQueryShape Shape;
+	FString Error;
+	if (!NovaBridgeCore::ParseSceneQueryShape(*Body, Shape, Error))
+	{
+		SendErrorResponse(OnComplete, Error);
+		return true;
+	}
+
+	// Reuse the scene/list paging and projection rules; the shape replaces the cursor.
+	NovaBridgeCore::FSceneListQuery Query;
+	Query.Limit = NovaBridgeCore::SceneListDefaultLimit;
+	int32 Limit = 0;
+	if (Body->TryGetNumberField(TEXT("limit"), Limit))
+	{
+		if (Limit < 1)
+		{
+			SendErrorResponse(OnComplete, TEXT("'limit' must be a positive integer"));
+			return true;
+		}
+		Query.Limit = FMath::Min(Limit, NovaBridgeCore::SceneListMaxLimit);
+	}
+	FString FieldsCsv;
+	if (Body->TryGetStringField(TEXT("fields"), FieldsCsv) && !NovaBridgeCore::ParseSceneFields(FieldsCsv, Query.Fields, Error))
+	{
+		SendErrorResponse(OnComplete, Error);
+		return true;
+	}
+	FString TagName;
+	if (Body->TryGetStringField(TEXT("tag"), TagName) && !TagName.IsEmpty())
+	{
+		Query.Tag = FName(*TagName);
+	}
+
+	TArray<FName> ClassNames;
+	FString ClassName;
+	if (Body->TryGetStringField(TEXT("class"), ClassName))
+	{
+		ClassNames.AddUnique(NovaBridgeCore::NormalizeSceneClassName(ClassName));
+	}
+	const TArray<TSharedPtr<FJsonValue>>* Classes = nullptr;
+	if (Body->TryGetArrayField(TEXT("classes"), Classes))
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *Classes)
+		{
+			FString Entry;
+			if (Value.IsValid() && Value->TryGetString(Entry))
+			{
+				ClassNames.AddUnique(NovaBridgeCore::NormalizeSceneClassName(Entry));
+			}
+		}
+	}
+	ClassNames.Remove(NAME_None);
+
+	DispatchGameThreadTask([this, OnComplete, Shape, Query, ClassNames]()
+	{
+		UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+		if (!World)
+		{
+			SendErrorResponse(OnComplete, TEXT("No world"), 500);
+			return;
+		}
+
+		TArray<AActor*> Hits;
+		QueryIndexedActors(World, Shape, Hits);
+
+		NovaBridgeCore::TScenePageCollector<AActor*> Collector(Query);
+		TMap<const UClass*, bool> ClassMatches;
+		for (AActor* Actor : Hits)
+		{
+			bool bClassMatches = ClassNames.Num() == 0;
+			for (int32 Index = 0; Index < ClassNames.Num() && !bClassMatches; ++Index)
+			{
+				// The memo is keyed by actor class alone, so it only applies to single-class queries.
+				bClassMatches = ActorMatchesClassName(Actor, ClassNames[Index], ClassNames.Num() == 1 ? &ClassMatches : nullptr);
+			}
+			if (!bClassMatches || (!Query.Tag.IsNone() && !Actor->ActorHasTag(Query.Tag)))
+			{
+				continue;
+			}
+			Collector.Offer(NovaBridgeCore::FSceneListKey { Actor->GetFName(), Actor->GetUniqueID() }, Actor);
+		}
+
+		bool bTruncated = false;
+		const TArray<TPair<NovaBridgeCore::FSceneListKey, AActor*>> Page = Collector.Finish(bTruncated);
+		TSharedRef<TArray<NovaBridgeCore::FActorSnapshot>> Snapshots = SnapshotScenePage(Page, Query.Fields);
+
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetStringField(TEXT("status"), TEXT("ok"));
+		Result->SetNumberField(TEXT("count"), Page.Num());
+		Result->SetNumberField(TEXT("total"), Collector.GetMatched());
+		Result->SetBoolField(TEXT("truncated"), bTruncated);
+		Result->SetNumberField(TEXT("revision"), static_cast<double>(GetSceneRevision(World)));
+		SendEncodedJsonResponse(OnComplete, Result, TEXT("actors"), [Snapshots, Fields = Query.Fields](const NovaBridgeCore::FResponseProfile& Profile)
+		{
+			return NovaBridgeCore::EncodeActorSnapshotsJson(*Snapshots, Fields, Profile);
+		});
+	});
+	return true;
+}
+
 bool FNovaBridgeModule::HandleSceneTransform(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
 	TSharedPtr<FJsonObject> Body = ParseRequestBody(Request);
@@ -58,7 +288,7 @@ bool FNovaBridgeModule::HandleSceneTransform(const FHttpServerRequest& Request,
 	TSharedPtr<FJsonObject> RotObj = Body->HasField(TEXT("rotation")) ? Body->GetObjectField(TEXT("rotation")) : nullptr;
 	TSharedPtr<FJsonObject> ScaleObj = Body->HasField(TEXT("scale")) ? Body->GetObjectField(TEXT("scale")) : nullptr;
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, ActorName, LocObj, RotObj, ScaleObj]()
+	DispatchGameThreadTask([this, OnComplete, ActorName, LocObj, RotObj, ScaleObj]()
 	{
 		AActor* Actor = FindActorByName(ActorName);
 		if (!Actor)
@@ -82,12 +312,118 @@ bool FNovaBridgeModule::HandleSceneTransform(const FHttpServerRequest& Request,
 			const FVector Scale(ScaleObj->GetNumberField(TEXT("x")), ScaleObj->GetNumberField(TEXT("y")), ScaleObj->GetNumberField(TEXT("z")));
 			Actor->SetActorScale3D(Scale);
 		}
+		NoteSceneActorModified(Actor);
 
 		SendJsonResponse(OnComplete, ActorToJson(Actor));
 	});
 	return true;
 }
 
+bool FNovaBridgeModule::HandleSceneTransformBatch(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	const bool bBinary = NovaBridgeCore::GetHeaderValueCaseInsensitive(Request, TEXT("Content-Type")).StartsWith(TEXT("application/octet-stream"));
+	TSharedRef<FHttpServerRequest> RequestCopy = MakeShared<FHttpServerRequest>(Request);
+
+	// Decoding stays off the game thread; the game thread only resolves actors and writes transforms.
+	DispatchBackgroundTask([this, OnComplete, bBinary, RequestCopy]()
+	{
+		TSharedRef<TArray<NovaBridgeCore::FTransformUpdate>> Updates = MakeShared<TArray<NovaBridgeCore::FTransformUpdate>>();
+		FString Error;
+		bool bParsed = false;
+		if (bBinary)
+		{
+			bParsed = NovaBridgeCore::ParseTransformBatchBinary(RequestCopy->Body.GetData(), RequestCopy->Body.Num(), *Updates, Error);
+		}
+		else if (TSharedPtr<FJsonObject> Body = ParseRequestBody(*RequestCopy))
+		{
+			bParsed = NovaBridgeCore::ParseTransformBatchJson(*Body, *Updates, Error);
+		}
+		else
+		{
+			Error = TEXT("Invalid JSON body");
+		}
+
+		if (!bParsed)
+		{
+			DispatchGameThreadTask([this, OnComplete, Error]()
+			{
+				SendErrorResponse(OnComplete, Error);
+			});
+			return;
+		}
+
+		DispatchGameThreadTask([this, OnComplete, Updates]()
+		{
+			if (!GEditor)
+			{
+				SendErrorResponse(OnComplete, TEXT("Editor not available"), 500);
+				return;
+			}
+
+			// One SetActorTransform per actor instead of a call per component, and no per-actor editor
+			// notifications: change log, spatial index and viewports are updated once the pass is done.
+			const double ApplyStart = FPlatformTime::Seconds();
+			TArray<AActor*> Moved;
+			Moved.Reserve(Updates->Num());
+			TArray<TSharedPtr<FJsonValue>> Missing;
+			for (const NovaBridgeCore::FTransformUpdate& Update : *Updates)
+			{
+				AActor* Actor = FindActorByName(Update.Name);
+				if (!Actor || !Actor->GetRootComponent())
+				{
+					if (Missing.Num() < 100)
+					{
+						Missing.Add(MakeShared<FJsonValueString>(Update.Name));
+					}
+					continue;
+				}
+
+				FTransform Transform = Actor->GetActorTransform();
+				if (EnumHasAnyFlags(Update.Fields, NovaBridgeCore::ETransformField::Location))
+				{
+					Transform.SetLocation(Update.Location);
+				}
+				if (EnumHasAnyFlags(Update.Fields, NovaBridgeCore::ETransformField::Rotation))
+				{
+					Transform.SetRotation(Update.Rotation.Quaternion());
+				}
+				if (EnumHasAnyFlags(Update.Fields, NovaBridgeCore::ETransformField::Scale))
+				{
+					Transform.SetScale3D(Update.Scale);
+				}
+				Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+				Moved.Add(Actor);
+			}
+			const double ApplySec = FPlatformTime::Seconds() - ApplyStart;
+
+			for (AActor* Actor : Moved)
+			{
+				NoteSceneActorModified(Actor);
+			}
+			if (Moved.Num() > 0)
+			{
+				GEditor->RedrawLevelEditingViewports();
+			}
+
+			const int32 NotFound = Updates->Num() - Moved.Num();
+			TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+			Result->SetStringField(TEXT("status"), NotFound == 0 ? TEXT("ok") : TEXT("partial"));
+			Result->SetNumberField(TEXT("requested"), Updates->Num());
+			Result->SetNumberField(TEXT("applied"), Moved.Num());
+			Result->SetNumberField(TEXT("not_found_count"), NotFound);
+			Result->SetArrayField(TEXT("not_found"), Missing);
+			Result->SetNumberField(TEXT("apply_ms"), ApplySec * 1000.0);
+			Result->SetNumberField(TEXT("updates_per_sec"), Moved.Num() / FMath::Max(ApplySec, 1e-9));
+			if (UWorld* World = GEditor->GetEditorWorldContext().World())
+			{
+				Result->SetNumberField(TEXT("revision"), static_cast<double>(GetSceneRevision(World)));
+			}
+			SendJsonResponse(OnComplete, Result);
+		});
+	});
+	return true;
+}
+
 bool FNovaBridgeModule::HandleSceneGet(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
 	FString ActorName;
@@ -110,7 +446,7 @@ bool FNovaBridgeModule::HandleSceneGet(const FHttpServerRequest& Request, const
 		return true;
 	}
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, ActorName]()
+	DispatchGameThreadTask([this, OnComplete, ActorName]()
 	{
 		AActor* Actor = FindActorByName(ActorName);
 		if (!Actor)
@@ -122,18 +458,9 @@ bool FNovaBridgeModule::HandleSceneGet(const FHttpServerRequest& Request, const
 		TSharedPtr<FJsonObject> Result = ActorToJson(Actor);
 
 		TSharedPtr<FJsonObject> Props = MakeShared<FJsonObject>();
-		for (TFieldIterator<FProperty> PropIt(Actor->GetClass()); PropIt; ++PropIt)
+		for (const FNovaBridgePropertyDescriptor& Descriptor : GetClassDescriptor(Actor->GetClass())->Properties)
 		{
-			FProperty* Prop = *PropIt;
-			if (!Prop->HasAnyPropertyFlags(CPF_Edit | CPF_BlueprintVisible))
-			{
-				continue;
-			}
-
-			FString ValueStr;
-			void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(Actor);
-			Prop->ExportTextItem_Direct(ValueStr, ValuePtr, nullptr, Actor, PPF_None);
-			Props->SetStringField(Prop->GetName(), ValueStr);
+			Props->SetStringField(Descriptor.Name.ToString(), ExportPropertyText(Descriptor, Actor));
 		}
 		Result->SetObjectField(TEXT("properties"), Props);
 
@@ -146,20 +473,17 @@ bool FNovaBridgeModule::HandleSceneGet(const FHttpServerRequest& Request, const
 
 			TSharedPtr<FJsonObject> CompProps = MakeShared<FJsonObject>();
 			int32 PropCount = 0;
-			for (TFieldIterator<FProperty> PropIt(Comp->GetClass()); PropIt; ++PropIt)
+			for (const FNovaBridgePropertyDescriptor& Descriptor : GetClassDescriptor(Comp->GetClass())->Properties)
 			{
-				FProperty* Prop = *PropIt;
-				if (!Prop->HasAnyPropertyFlags(CPF_Edit | CPF_BlueprintVisible) || PropCount >= 30)
+				if (PropCount >= 30)
 				{
-					continue;
+					break;
 				}
 
-				FString ValueStr;
-				void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(Comp);
-				Prop->ExportTextItem_Direct(ValueStr, ValuePtr, nullptr, Comp, PPF_None);
+				FString ValueStr = ExportPropertyText(Descriptor, Comp);
 				if (ValueStr.Len() < 200)
 				{
-					CompProps->SetStringField(Prop->GetName(), ValueStr);
+					CompProps->SetStringField(Descriptor.Name.ToString(), ValueStr);
 					PropCount++;
 				}
 			}
@@ -174,6 +498,199 @@ bool FNovaBridgeModule::HandleSceneGet(const FHttpServerRequest& Request, const
 	return true;
 }
 
+namespace
+{
+// One requested path resolved against an actor class. Component columns are re-found on each actor by
+// name and read only if the component still has the class the plan was built from.
+struct FGetManyColumn
+{
+	FName ComponentName;
+	const UClass* ComponentClass = nullptr;
+	const FNovaBridgePropertyDescriptor* Property = nullptr;
+};
+
+// Same selection rules as SetActorPropertyValue: a "Component.Property" path reads the component when
+// the selector matches one, otherwise the whole path names an actor property.
+void PlanGetManyColumns(AActor* Actor, const TArray<FString>& Paths, TArray<FGetManyColumn>& OutColumns)
+{
+	const TSharedRef<const FNovaBridgeClassDescriptor> ActorDescriptor = GetClassDescriptor(Actor->GetClass());
+	TInlineComponentArray<UActorComponent*> Components;
+	TArray<NovaBridgeCore::FComponentIdentity, TInlineAllocator<16>> Identities;
+	bool bGathered = false;
+
+	OutColumns.Reset(Paths.Num());
+	for (const FString& Path : Paths)
+	{
+		FGetManyColumn& Column = OutColumns.AddDefaulted_GetRef();
+		FString CompName;
+		FString PropName;
+		if (Path.Split(TEXT("."), &CompName, &PropName))
+		{
+			if (!bGathered)
+			{
+				Actor->GetComponents(Components);
+				for (UActorComponent* Comp : Components)
+				{
+					Identities.Add(NovaBridgeCore::FComponentIdentity { Comp->GetName(), Comp->GetClass()->GetName() });
+				}
+				bGathered = true;
+			}
+
+			const int32 Found = NovaBridgeCore::FindComponentForSelector(CompName, Identities);
+			if (Found != INDEX_NONE)
+			{
+				UActorComponent* Comp = Components[Found];
+				Column.ComponentName = Comp->GetFName();
+				Column.ComponentClass = Comp->GetClass();
+				Column.Property = GetClassDescriptor(Comp->GetClass())->Find(FName(*PropName, FNAME_Find));
+				continue;
+			}
+		}
+		Column.Property = ActorDescriptor->Find(FName(*Path, FNAME_Find));
+	}
+}
+} // namespace
+
+bool FNovaBridgeModule::HandleSceneGetMany(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	TSharedPtr<FJsonObject> Body = ParseRequestBody(Request);
+	if (!Body)
+	{
+		SendErrorResponse(OnComplete, TEXT("Invalid JSON body"));
+		return true;
+	}
+
+	NovaBridgeCore::FSceneGetManyRequest GetMany;
+	FString Error;
+	if (!NovaBridgeCore::ParseSceneGetManyRequest(*Body, GetMany, Error))
+	{
+		SendErrorResponse(OnComplete, Error);
+		return true;
+	}
+
+	DispatchGameThreadTask([this, OnComplete, GetMany]()
+	{
+		UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+		if (!World)
+		{
+			SendErrorResponse(OnComplete, TEXT("No world"), 500);
+			return;
+		}
+
+		const uint64 Revision = GetSceneRevision(World);
+		TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+		TArray<AActor*> Actors;
+		if (GetMany.Names.Num() > 0)
+		{
+			TSet<AActor*> Seen;
+			TArray<TSharedPtr<FJsonValue>> NotFound;
+			for (const FString& Name : GetMany.Names)
+			{
+				AActor* Actor = FindActorByName(Name);
+				if (!Actor)
+				{
+					NotFound.Add(MakeShared<FJsonValueString>(Name));
+				}
+				else if (!Seen.Contains(Actor))
+				{
+					Seen.Add(Actor);
+					Actors.Add(Actor);
+				}
+			}
+			Result->SetArrayField(TEXT("not_found"), NotFound);
+		}
+		else
+		{
+			const NovaBridgeCore::FSceneListQuery& Query = GetMany.Query;
+			NovaBridgeCore::TScenePageCollector<AActor*> Collector(Query);
+			TMap<const UClass*, bool> ClassMatches;
+			for (TActorIterator<AActor> It(World); It; ++It)
+			{
+				AActor* Actor = *It;
+				if ((!Query.ClassName.IsNone() && !ActorMatchesClassName(Actor, Query.ClassName, &ClassMatches))
+					|| (!Query.Tag.IsNone() && !Actor->ActorHasTag(Query.Tag)))
+				{
+					continue;
+				}
+				Collector.Offer(NovaBridgeCore::FSceneListKey { Actor->GetFName(), Actor->GetUniqueID() }, Actor);
+			}
+
+			bool bHasMore = false;
+			const TArray<TPair<NovaBridgeCore::FSceneListKey, AActor*>> Page = Collector.Finish(bHasMore);
+			Actors.Reserve(Page.Num());
+			for (const TPair<NovaBridgeCore::FSceneListKey, AActor*>& Entry : Page)
+			{
+				Actors.Add(Entry.Value);
+			}
+			Result->SetNumberField(TEXT("total"), Collector.GetMatched());
+			if (bHasMore)
+			{
+				Result->SetStringField(TEXT("next_cursor"), NovaBridgeCore::MakeSceneListCursor(Page.Last().Key));
+			}
+		}
+
+		// Columns are planned once per actor class; every actor of that class reuses them.
+		TMap<const UClass*, TArray<FGetManyColumn>> Plans;
+		TBitArray<> Resolved(false, GetMany.Properties.Num());
+		TArray<TSharedPtr<FJsonValue>> ActorArray;
+		ActorArray.Reserve(Actors.Num());
+		for (AActor* Actor : Actors)
+		{
+			TArray<FGetManyColumn>* Columns = Plans.Find(Actor->GetClass());
+			if (!Columns)
+			{
+				Columns = &Plans.Add(Actor->GetClass());
+				PlanGetManyColumns(Actor, GetMany.Properties, *Columns);
+			}
+
+			TSharedPtr<FJsonObject> Values = MakeShared<FJsonObject>();
+			for (int32 Index = 0; Index < Columns->Num(); ++Index)
+			{
+				const FGetManyColumn& Column = (*Columns)[Index];
+				UObject* Container = Actor;
+				if (!Column.ComponentName.IsNone())
+				{
+					UActorComponent* Comp = FindObjectFast<UActorComponent>(Actor, Column.ComponentName);
+					Container = Comp && Comp->GetClass() == Column.ComponentClass ? Comp : nullptr;
+				}
+				if (Container && Column.Property)
+				{
+					Values->SetField(GetMany.Properties[Index], ExportPropertyJson(*Column.Property, Container));
+					Resolved[Index] = true;
+				}
+				else
+				{
+					Values->SetField(GetMany.Properties[Index], MakeShared<FJsonValueNull>());
+				}
+			}
+
+			TSharedPtr<FJsonObject> Entry = ActorToJson(Actor, GetMany.Query.Fields);
+			Entry->SetObjectField(TEXT("values"), Values);
+			ActorArray.Add(MakeShared<FJsonValueObject>(Entry));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> Unresolved;
+		if (Actors.Num() > 0)
+		{
+			for (int32 Index = 0; Index < GetMany.Properties.Num(); ++Index)
+			{
+				if (!Resolved[Index])
+				{
+					Unresolved.Add(MakeShared<FJsonValueString>(GetMany.Properties[Index]));
+				}
+			}
+		}
+
+		Result->SetStringField(TEXT("status"), TEXT("ok"));
+		Result->SetArrayField(TEXT("actors"), ActorArray);
+		Result->SetNumberField(TEXT("count"), ActorArray.Num());
+		Result->SetArrayField(TEXT("unresolved"), Unresolved);
+		Result->SetNumberField(TEXT("revision"), static_cast<double>(Revision));
+		SendJsonResponse(OnComplete, Result);
+	});
+	return true;
+}
+
 bool FNovaBridgeModule::HandleSceneSpawn(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
 	TSharedPtr<FJsonObject> Body = ParseRequestBody(Request);
@@ -212,7 +729,7 @@ bool FNovaBridgeModule::HandleSceneSpawn(const FHttpServerRequest& Request, cons
 		return true;
 	}
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, ClassName, X, Y, Z, Pitch, Yaw, Roll, Label, Role]()
+	DispatchGameThreadTask([this, OnComplete, ClassName, X, Y, Z, Pitch, Yaw, Roll, Label, Role]()
 	{
 		if (!GEditor)
 		{
@@ -290,7 +807,7 @@ bool FNovaBridgeModule::HandleSceneDelete(const FHttpServerRequest& Request, con
 	FString ActorName = Body->GetStringField(TEXT("name"));
 	const FString Role = ResolveRoleFromRequest(Request);
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, ActorName, Role]()
+	DispatchGameThreadTask([this, OnComplete, ActorName, Role]()
 	{
 		AActor* Actor = FindActorByName(ActorName);
 		if (!Actor)
@@ -350,7 +867,7 @@ bool FNovaBridgeModule::HandleSceneSetProperty(const FHttpServerRequest& Request
 	FString Value = Body->GetStringField(TEXT("value"));
 	const FString Role = ResolveRoleFromRequest(Request);
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, ActorName, PropertyName, Value, Role]()
+	DispatchGameThreadTask([this, OnComplete, ActorName, PropertyName, Value, Role]()
 	{
 		AActor* Actor = FindActorByName(ActorName);
 		if (!Actor)
@@ -73,7 +73,7 @@ bool FNovaBridgeModule::HandleSequencerCreate(const FHttpServerRequest& Request,
 		return true;
 	}
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Name, Path, DurationSeconds, Fps]()
+	DispatchGameThreadTask([this, OnComplete, Name, Path, DurationSeconds, Fps]()
 	{
 		const FString PackagePath = Path / Name;
 		UPackage* Package = CreatePackage(*PackagePath);
@@ -130,7 +130,7 @@ bool FNovaBridgeModule::HandleSequencerAddTrack(const FHttpServerRequest& Reques
 	const FString ActorName = Body->GetStringField(TEXT("actor_name"));
 	const FString TrackType = Body->HasField(TEXT("track_type")) ? Body->GetStringField(TEXT("track_type")).ToLower() : TEXT("transform");
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, SequencePath, ActorName, TrackType]()
+	DispatchGameThreadTask([this, OnComplete, SequencePath, ActorName, TrackType]()
 	{
 		UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
 		if (!World)
@@ -210,7 +210,7 @@ bool FNovaBridgeModule::HandleSequencerSetKeyframe(const FHttpServerRequest& Req
 	const float TimeSeconds = Body->HasField(TEXT("time")) ? static_cast<float>(Body->GetNumberField(TEXT("time"))) : 0.0f;
 	const FString TrackType = Body->HasField(TEXT("track_type")) ? Body->GetStringField(TEXT("track_type")).ToLower() : TEXT("transform");
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, SequencePath, ActorName, TimeSeconds, TrackType, Body]()
+	DispatchGameThreadTask([this, OnComplete, SequencePath, ActorName, TimeSeconds, TrackType, Body]()
 	{
 		UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
 		if (!World)
@@ -348,7 +348,7 @@ bool FNovaBridgeModule::HandleSequencerPlay(const FHttpServerRequest& Request, c
 	const bool bLoop = Body->HasField(TEXT("loop")) && Body->GetBoolField(TEXT("loop"));
 	const float StartTime = Body->HasField(TEXT("start_time")) ? static_cast<float>(Body->GetNumberField(TEXT("start_time"))) : 0.0f;
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, SequencePath, bLoop, StartTime]()
+	DispatchGameThreadTask([this, OnComplete, SequencePath, bLoop, StartTime]()
 	{
 		UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
 		if (!World)
@@ -403,7 +403,7 @@ bool FNovaBridgeModule::HandleSequencerStop(const FHttpServerRequest& Request, c
 	TSharedPtr<FJsonObject> Body = ParseRequestBody(Request);
 	const FString SequencePath = (Body && Body->HasField(TEXT("sequence"))) ? Body->GetStringField(TEXT("sequence")) : FString();
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, SequencePath]()
+	DispatchGameThreadTask([this, OnComplete, SequencePath]()
 	{
 		int32 Stopped = 0;
 		if (!SequencePath.IsEmpty())
@@ -449,7 +449,7 @@ bool FNovaBridgeModule::HandleSequencerScrub(const FHttpServerRequest& Request,
 	const FString SequencePath = Body->GetStringField(TEXT("sequence"));
 	const float TimeSeconds = Body->HasField(TEXT("time")) ? static_cast<float>(Body->GetNumberField(TEXT("time"))) : 0.0f;
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, SequencePath, TimeSeconds]()
+	DispatchGameThreadTask([this, OnComplete, SequencePath, TimeSeconds]()
 	{
 		UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
 		if (!World)
@@ -499,7 +499,7 @@ bool FNovaBridgeModule::HandleSequencerScrub(const FHttpServerRequest& Request,
 bool FNovaBridgeModule::HandleSequencerInfo(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
 	(void)Request;
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete]()
+	DispatchGameThreadTask([this, OnComplete]()
 	{
 		TArray<TSharedPtr<FJsonValue>> Active;
 		for (const TPair<FString, TWeakObjectPtr<ULevelSequencePlayer>>& Pair : SequencePlayers)
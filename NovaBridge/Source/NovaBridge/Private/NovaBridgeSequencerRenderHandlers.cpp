@@ -8,14 +8,12 @@
 #include "Engine/TextureRenderTarget2D.h"
 #include "Engine/World.h"
 #include "HAL/FileManager.h"
-#include "IImageWrapper.h"
-#include "IImageWrapperModule.h"
 #include "LevelSequence.h"
 #include "LevelSequenceActor.h"
 #include "LevelSequencePlayer.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
-#include "Modules/ModuleManager.h"
+#include "Misc/ScopeLock.h"
 #include "TextureResource.h"
 
 bool FNovaBridgeModule::HandleSequencerRender(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
@@ -34,7 +32,7 @@ bool FNovaBridgeModule::HandleSequencerRender(const FHttpServerRequest& Request,
 	const int32 Fps = Body->HasField(TEXT("fps")) ? FMath::Clamp(static_cast<int32>(Body->GetNumberField(TEXT("fps"))), 1, 60) : 24;
 	const float Duration = Body->HasField(TEXT("duration_seconds")) ? static_cast<float>(Body->GetNumberField(TEXT("duration_seconds"))) : 5.0f;
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, SequencePath, OutputPath, Fps, Duration]()
+	DispatchGameThreadTask([this, OnComplete, SequencePath, OutputPath, Fps, Duration]()
 	{
 		UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
 		if (!World)
@@ -69,9 +67,79 @@ bool FNovaBridgeModule::HandleSequencerRender(const FHttpServerRequest& Request,
 			return;
 		}
 
-		TArray<TSharedPtr<FJsonValue>> Frames;
+		// PNG encode and file writes run on the encode pool; the response goes out once every frame has landed.
+		struct FSequencerRenderState
+		{
+			FCriticalSection Mutex;
+			TArray<FString> FramePaths;
+			int32 PendingFrames = 0;
+			bool bCaptureDone = false;
+			bool bResponded = false;
+			// Set when the request's deadline passed mid-render; the frames captured so far are still reported.
+			bool bCancelled = false;
+			// Set when the encode queue was full; capture stops and the request is answered 503.
+			bool bEncoderBusy = false;
+			int32 RequestedFrames = 0;
+		};
+		TSharedRef<FSequencerRenderState> RenderState = MakeShared<FSequencerRenderState>();
+		RenderState->FramePaths.SetNum(FrameCount);
+		RenderState->RequestedFrames = FrameCount;
+
+		auto SendRenderResponse = [this, OnComplete, SequencePath, OutputPath, Fps, RenderState]()
+		{
+			TArray<TSharedPtr<FJsonValue>> Frames;
+			for (const FString& FramePath : RenderState->FramePaths)
+			{
+				if (!FramePath.IsEmpty())
+				{
+					Frames.Add(MakeShared<FJsonValueString>(FramePath));
+				}
+			}
+
+			TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+			const TCHAR* Status = RenderState->bEncoderBusy ? TEXT("overloaded") : (RenderState->bCancelled ? TEXT("cancelled") : TEXT("ok"));
+			Result->SetStringField(TEXT("status"), Status);
+			Result->SetStringField(TEXT("sequence"), SequencePath);
+			Result->SetStringField(TEXT("output_path"), OutputPath);
+			Result->SetStringField(TEXT("format"), TEXT("png-sequence"));
+			Result->SetNumberField(TEXT("fps"), Fps);
+			Result->SetNumberField(TEXT("frame_count"), Frames.Num());
+			Result->SetArrayField(TEXT("frames"), Frames);
+			if (RenderState->bCancelled || RenderState->bEncoderBusy)
+			{
+				Result->SetNumberField(TEXT("requested_frame_count"), RenderState->RequestedFrames);
+			}
+			Result->SetStringField(TEXT("note"), RenderState->bEncoderBusy
+				? TEXT("Image encoder busy; render stopped early. Retry shortly.")
+				: TEXT("Rendered as PNG sequence. Use ffmpeg externally for MP4 encoding."));
+			SendJsonResponse(OnComplete, Result, RenderState->bEncoderBusy ? 503 : (RenderState->bCancelled ? 504 : 200));
+		};
+
+		auto TryFinishRender = [RenderState, SendRenderResponse]()
+		{
+			{
+				FScopeLock Lock(&RenderState->Mutex);
+				if (!RenderState->bCaptureDone || RenderState->PendingFrames > 0 || RenderState->bResponded)
+				{
+					return;
+				}
+				RenderState->bResponded = true;
+			}
+			AsyncTask(ENamedThreads::GameThread, SendRenderResponse);
+		};
+
+		const NovaBridgeCore::FCancellationTokenPtr Cancellation = GetCurrentCancellationToken();
 		for (int32 FrameIdx = 0; FrameIdx < FrameCount; ++FrameIdx)
 		{
+			if (Cancellation.IsValid() && Cancellation->IsCancelled())
+			{
+				// Nobody is waiting for the rest; stop capturing and report what has landed.
+				RecordRequestCancelled();
+				FScopeLock Lock(&RenderState->Mutex);
+				RenderState->bCancelled = true;
+				break;
+			}
+
 			const float TimeSeconds = static_cast<float>(FrameIdx) / static_cast<float>(Fps);
 			NovaBridgeSetPlaybackTime(Player, TimeSeconds, false);
 
@@ -93,30 +161,56 @@ bool FNovaBridgeModule::HandleSequencerRender(const FHttpServerRequest& Request,
 				continue;
 			}
 
-			IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
-			TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
-			ImageWrapper->SetRaw(Bitmap.GetData(), Bitmap.Num() * sizeof(FColor), CaptureWidth, CaptureHeight, ERGBFormat::BGRA, 8);
-			TArray64<uint8> PngData = ImageWrapper->GetCompressed(0);
-
 			const FString FramePath = OutputPath / FString::Printf(TEXT("frame_%05d.png"), FrameIdx);
-			TArray<uint8> PngData32;
-			PngData32.Append(PngData.GetData(), static_cast<int32>(PngData.Num()));
-			if (FFileHelper::SaveArrayToFile(PngData32, *FramePath))
+			auto WriteFrame = [RenderState, FramePath, FrameIdx](const TArray64<uint8>& PngData)
 			{
-				Frames.Add(MakeShared<FJsonValueString>(FramePath));
+				TArray<uint8> PngData32;
+				PngData32.Append(PngData.GetData(), static_cast<int32>(PngData.Num()));
+				if (PngData32.Num() > 0 && FFileHelper::SaveArrayToFile(PngData32, *FramePath))
+				{
+					FScopeLock Lock(&RenderState->Mutex);
+					RenderState->FramePaths[FrameIdx] = FramePath;
+				}
+			};
+
+			{
+				FScopeLock Lock(&RenderState->Mutex);
+				RenderState->PendingFrames++;
+			}
+			const bool bQueued = QueueImageEncode(
+				ENovaBridgeEncodeFormat::Png,
+				MoveTemp(Bitmap),
+				CaptureWidth,
+				CaptureHeight,
+				0,
+				ENovaBridgeEncodeCallbackThread::Worker,
+				[RenderState, WriteFrame, TryFinishRender](FNovaBridgeEncodeResult&& Encoded)
+				{
+					if (Encoded.bSuccess)
+					{
+						WriteFrame(Encoded.Bytes);
+					}
+					{
+						FScopeLock Lock(&RenderState->Mutex);
+						RenderState->PendingFrames--;
+					}
+					TryFinishRender();
+				});
+			if (!bQueued)
+			{
+				// Pool is saturated: stop rather than encode on the game thread; frames already queued still land.
+				FScopeLock Lock(&RenderState->Mutex);
+				RenderState->PendingFrames--;
+				RenderState->bEncoderBusy = true;
+				break;
 			}
 		}
 
-		TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-		Result->SetStringField(TEXT("status"), TEXT("ok"));
-		Result->SetStringField(TEXT("sequence"), SequencePath);
-		Result->SetStringField(TEXT("output_path"), OutputPath);
-		Result->SetStringField(TEXT("format"), TEXT("png-sequence"));
-		Result->SetNumberField(TEXT("fps"), Fps);
-		Result->SetNumberField(TEXT("frame_count"), Frames.Num());
-		Result->SetArrayField(TEXT("frames"), Frames);
-		Result->SetStringField(TEXT("note"), TEXT("Rendered as PNG sequence. Use ffmpeg externally for MP4 encoding."));
-		SendJsonResponse(OnComplete, Result);
+		{
+			FScopeLock Lock(&RenderState->Mutex);
+			RenderState->bCaptureDone = true;
+		}
+		TryFinishRender();
 	});
 	return true;
 }
@@ -1,4 +1,5 @@
 #include "NovaBridgeModule.h"
+#include "NovaBridgeEditorInternals.h"
 
 #include "Async/Async.h"
 
@@ -74,7 +75,7 @@ bool FNovaBridgeModule::HandleStreamConfig(const FHttpServerRequest& Request, co
 
 	if (bResized)
 	{
-		AsyncTask(ENamedThreads::GameThread, [this]()
+		DispatchGameThreadTask([this]()
 		{
 			CleanupStreamCapture();
 		});
@@ -112,6 +113,23 @@ bool FNovaBridgeModule::HandleStreamStatus(const FHttpServerRequest& Request, co
 	Result->SetNumberField(TEXT("quality"), StreamQuality);
 	Result->SetNumberField(TEXT("ws_port"), WsPort);
 	Result->SetStringField(TEXT("ws_url"), FString::Printf(TEXT("ws://localhost:%d"), WsPort));
+
+	const FNovaBridgeEncodeStats EncodeStats = GetImageEncodeStats();
+	TSharedPtr<FJsonObject> EncoderObj = MakeShareable(new FJsonObject);
+	EncoderObj->SetNumberField(TEXT("queue_depth"), EncodeStats.QueueDepth);
+	EncoderObj->SetNumberField(TEXT("peak_queue_depth"), EncodeStats.PeakQueueDepth);
+	EncoderObj->SetNumberField(TEXT("queue_limit"), EncodeStats.QueueLimit);
+	EncoderObj->SetNumberField(TEXT("active_png"), EncodeStats.ActivePng);
+	EncoderObj->SetNumberField(TEXT("active_jpeg"), EncodeStats.ActiveJpeg);
+	EncoderObj->SetNumberField(TEXT("max_workers"), EncodeStats.MaxWorkers);
+	EncoderObj->SetNumberField(TEXT("max_png"), EncodeStats.MaxPng);
+	EncoderObj->SetNumberField(TEXT("max_jpeg"), EncodeStats.MaxJpeg);
+	EncoderObj->SetNumberField(TEXT("queued"), static_cast<double>(EncodeStats.Queued));
+	EncoderObj->SetNumberField(TEXT("completed"), static_cast<double>(EncodeStats.Completed));
+	EncoderObj->SetNumberField(TEXT("failed"), static_cast<double>(EncodeStats.Failed));
+	EncoderObj->SetNumberField(TEXT("rejected"), static_cast<double>(EncodeStats.Rejected));
+	EncoderObj->SetNumberField(TEXT("total_encode_ms"), EncodeStats.TotalEncodeMs);
+	Result->SetObjectField(TEXT("encoder"), EncoderObj);
 	SendJsonResponse(OnComplete, Result);
 	return true;
 }
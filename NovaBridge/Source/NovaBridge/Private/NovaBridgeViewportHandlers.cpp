@@ -1,4 +1,5 @@
 #include "NovaBridgeModule.h"
+#include "NovaBridgeEditorInternals.h"
 
 #include "Async/Async.h"
 #include "Components/SceneCaptureComponent2D.h"
@@ -6,11 +7,8 @@
 #include "Engine/SceneCapture2D.h"
 #include "Engine/TextureRenderTarget2D.h"
 #include "EngineUtils.h"
-#include "IImageWrapper.h"
-#include "IImageWrapperModule.h"
 #include "Misc/Base64.h"
 #include "ShowFlags.h"
-#include "TextureResource.h"
 
 // ============================================================
 // Viewport Handlers (Offscreen SceneCapture2D)
@@ -171,8 +169,11 @@ bool FNovaBridgeModule::HandleViewportScreenshot(const FHttpServerRequest& Reque
 		const FString Format = Request.QueryParams[TEXT("format")].ToLower();
 		bRawPng = (Format == TEXT("raw") || Format == TEXT("png"));
 	}
+	// Only an explicit opt-in gets the test pattern from sessions without an RHI.
+	const bool bAllowPlaceholder = Request.QueryParams.Contains(TEXT("placeholder"))
+		&& (Request.QueryParams[TEXT("placeholder")] == TEXT("1") || Request.QueryParams[TEXT("placeholder")].Equals(TEXT("true"), ESearchCase::IgnoreCase));
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, ReqWidth, ReqHeight, bRawPng]()
+	DispatchGameThreadTask([this, OnComplete, ReqWidth, ReqHeight, bRawPng, bAllowPlaceholder]()
 	{
 		if (!GEditor)
 		{
@@ -185,6 +186,7 @@ bool FNovaBridgeModule::HandleViewportScreenshot(const FHttpServerRequest& Reque
 		{
 			CaptureWidth = FMath::Clamp(ReqWidth, 64, 3840);
 			CaptureHeight = FMath::Clamp(ReqHeight, 64, 2160);
+			++CameraRevision;
 			CleanupCapture(); // Force re-creation at new size
 		}
 
@@ -202,63 +204,68 @@ bool FNovaBridgeModule::HandleViewportScreenshot(const FHttpServerRequest& Reque
 		CaptureActor->SetActorRotation(CameraRotation);
 		CaptureComp->FOVAngle = CameraFOV;
 
-		// Capture the scene
+		// Capture the scene; pixels come back through the readback ring a frame or two later.
 		CaptureComp->CaptureScene();
 
-		// Read pixels from render target
-		FTextureRenderTargetResource* RTResource = RenderTarget->GameThread_GetRenderTargetResource();
-		if (!RTResource)
+		RequestRenderTargetReadback(RenderTarget.Get(), [this, OnComplete, bRawPng](FNovaBridgeReadbackResult&& Readback)
 		{
-			SendErrorResponse(OnComplete, TEXT("No render target resource"), 500);
-			return;
-		}
+			if (!Readback.bSuccess || Readback.Pixels.Num() == 0)
+			{
+				const int32 Status = Readback.bNoRhi ? 501 : 500;
+				SendErrorResponse(OnComplete, Readback.Error.IsEmpty() ? TEXT("Failed to read render target pixels") : Readback.Error, Status);
+				return;
+			}
 
-		TArray<FColor> Bitmap;
-		bool bSuccess = RTResource->ReadPixels(Bitmap);
-		if (!bSuccess || Bitmap.Num() == 0)
-		{
-			SendErrorResponse(OnComplete, TEXT("Failed to read render target pixels"), 500);
-			return;
-		}
+			const int32 Width = Readback.Width;
+			const int32 Height = Readback.Height;
+			const FString ReadbackSource = Readback.Source;
+			const bool bPlaceholder = ReadbackSource == TEXT("software");
 
-		int32 Width = CaptureWidth;
-		int32 Height = CaptureHeight;
+			FNovaBridgeEncodeCallback OnEncoded = [this, OnComplete, bRawPng, Width, Height, ReadbackSource, bPlaceholder](FNovaBridgeEncodeResult&& Encoded)
+			{
+				if (!Encoded.bSuccess)
+				{
+					SendErrorResponse(OnComplete, Encoded.Error.IsEmpty() ? TEXT("Failed to encode PNG") : Encoded.Error, 500);
+					return;
+				}
 
-		// Encode as PNG
-		IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
-		TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
-		ImageWrapper->SetRaw(Bitmap.GetData(), Bitmap.Num() * sizeof(FColor), Width, Height, ERGBFormat::BGRA, 8);
+				if (bRawPng)
+				{
+					TArray<uint8> RawPng;
+					RawPng.Append(Encoded.Bytes.GetData(), static_cast<int32>(Encoded.Bytes.Num()));
+
+					TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(MoveTemp(RawPng), TEXT("image/png"));
+					Response->Code = EHttpServerResponseCodes::Ok;
+					Response->Headers.FindOrAdd(TEXT("X-NovaBridge-Width")).Add(FString::FromInt(Width));
+					Response->Headers.FindOrAdd(TEXT("X-NovaBridge-Height")).Add(FString::FromInt(Height));
+					Response->Headers.FindOrAdd(TEXT("X-NovaBridge-Readback")).Add(ReadbackSource);
+					if (bPlaceholder)
+					{
+						Response->Headers.FindOrAdd(TEXT("X-NovaBridge-Placeholder")).Add(TEXT("true"));
+					}
+					AddCorsHeaders(Response);
+					OnComplete(MoveTemp(Response));
+					return;
+				}
 
-		TArray64<uint8> PngData = ImageWrapper->GetCompressed(0);
-		if (PngData.Num() > 0)
-		{
-			if (bRawPng)
-			{
-				TArray<uint8> RawPng;
-				RawPng.Append(PngData.GetData(), static_cast<int32>(PngData.Num()));
-
-				TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(MoveTemp(RawPng), TEXT("image/png"));
-				Response->Code = EHttpServerResponseCodes::Ok;
-				Response->Headers.FindOrAdd(TEXT("X-NovaBridge-Width")).Add(FString::FromInt(Width));
-				Response->Headers.FindOrAdd(TEXT("X-NovaBridge-Height")).Add(FString::FromInt(Height));
-				AddCorsHeaders(Response);
-				OnComplete(MoveTemp(Response));
-				return;
-			}
+				FString Base64 = FBase64::Encode(Encoded.Bytes.GetData(), Encoded.Bytes.Num());
 
-			FString Base64 = FBase64::Encode(PngData.GetData(), PngData.Num());
+				TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+				Result->SetStringField(TEXT("image"), Base64);
+				Result->SetNumberField(TEXT("width"), Width);
+				Result->SetNumberField(TEXT("height"), Height);
+				Result->SetStringField(TEXT("format"), TEXT("png"));
+				Result->SetStringField(TEXT("readback"), ReadbackSource);
+				Result->SetBoolField(TEXT("placeholder"), bPlaceholder);
+				SendJsonResponse(OnComplete, Result);
+			};
 
-			TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
-			Result->SetStringField(TEXT("image"), Base64);
-			Result->SetNumberField(TEXT("width"), Width);
-			Result->SetNumberField(TEXT("height"), Height);
-			Result->SetStringField(TEXT("format"), TEXT("png"));
-			SendJsonResponse(OnComplete, Result);
-		}
-		else
-		{
-			SendErrorResponse(OnComplete, TEXT("Failed to encode PNG"), 500);
-		}
+			// Encode off the game thread; a saturated pool is reported to the client rather than encoded here.
+			if (!QueueImageEncode(ENovaBridgeEncodeFormat::Png, MoveTemp(Readback.Pixels), Width, Height, 0, ENovaBridgeEncodeCallbackThread::GameThread, MoveTemp(OnEncoded)))
+			{
+				SendErrorResponse(OnComplete, TEXT("Image encoder busy, retry shortly"), 503);
+			}
+		}, bAllowPlaceholder);
 	});
 	return true;
 }
@@ -272,7 +279,7 @@ bool FNovaBridgeModule::HandleViewportSetCamera(const FHttpServerRequest& Reques
 		return true;
 	}
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Body]()
+	DispatchGameThreadTask([this, OnComplete, Body]()
 	{
 		TArray<FString> UnknownShowFlags;
 
@@ -329,6 +336,8 @@ bool FNovaBridgeModule::HandleViewportSetCamera(const FHttpServerRequest& Reques
 			}
 		}
 
+		++CameraRevision;
+
 		// Update capture actor position if it exists
 		if (CaptureActor.IsValid())
 		{
@@ -371,7 +380,7 @@ bool FNovaBridgeModule::HandleViewportSetCamera(const FHttpServerRequest& Reques
 
 bool FNovaBridgeModule::HandleViewportGetCamera(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete]()
+	DispatchGameThreadTask([this, OnComplete]()
 	{
 		TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
 
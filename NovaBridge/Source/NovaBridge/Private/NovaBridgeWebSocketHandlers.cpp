@@ -1,5 +1,6 @@
 #include "NovaBridgeModule.h"
 #include "NovaBridgeEditorInternals.h"
+#include "NovaBridgeEventRing.h"
 #include "NovaBridgeHttpUtils.h"
 
 #include "Async/Async.h"
@@ -8,15 +9,12 @@
 #include "Dom/JsonValue.h"
 #include "Engine/SceneCapture2D.h"
 #include "Engine/TextureRenderTarget2D.h"
-#include "IImageWrapper.h"
-#include "IImageWrapperModule.h"
 #include "Misc/CommandLine.h"
 #include "Misc/Parse.h"
 #include "Modules/ModuleManager.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
-#include "TextureResource.h"
 
 #if NOVABRIDGE_WITH_WEBSOCKET_NETWORKING
 #include "INetworkingWebSocket.h"
@@ -67,10 +65,11 @@ void SendSocketJsonMessage(INetworkingWebSocket* Socket, const TSharedPtr<FJsonO
 	Socket->Send(MutableData, Utf8Payload.Length(), false);
 }
 
-bool ParseEventSubscriptionPayload(const FString& Message, TSet<FString>& OutTypes, bool& bOutEnableFilter, FString& OutError)
+bool ParseEventSubscriptionPayload(const FString& Message, TSet<FString>& OutTypes, bool& bOutEnableFilter, int64& OutSinceSeq, FString& OutError)
 {
 	OutTypes.Reset();
 	bOutEnableFilter = false;
+	OutSinceSeq = -1;
 
 	TSharedPtr<FJsonObject> JsonObj;
 	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
@@ -80,6 +79,21 @@ bool ParseEventSubscriptionPayload(const FString& Message, TSet<FString>& OutTyp
 		return false;
 	}
 
+	if (JsonObj->HasTypedField<EJson::Number>(TEXT("since")))
+	{
+		OutSinceSeq = FMath::Max<int64>(0, static_cast<int64>(JsonObj->GetNumberField(TEXT("since"))));
+	}
+	else if (JsonObj->HasTypedField<EJson::String>(TEXT("since")))
+	{
+		const FString SinceText = JsonObj->GetStringField(TEXT("since"));
+		if (!SinceText.IsNumeric())
+		{
+			OutError = TEXT("Subscription 'since' must be a sequence number");
+			return false;
+		}
+		OutSinceSeq = FMath::Max<int64>(0, FCString::Atoi64(*SinceText));
+	}
+
 	FString Action = JsonObj->HasTypedField<EJson::String>(TEXT("action"))
 		? NormalizeEventType(JsonObj->GetStringField(TEXT("action")))
 		: TEXT("subscribe");
@@ -306,8 +320,9 @@ void FNovaBridgeModule::StartEventWebSocketServer()
 			const FString Message(Converted.Length(), Converted.Get());
 			TSet<FString> RequestedTypes;
 			bool bEnableFilter = false;
+			int64 SinceSeq = -1;
 			FString ParseError;
-			if (!ParseEventSubscriptionPayload(Message, RequestedTypes, bEnableFilter, ParseError))
+			if (!ParseEventSubscriptionPayload(Message, RequestedTypes, bEnableFilter, SinceSeq, ParseError))
 			{
 				TSharedPtr<FJsonObject> ErrorReply = MakeShared<FJsonObject>();
 				ErrorReply->SetStringField(TEXT("type"), TEXT("subscription"));
@@ -327,16 +342,34 @@ void FNovaBridgeModule::StartEventWebSocketServer()
 				return;
 			}
 
-			EventWsClients[ClientIndex].bEventTypeFilterEnabled = bEnableFilter;
-			EventWsClients[ClientIndex].EventTypes = MoveTemp(RequestedTypes);
-			EventWsClients[ClientIndex].bSubscriptionConfirmed = true;
+			// since=<seq> replays everything after seq on the next pump; without it a new subscriber starts live.
+			FWsClient& Client = EventWsClients[ClientIndex];
+			const NovaBridgeCore::FEventRingStats EventStats = GetEventQueueStats();
+			bool bReplayGap = false;
+			if (SinceSeq >= 0)
+			{
+				const uint64 Since = static_cast<uint64>(SinceSeq);
+				bReplayGap = !CanReplayEventsFrom(Since);
+				Client.LastEventSeq = FMath::Min(Since, EventStats.HeadSeq);
+			}
+			else if (!Client.bSubscriptionConfirmed)
+			{
+				Client.LastEventSeq = EventStats.HeadSeq;
+			}
+			Client.bEventTypeFilterEnabled = bEnableFilter;
+			Client.EventTypes = MoveTemp(RequestedTypes);
+			Client.bSubscriptionConfirmed = true;
 
 			TSharedPtr<FJsonObject> AckReply = MakeShared<FJsonObject>();
 			AckReply->SetStringField(TEXT("type"), TEXT("subscription"));
 			AckReply->SetStringField(TEXT("status"), TEXT("ok"));
 			AckReply->SetBoolField(TEXT("subscription_confirmed"), true);
-			AckReply->SetBoolField(TEXT("filter_enabled"), EventWsClients[ClientIndex].bEventTypeFilterEnabled);
-			AckReply->SetArrayField(TEXT("types"), MakeJsonStringArray(EventWsClients[ClientIndex].EventTypes.Array()));
+			AckReply->SetBoolField(TEXT("filter_enabled"), Client.bEventTypeFilterEnabled);
+			AckReply->SetArrayField(TEXT("types"), MakeJsonStringArray(Client.EventTypes.Array()));
+			AckReply->SetNumberField(TEXT("head_seq"), static_cast<double>(EventStats.HeadSeq));
+			AckReply->SetNumberField(TEXT("tail_seq"), static_cast<double>(EventStats.TailSeq));
+			AckReply->SetNumberField(TEXT("replay_from"), static_cast<double>(Client.LastEventSeq));
+			AckReply->SetBoolField(TEXT("replay_gap"), bReplayGap);
 			SendSocketJsonMessage(Socket, AckReply);
 		});
 		Socket->SetReceiveCallBack(ReceiveCallback);
@@ -367,6 +400,7 @@ void FNovaBridgeModule::StartEventWebSocketServer()
 		WelcomeReply->SetBoolField(TEXT("events_paused_until_subscribe"), true);
 		WelcomeReply->SetBoolField(TEXT("filter_enabled"), false);
 		WelcomeReply->SetArrayField(TEXT("supported_types"), MakeJsonStringArray(SupportedEventTypes()));
+		WelcomeReply->SetNumberField(TEXT("head_seq"), static_cast<double>(GetEventQueueStats().HeadSeq));
 		WelcomeReply->SetStringField(TEXT("hint"), TEXT("{\"action\":\"subscribe\",\"types\":[\"spawn\",\"error\"]}"));
 		SendSocketJsonMessage(Socket, WelcomeReply);
 
@@ -435,48 +469,70 @@ void FNovaBridgeModule::PumpEventSocketQueue()
 		return;
 	}
 
-	TArray<FString> PendingPayloads;
-	TArray<FString> PendingTypes;
-	DrainPendingEventQueue(PendingPayloads, PendingTypes);
-	if (PendingPayloads.Num() == 0)
+	uint64 OldestCursor = MAX_uint64;
+	for (int32 ClientIndex = EventWsClients.Num() - 1; ClientIndex >= 0; --ClientIndex)
 	{
+		if (!EventWsClients[ClientIndex].Socket)
+		{
+			EventWsClients.RemoveAtSwap(ClientIndex);
+			continue;
+		}
+		if (EventWsClients[ClientIndex].bSubscriptionConfirmed)
+		{
+			OldestCursor = FMath::Min(OldestCursor, EventWsClients[ClientIndex].LastEventSeq);
+		}
+	}
+	if (OldestCursor == MAX_uint64)
+	{
+		// Nobody has subscribed yet; new subscribers start live (or replay with since=), so just advance.
+		MarkEventsPumped(GetEventQueueStats().HeadSeq);
 		return;
 	}
-	if (PendingTypes.Num() != PendingPayloads.Num())
+
+	TArray<NovaBridgeCore::FEventRecord> Events;
+	ReadEventsSince(OldestCursor, Events);
+	if (Events.Num() == 0)
 	{
-		PendingTypes.Init(TEXT("audit"), PendingPayloads.Num());
+		return;
 	}
 
-	for (int32 PayloadIndex = 0; PayloadIndex < PendingPayloads.Num(); ++PayloadIndex)
+	uint64 Sends = 0;
+	for (const NovaBridgeCore::FEventRecord& Event : Events)
 	{
-		const FTCHARToUTF8 Utf8Payload(*PendingPayloads[PayloadIndex]);
-		const uint8* Data = reinterpret_cast<const uint8*>(Utf8Payload.Get());
-		uint8* MutableData = const_cast<uint8*>(Data);
-		const int32 DataLen = Utf8Payload.Length();
-		const FString& PayloadType = PendingTypes.IsValidIndex(PayloadIndex) && !PendingTypes[PayloadIndex].IsEmpty()
-			? PendingTypes[PayloadIndex]
-			: TEXT("audit");
+		if (!Event.Payload.IsValid())
+		{
+			continue;
+		}
 
-		for (int32 ClientIndex = EventWsClients.Num() - 1; ClientIndex >= 0; --ClientIndex)
+		// The socket API takes a mutable pointer but does not modify the buffer, so every client shares it.
+		uint8* Data = const_cast<uint8*>(Event.Payload->Utf8.GetData());
+		const int32 DataLen = Event.Payload->Utf8.Num();
+		const FString& PayloadType = Event.Payload->Type;
+		for (FWsClient& Client : EventWsClients)
 		{
-			if (!EventWsClients[ClientIndex].Socket)
+			if (!Client.bSubscriptionConfirmed || Event.Seq <= Client.LastEventSeq)
 			{
-				EventWsClients.RemoveAtSwap(ClientIndex);
 				continue;
 			}
-			if (!EventWsClients[ClientIndex].bSubscriptionConfirmed)
+			if (Client.bEventTypeFilterEnabled && !Client.EventTypes.Contains(PayloadType))
 			{
 				continue;
 			}
+			Client.Socket->Send(Data, DataLen, false);
+			Sends++;
+		}
+	}
+	RecordEventFanoutSends(Sends);
 
-			if (EventWsClients[ClientIndex].bEventTypeFilterEnabled
-				&& !EventWsClients[ClientIndex].EventTypes.Contains(PayloadType))
-			{
-				continue;
-			}
-			EventWsClients[ClientIndex].Socket->Send(MutableData, DataLen, false);
+	const uint64 LastSeq = Events.Last().Seq;
+	for (FWsClient& Client : EventWsClients)
+	{
+		if (Client.bSubscriptionConfirmed)
+		{
+			Client.LastEventSeq = FMath::Max(Client.LastEventSeq, LastSeq);
 		}
 	}
+	MarkEventsPumped(LastSeq);
 #endif
 }
 
@@ -534,44 +590,60 @@ void FNovaBridgeModule::StreamTick()
 			return;
 		}
 
+		// Skip this tick while the previous frame is still in readback or encode.
+		if (bStreamFramePending)
+		{
+			return;
+		}
+
 		USceneCaptureComponent2D* CaptureComp = StreamCaptureActor->GetCaptureComponent2D();
 		StreamCaptureActor->SetActorLocation(CameraLocation);
 		StreamCaptureActor->SetActorRotation(CameraRotation);
 		CaptureComp->FOVAngle = CameraFOV;
 		CaptureComp->CaptureScene();
 
-		FTextureRenderTargetResource* RTResource = StreamRenderTarget->GameThread_GetRenderTargetResource();
-		if (!RTResource)
+		bStreamFramePending = true;
+		RequestRenderTargetReadback(StreamRenderTarget.Get(), [this](FNovaBridgeReadbackResult&& Readback)
 		{
-			return;
-		}
-
-		TArray<FColor> Bitmap;
-		if (!RTResource->ReadPixels(Bitmap) || Bitmap.Num() == 0)
-		{
-			return;
-		}
-
-		IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
-		TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::JPEG);
-		ImageWrapper->SetRaw(Bitmap.GetData(), Bitmap.Num() * sizeof(FColor), StreamWidth, StreamHeight, ERGBFormat::BGRA, 8);
-		TArray64<uint8> Encoded = ImageWrapper->GetCompressed(FMath::Clamp(StreamQuality, 1, 100));
-		if (Encoded.Num() == 0)
-		{
-			return;
-		}
+			if (!Readback.bSuccess || Readback.Pixels.Num() == 0)
+			{
+				bStreamFramePending = false;
+				return;
+			}
 
-		TArray<uint8> Payload;
-		Payload.Append(Encoded.GetData(), static_cast<int32>(Encoded.Num()));
-		for (int32 Idx = WsClients.Num() - 1; Idx >= 0; --Idx)
-		{
-			if (!WsClients[Idx].Socket)
+			const bool bQueued = QueueImageEncode(
+				ENovaBridgeEncodeFormat::Jpeg,
+				MoveTemp(Readback.Pixels),
+				Readback.Width,
+				Readback.Height,
+				FMath::Clamp(StreamQuality, 1, 100),
+				ENovaBridgeEncodeCallbackThread::GameThread,
+				[this](FNovaBridgeEncodeResult&& Encoded)
+				{
+					bStreamFramePending = false;
+					if (!Encoded.bSuccess || Encoded.Bytes.Num() == 0)
+					{
+						return;
+					}
+
+					TArray<uint8> Payload;
+					Payload.Append(Encoded.Bytes.GetData(), static_cast<int32>(Encoded.Bytes.Num()));
+					for (int32 Idx = WsClients.Num() - 1; Idx >= 0; --Idx)
+					{
+						if (!WsClients[Idx].Socket)
+						{
+							WsClients.RemoveAtSwap(Idx);
+							continue;
+						}
+						WsClients[Idx].Socket->Send(Payload.GetData(), Payload.Num(), false);
+					}
+				});
+			if (!bQueued)
 			{
-				WsClients.RemoveAtSwap(Idx);
-				continue;
+				// Encoder is saturated; drop the frame instead of encoding on the game thread.
+				bStreamFramePending = false;
 			}
-			WsClients[Idx].Socket->Send(Payload.GetData(), Payload.Num(), false);
-		}
+		});
 	});
 #endif
 }
@@ -18,6 +18,15 @@ class INetworkingWebSocket;
 class ULevelSequencePlayer;
 class ALevelSequenceActor;
 
+struct FNovaBridgeBatchState;
+
+namespace NovaBridgeCore
+{
+struct FResponseProfile;
+struct FRouteMetrics;
+struct FRoutePolicy;
+}
+
 class FNovaBridgeModule : public IModuleInterface
 {
 public:
@@ -30,10 +39,15 @@ private:
 	bool HandleCorsPreflight(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 	void AddCorsHeaders(TUniquePtr<struct FHttpServerResponse>& Response) const;
 	bool IsApiKeyAuthorized(const struct FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	// Conditional GET: the revision counter a cacheable route's body is derived from; unbound for other routes.
+	TFunction<uint64()> MakeRouteRevisionSource(const FString& RoutePath);
 
 	// JSON helpers
 	TSharedPtr<FJsonObject> ParseRequestBody(const struct FHttpServerRequest& Request);
 	void SendJsonResponse(const FHttpResultCallback& OnComplete, TSharedPtr<FJsonObject> JsonObj, int32 StatusCode = 200);
+	// Large listings: EncodeArray runs on a worker and its JSON array becomes Envelope's ArrayField; the game
+	// thread only hands the finished bytes to the server.
+	void SendEncodedJsonResponse(const FHttpResultCallback& OnComplete, TSharedRef<FJsonObject> Envelope, const FString& ArrayField, TUniqueFunction<FString(const NovaBridgeCore::FResponseProfile&)>&& EncodeArray);
 	void SendErrorResponse(const FHttpResultCallback& OnComplete, const FString& Error, int32 StatusCode = 400);
 	void SendOkResponse(const FHttpResultCallback& OnComplete);
 
@@ -45,13 +59,32 @@ private:
 	bool HandleUndo(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 	bool HandleAuditTrail(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 	bool HandleEvents(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleMetrics(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	// Batch: entries run through the bound handlers and their compiled policies, in order, on one game-thread pass
+	// unless an entry has to wait for a worker or the renderer.
+	using FRouteHandler = bool (FNovaBridgeModule::*)(const FHttpServerRequest&, const FHttpResultCallback&);
+	struct FBatchRoute
+	{
+		FRouteHandler Handler = nullptr;
+		EHttpServerRequestVerbs Verbs = EHttpServerRequestVerbs::VERB_NONE;
+		NovaBridgeCore::FRouteMetrics* Metrics = nullptr;
+		const NovaBridgeCore::FRoutePolicy* Policy = nullptr;
+	};
+	bool HandleBatch(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	void RunBatchRequests(const TSharedRef<FNovaBridgeBatchState>& State);
+	void StartBatchSubRequest(const TSharedRef<FNovaBridgeBatchState>& State, int32 Index);
 
 	// Scene handlers
 	bool HandleSceneList(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleSceneChanges(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleSceneQuery(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 	bool HandleSceneSpawn(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 	bool HandleSceneDelete(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 	bool HandleSceneTransform(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleSceneTransformBatch(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 	bool HandleSceneGet(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleSceneGetMany(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 	bool HandleSceneSetProperty(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 
 	// Asset handlers
@@ -142,12 +175,15 @@ private:
 		bool bSubscriptionConfirmed = false;
 		bool bEventTypeFilterEnabled = false;
 		TSet<FString> EventTypes;
+		uint64 LastEventSeq = 0;
 	};
 
 	TSharedPtr<IHttpRouter> HttpRouter;
 	TArray<FHttpRouteHandle> RouteHandles;
+	TMap<FString, FBatchRoute> BatchRoutes;
 	uint32 HttpPort = 30010;
 	int32 ApiRouteCount = 0;
+	int32 CompressionMinBytes = 0;
 	FString RequiredApiKey;
 
 	// WebSocket streaming state
@@ -159,6 +195,7 @@ private:
 	int32 StreamHeight = 360;
 	int32 StreamQuality = 50;
 	bool bStreamActive = false;
+	bool bStreamFramePending = false;
 	double LastStreamFrameTime = 0.0;
 	FTSTicker::FDelegateHandle WsServerTickHandle;
 	FTSTicker::FDelegateHandle StreamTickHandle;
@@ -179,6 +216,8 @@ private:
 	float CameraFOV = 90.0f;
 	int32 CaptureWidth = 1280;
 	int32 CaptureHeight = 720;
+	// Bumped whenever camera/get's answer changes; part of that route's ETag.
+	uint64 CameraRevision = 0;
 
 	// Runtime sequencer state
 	TMap<FString, TWeakObjectPtr<ULevelSequencePlayer>> SequencePlayers;
@@ -0,0 +1,183 @@
+#include "NovaBridgeAdmission.h"
+
+#include "HAL/PlatformTime.h"
+#include "HttpServerResponse.h"
+
+namespace NovaBridgeCore
+{
+namespace
+{
+// A new hold-time sample moves the average 1/8 of the way towards it.
+constexpr int64 AdmissionAverageWeight = 8;
+
+int32 AdmissionClassIndex(ERouteClass Class)
+{
+	const int32 Index = static_cast<int32>(Class);
+	return Index >= 0 && Index < RouteClassCount ? Index : 0;
+}
+
+int32 EstimateAdmissionWaitMs(int32 InFlight, uint64 AverageServiceUs)
+{
+	const uint64 WaitMs = static_cast<uint64>(FMath::Max(0, InFlight)) * AverageServiceUs / 1000;
+	return static_cast<int32>(FMath::Min<uint64>(WaitMs, MAX_int32));
+}
+
+// Holds one admitted slot; shared by every copy of the wrapped callback.
+struct FAdmissionTicket
+{
+	FAdmissionController& Controller;
+	ERouteClass Class;
+	double AdmittedSec;
+	std::atomic<bool> bReleased { false };
+
+	FAdmissionTicket(FAdmissionController& InController, ERouteClass InClass)
+		: Controller(InController)
+		, Class(InClass)
+		, AdmittedSec(FPlatformTime::Seconds())
+	{
+	}
+
+	~FAdmissionTicket()
+	{
+		Release();
+	}
+
+	void Release()
+	{
+		if (!bReleased.exchange(true))
+		{
+			Controller.Release(Class, FPlatformTime::Seconds() - AdmittedSec);
+		}
+	}
+};
+} // namespace
+
+const TCHAR* RouteClassToString(ERouteClass Class)
+{
+	switch (Class)
+	{
+	case ERouteClass::Control:
+		return TEXT("control");
+	case ERouteClass::Read:
+		return TEXT("read");
+	case ERouteClass::Write:
+		return TEXT("write");
+	case ERouteClass::Heavy:
+		return TEXT("heavy");
+	default:
+		return TEXT("control");
+	}
+}
+
+void FAdmissionController::Configure(ERouteClass Class, const FAdmissionLimits& Limits)
+{
+	FClassState& State = Classes[AdmissionClassIndex(Class)];
+	State.MaxInFlight.store(FMath::Max(0, Limits.MaxInFlight), std::memory_order_relaxed);
+	State.MaxEstimatedWaitMs.store(FMath::Max(0, Limits.MaxEstimatedWaitMs), std::memory_order_relaxed);
+}
+
+FAdmissionDecision FAdmissionController::TryAdmit(ERouteClass Class)
+{
+	FClassState& State = Classes[AdmissionClassIndex(Class)];
+	const int32 MaxInFlight = State.MaxInFlight.load(std::memory_order_relaxed);
+	const int32 MaxWaitMs = State.MaxEstimatedWaitMs.load(std::memory_order_relaxed);
+	const uint64 AverageUs = State.AverageServiceUs.load(std::memory_order_relaxed);
+
+	FAdmissionDecision Decision;
+	Decision.Class = Class;
+	int32 InFlight = State.InFlight.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		Decision.InFlight = InFlight;
+		Decision.EstimatedWaitMs = EstimateAdmissionWaitMs(InFlight, AverageUs);
+		if ((MaxInFlight > 0 && InFlight >= MaxInFlight) || (MaxWaitMs > 0 && Decision.EstimatedWaitMs > MaxWaitMs))
+		{
+			Decision.bAdmitted = false;
+			Decision.RetryAfterSeconds = FMath::Max(1, (Decision.EstimatedWaitMs + 999) / 1000);
+			State.Rejected.fetch_add(1, std::memory_order_relaxed);
+			return Decision;
+		}
+		if (State.InFlight.compare_exchange_weak(InFlight, InFlight + 1, std::memory_order_relaxed))
+		{
+			break;
+		}
+	}
+
+	State.Admitted.fetch_add(1, std::memory_order_relaxed);
+	int32 Peak = State.PeakInFlight.load(std::memory_order_relaxed);
+	while (InFlight + 1 > Peak && !State.PeakInFlight.compare_exchange_weak(Peak, InFlight + 1, std::memory_order_relaxed))
+	{
+	}
+	return Decision;
+}
+
+void FAdmissionController::Release(ERouteClass Class, double HeldSec)
+{
+	FClassState& State = Classes[AdmissionClassIndex(Class)];
+	State.InFlight.fetch_sub(1, std::memory_order_relaxed);
+
+	const int64 SampleUs = static_cast<int64>(FMath::Max(0.0, HeldSec) * 1000000.0);
+	uint64 Average = State.AverageServiceUs.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		const int64 Current = static_cast<int64>(Average);
+		const uint64 Next = Average == 0 ? static_cast<uint64>(SampleUs) : static_cast<uint64>(Current + (SampleUs - Current) / AdmissionAverageWeight);
+		if (State.AverageServiceUs.compare_exchange_weak(Average, FMath::Max<uint64>(Next, 1), std::memory_order_relaxed))
+		{
+			break;
+		}
+	}
+}
+
+FAdmissionStats FAdmissionController::GetStats(ERouteClass Class) const
+{
+	const FClassState& State = Classes[AdmissionClassIndex(Class)];
+	FAdmissionStats Stats;
+	Stats.InFlight = FMath::Max(0, State.InFlight.load(std::memory_order_relaxed));
+	Stats.PeakInFlight = State.PeakInFlight.load(std::memory_order_relaxed);
+	Stats.Admitted = State.Admitted.load(std::memory_order_relaxed);
+	Stats.Rejected = State.Rejected.load(std::memory_order_relaxed);
+	Stats.AverageServiceUs = State.AverageServiceUs.load(std::memory_order_relaxed);
+	Stats.EstimatedWaitMs = EstimateAdmissionWaitMs(Stats.InFlight, Stats.AverageServiceUs);
+	Stats.Limits.MaxInFlight = State.MaxInFlight.load(std::memory_order_relaxed);
+	Stats.Limits.MaxEstimatedWaitMs = State.MaxEstimatedWaitMs.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+void FAdmissionController::ResetStats()
+{
+	for (FClassState& State : Classes)
+	{
+		State.PeakInFlight.store(State.InFlight.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		State.Admitted.store(0, std::memory_order_relaxed);
+		State.Rejected.store(0, std::memory_order_relaxed);
+		State.AverageServiceUs.store(0, std::memory_order_relaxed);
+	}
+}
+
+FHttpResultCallback WrapResultCallbackWithAdmission(FAdmissionController& Controller, ERouteClass Class, const FHttpResultCallback& OnComplete)
+{
+	const TSharedRef<FAdmissionTicket, ESPMode::ThreadSafe> Ticket = MakeShared<FAdmissionTicket, ESPMode::ThreadSafe>(Controller, Class);
+	return [Ticket, OnComplete](TUniquePtr<FHttpServerResponse>&& Response)
+	{
+		Ticket->Release();
+		OnComplete(MoveTemp(Response));
+	};
+}
+
+FHttpResultCallback WrapResultCallbackWithAdmissionHeaders(const FAdmissionDecision& Decision, const FHttpResultCallback& OnComplete)
+{
+	return [Decision, OnComplete](TUniquePtr<FHttpServerResponse>&& Response)
+	{
+		if (Response)
+		{
+			Response->Headers.Add(TEXT("X-NovaBridge-Queue-Depth"), { FString::FromInt(Decision.InFlight) });
+			if (!Decision.bAdmitted)
+			{
+				Response->Headers.Add(TEXT("Retry-After"), { FString::FromInt(Decision.RetryAfterSeconds) });
+			}
+		}
+		OnComplete(MoveTemp(Response));
+	};
+}
+} // namespace NovaBridgeCore
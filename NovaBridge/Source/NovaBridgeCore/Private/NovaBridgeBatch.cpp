@@ -0,0 +1,152 @@
+#include "NovaBridgeBatch.h"
+
+#include "NovaBridgeHttpUtils.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Misc/Base64.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace NovaBridgeCore
+{
+namespace
+{
+bool ParseBatchEntry(const FJsonObject& Entry, int32 Index, FBatchSubRequest& OutRequest, FString& OutError)
+{
+	if (!Entry.TryGetStringField(TEXT("route"), OutRequest.Route) || !OutRequest.Route.StartsWith(TEXT("/nova/")))
+	{
+		OutError = FString::Printf(TEXT("requests[%d].route must be a /nova/ path"), Index);
+		return false;
+	}
+	if (OutRequest.Route.Contains(TEXT("?")))
+	{
+		OutError = FString::Printf(TEXT("requests[%d]: pass query parameters in 'query', not in the route"), Index);
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* Query = nullptr;
+	if (Entry.TryGetObjectField(TEXT("query"), Query))
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Query)->Values)
+		{
+			FString Value;
+			if (!Pair.Value.IsValid() || !Pair.Value->TryGetString(Value))
+			{
+				OutError = FString::Printf(TEXT("requests[%d].query.%s must be a string or number"), Index, *Pair.Key);
+				return false;
+			}
+			OutRequest.QueryParams.Add(Pair.Key, Value);
+		}
+	}
+
+	const TSharedPtr<FJsonObject>* Body = nullptr;
+	if (Entry.TryGetObjectField(TEXT("body"), Body))
+	{
+		FString BodyJson;
+		FJsonSerializer::Serialize(Body->ToSharedRef(), TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&BodyJson));
+		const FTCHARToUTF8 Utf8(*BodyJson, BodyJson.Len());
+		OutRequest.Body.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	}
+
+	FString Method;
+	if (!Entry.TryGetStringField(TEXT("method"), Method))
+	{
+		Method = OutRequest.Body.Num() > 0 ? TEXT("POST") : TEXT("GET");
+	}
+	if (Method.Equals(TEXT("GET"), ESearchCase::IgnoreCase))
+	{
+		OutRequest.Verb = EHttpServerRequestVerbs::VERB_GET;
+	}
+	else if (Method.Equals(TEXT("POST"), ESearchCase::IgnoreCase))
+	{
+		OutRequest.Verb = EHttpServerRequestVerbs::VERB_POST;
+	}
+	else
+	{
+		OutError = FString::Printf(TEXT("requests[%d].method must be GET or POST"), Index);
+		return false;
+	}
+	return true;
+}
+} // namespace
+
+bool ParseBatchRequest(const FJsonObject& Body, TArray<FBatchSubRequest>& OutRequests, bool& bOutStopOnError, FString& OutError)
+{
+	OutRequests.Reset();
+	bOutStopOnError = false;
+	Body.TryGetBoolField(TEXT("stop_on_error"), bOutStopOnError);
+
+	const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+	if (!Body.TryGetArrayField(TEXT("requests"), Entries) || Entries->Num() == 0)
+	{
+		OutError = TEXT("'requests' must be a non-empty array");
+		return false;
+	}
+	if (Entries->Num() > BatchMaxRequests)
+	{
+		OutError = FString::Printf(TEXT("A batch holds at most %d requests"), BatchMaxRequests);
+		return false;
+	}
+
+	OutRequests.Reserve(Entries->Num());
+	for (int32 Index = 0; Index < Entries->Num(); ++Index)
+	{
+		const TSharedPtr<FJsonObject>* Entry = nullptr;
+		if (!(*Entries)[Index].IsValid() || !(*Entries)[Index]->TryGetObject(Entry))
+		{
+			OutError = FString::Printf(TEXT("requests[%d] must be an object"), Index);
+			return false;
+		}
+		if (!ParseBatchEntry(**Entry, Index, OutRequests.AddDefaulted_GetRef(), OutError))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+FString ComposeBatchResponseJson(TConstArrayView<FBatchResult> Results, int32 Requested)
+{
+	FString Out = FString::Printf(TEXT("{\"status\":\"ok\",\"requested\":%d,\"completed\":%d,\"results\":["), Requested, Results.Num());
+	for (int32 Index = 0; Index < Results.Num(); ++Index)
+	{
+		const FBatchResult& Result = Results[Index];
+		FString Head;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Head);
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("route"), Result.Route);
+		Writer->WriteValue(TEXT("method"), HttpVerbToString(Result.Verb));
+		Writer->WriteValue(TEXT("status"), Result.Status);
+		const bool bJson = Result.ContentType.StartsWith(TEXT("application/json"), ESearchCase::IgnoreCase) && Result.Body.Num() > 0;
+		if (!bJson && Result.Body.Num() > 0)
+		{
+			Writer->WriteValue(TEXT("content_type"), Result.ContentType);
+			Writer->WriteValue(TEXT("body_base64"), FBase64::Encode(Result.Body.GetData(), Result.Body.Num()));
+		}
+		Writer->WriteObjectEnd();
+		Writer->Close();
+
+		if (Index > 0)
+		{
+			Out += TEXT(",");
+		}
+		if (bJson)
+		{
+			// Handlers already produced JSON; splice it in rather than parse and re-serialize it.
+			Head.LeftChopInline(1);
+			Out += Head;
+			Out += TEXT(",\"body\":");
+			const FUTF8ToTCHAR Body(reinterpret_cast<const ANSICHAR*>(Result.Body.GetData()), Result.Body.Num());
+			Out.AppendChars(Body.Get(), Body.Length());
+			Out += TEXT("}");
+		}
+		else
+		{
+			Out += Head;
+		}
+	}
+	Out += TEXT("]}");
+	return Out;
+}
+} // namespace NovaBridgeCore
@@ -26,6 +26,7 @@ void FCapabilityRegistry::Reset()
 {
 	FScopeLock Lock(&Mutex);
 	Capabilities.Empty();
+	Version.fetch_add(1, std::memory_order_release);
 }
 
 void FCapabilityRegistry::RegisterCapability(const FCapabilityRecord& Capability)
@@ -49,6 +50,7 @@ void FCapabilityRegistry::RegisterCapability(const FCapabilityRecord& Capability
 
 	FScopeLock Lock(&Mutex);
 	Capabilities.Add(MoveTemp(Stored));
+	Version.fetch_add(1, std::memory_order_release);
 }
 
 TArray<FCapabilityRecord> FCapabilityRegistry::Snapshot() const
@@ -57,6 +59,11 @@ TArray<FCapabilityRecord> FCapabilityRegistry::Snapshot() const
 	return Capabilities;
 }
 
+uint64 FCapabilityRegistry::GetVersion() const
+{
+	return Version.load(std::memory_order_acquire);
+}
+
 TSharedPtr<FJsonObject> CapabilityToJson(const FCapabilityRecord& Capability)
 {
 	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
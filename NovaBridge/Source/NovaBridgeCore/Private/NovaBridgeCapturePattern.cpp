@@ -0,0 +1,21 @@
+#include "NovaBridgeCapturePattern.h"
+
+namespace NovaBridgeCore
+{
+void FillSoftwareCapturePattern(int32 Width, int32 Height, TArray<FColor>& OutPixels)
+{
+	Width = FMath::Max(0, Width);
+	Height = FMath::Max(0, Height);
+	OutPixels.SetNumUninitialized(Width * Height);
+	for (int32 Y = 0; Y < Height; ++Y)
+	{
+		for (int32 X = 0; X < Width; ++X)
+		{
+			const uint8 R = static_cast<uint8>((X * 255) / FMath::Max(1, Width - 1));
+			const uint8 G = static_cast<uint8>((Y * 255) / FMath::Max(1, Height - 1));
+			const uint8 B = static_cast<uint8>((((X / 32) + (Y / 32)) & 1) ? 192 : 64);
+			OutPixels[Y * Width + X] = FColor(R, G, B, 255);
+		}
+	}
+}
+} // namespace NovaBridgeCore
@@ -0,0 +1,32 @@
+#include "NovaBridgeDeadline.h"
+
+#include "NovaBridgeHttpUtils.h"
+#include "HAL/PlatformTime.h"
+#include "HttpServerRequest.h"
+
+namespace NovaBridgeCore
+{
+int32 ParseRequestDeadlineMs(const FHttpServerRequest& Request)
+{
+	FString Value = GetHeaderValueCaseInsensitive(Request, TEXT("X-NovaBridge-Deadline"));
+	Value.TrimStartAndEndInline();
+	if (Value.IsEmpty() || Value.Len() > 10)
+	{
+		return 0;
+	}
+	for (const TCHAR Char : Value)
+	{
+		if (!FChar::IsDigit(Char))
+		{
+			return 0;
+		}
+	}
+	const int64 DeadlineMs = FCString::Atoi64(*Value);
+	return DeadlineMs > 0 && DeadlineMs <= MaxRequestDeadlineMs ? static_cast<int32>(DeadlineMs) : 0;
+}
+
+bool FCancellationToken::IsCancelled() const
+{
+	return IsCancelled(FPlatformTime::Seconds());
+}
+} // namespace NovaBridgeCore
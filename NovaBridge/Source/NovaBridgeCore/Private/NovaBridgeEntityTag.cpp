@@ -0,0 +1,109 @@
+#include "NovaBridgeEntityTag.h"
+
+#include "NovaBridgeHttpUtils.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "Misc/Crc.h"
+#include "Misc/Guid.h"
+
+namespace NovaBridgeCore
+{
+namespace
+{
+uint32 GetETagEpoch()
+{
+	static const uint32 Epoch = GetTypeHash(FGuid::NewGuid());
+	return Epoch;
+}
+
+uint32 HashVariantString(const FString& Value, uint32 Hash)
+{
+	// Length first so adjacent fields cannot run together.
+	const int32 Len = Value.Len();
+	Hash = FCrc::MemCrc32(&Len, sizeof(Len), Hash);
+	return FCrc::StrCrc32(*Value, Hash);
+}
+} // namespace
+
+uint32 HashRequestVariant(const FHttpServerRequest& Request, const FString& Role)
+{
+	uint32 Hash = HashVariantString(Request.RelativePath.GetPath(), 0);
+
+	TArray<FString> Keys;
+	Request.QueryParams.GetKeys(Keys);
+	Keys.Sort();
+	for (const FString& Key : Keys)
+	{
+		Hash = HashVariantString(Key, Hash);
+		Hash = HashVariantString(Request.QueryParams.FindChecked(Key), Hash);
+	}
+
+	Hash = HashVariantString(Role, Hash);
+	Hash = HashVariantString(GetHeaderValueCaseInsensitive(Request, TEXT("Accept")), Hash);
+	return HashVariantString(GetHeaderValueCaseInsensitive(Request, TEXT("Accept-Encoding")), Hash);
+}
+
+FString MakeRevisionETag(uint64 Revision, uint32 VariantHash)
+{
+	return FString::Printf(TEXT("\"%08x-%llx-%08x\""), GetETagEpoch(), Revision, VariantHash);
+}
+
+bool MatchesIfNoneMatch(const FHttpServerRequest& Request, const FString& ETag)
+{
+	for (const TPair<FString, TArray<FString>>& Header : Request.Headers)
+	{
+		if (!Header.Key.Equals(TEXT("If-None-Match"), ESearchCase::IgnoreCase))
+		{
+			continue;
+		}
+
+		// The server may have split the list on commas already; split again in case it did not.
+		for (const FString& Value : Header.Value)
+		{
+			TArray<FString> Tags;
+			Value.ParseIntoArray(Tags, TEXT(","), true);
+			for (FString& Tag : Tags)
+			{
+				Tag.TrimStartAndEndInline();
+				if (Tag == TEXT("*"))
+				{
+					return true;
+				}
+				if (Tag.StartsWith(TEXT("W/")))
+				{
+					Tag.RightChopInline(2);
+				}
+				if (Tag == ETag)
+				{
+					return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+TUniquePtr<FHttpServerResponse> MakeNotModifiedResponse(const FString& ETag)
+{
+	TUniquePtr<FHttpServerResponse> Response = MakeUnique<FHttpServerResponse>();
+	Response->Code = EHttpServerResponseCodes::NotModified;
+	Response->Headers.Add(TEXT("ETag"), { ETag });
+	return Response;
+}
+
+FHttpResultCallback WrapResultCallbackWithETag(const FString& ETag, const FHttpResultCallback& OnComplete)
+{
+	return [ETag, OnComplete](TUniquePtr<FHttpServerResponse>&& Response)
+	{
+		if (Response)
+		{
+			const int32 Code = static_cast<int32>(Response->Code);
+			if (Code >= 200 && Code < 300)
+			{
+				Response->Headers.Add(TEXT("ETag"), { ETag });
+			}
+		}
+		OnComplete(MoveTemp(Response));
+	};
+}
+} // namespace NovaBridgeCore
@@ -0,0 +1,121 @@
+#include "NovaBridgeEventRing.h"
+
+#include "Misc/ScopeLock.h"
+
+namespace NovaBridgeCore
+{
+FEventRing::FEventRing(int32 InCapacity)
+{
+	Slots.SetNum(FMath::Max(1, InCapacity));
+}
+
+uint64 FEventRing::TailSeqLocked() const
+{
+	return Count > 0 ? NextSeq - static_cast<uint64>(Count) : 0;
+}
+
+uint64 FEventRing::Push(const FString& Type, TFunctionRef<FString(uint64 Seq)> BuildPayload)
+{
+	FScopeLock Lock(&Mutex);
+	const uint64 Seq = NextSeq++;
+	FEventRecord& Slot = Slots[static_cast<int32>(Seq % static_cast<uint64>(Slots.Num()))];
+	if (Count == Slots.Num())
+	{
+		Dropped++;
+	}
+	else
+	{
+		Count++;
+	}
+
+	// Transcode straight into an exactly sized buffer; this is the only UTF-8 conversion the event sees.
+	const FString Json = BuildPayload(Seq);
+	const int32 Utf8Len = FPlatformString::ConvertedLength<UTF8CHAR>(*Json, Json.Len());
+	TSharedRef<FEventPayload, ESPMode::ThreadSafe> Payload = MakeShared<FEventPayload, ESPMode::ThreadSafe>();
+	Payload->Type = Type;
+	Payload->Utf8.SetNumUninitialized(Utf8Len);
+	FPlatformString::Convert(reinterpret_cast<UTF8CHAR*>(Payload->Utf8.GetData()), Utf8Len, *Json, Json.Len());
+
+	EncodedEvents++;
+	PayloadBytes += static_cast<uint64>(Payload->Utf8.Num());
+
+	Slot.Seq = Seq;
+	Slot.Payload = MoveTemp(Payload);
+	return Seq;
+}
+
+void FEventRing::RecordFanoutSends(uint64 Sends)
+{
+	FanoutSends.fetch_add(Sends, std::memory_order_relaxed);
+}
+
+bool FEventRing::CopySince(uint64 AfterSeq, TArray<FEventRecord>& OutEvents) const
+{
+	FScopeLock Lock(&Mutex);
+	const uint64 TailSeq = Count > 0 ? TailSeqLocked() : NextSeq;
+	const uint64 FirstSeq = FMath::Max(AfterSeq + 1, TailSeq);
+	if (FirstSeq < NextSeq)
+	{
+		OutEvents.Reserve(OutEvents.Num() + static_cast<int32>(NextSeq - FirstSeq));
+	}
+	for (uint64 Seq = FirstSeq; Seq < NextSeq; ++Seq)
+	{
+		OutEvents.Add(Slots[static_cast<int32>(Seq % static_cast<uint64>(Slots.Num()))]);
+	}
+
+	return AfterSeq + 1 >= TailSeq && AfterSeq < NextSeq;
+}
+
+bool FEventRing::CanReplayFrom(uint64 AfterSeq) const
+{
+	FScopeLock Lock(&Mutex);
+	const uint64 TailSeq = Count > 0 ? TailSeqLocked() : NextSeq;
+
+	// A cursor ahead of the head comes from an earlier process, so it cannot be trusted either.
+	return AfterSeq + 1 >= TailSeq && AfterSeq < NextSeq;
+}
+
+void FEventRing::CopyTypesSince(uint64 AfterSeq, TArray<FString>& OutTypes) const
+{
+	FScopeLock Lock(&Mutex);
+	if (Count == 0)
+	{
+		return;
+	}
+
+	for (uint64 Seq = FMath::Max(AfterSeq + 1, TailSeqLocked()); Seq < NextSeq; ++Seq)
+	{
+		const FEventRecord& Slot = Slots[static_cast<int32>(Seq % static_cast<uint64>(Slots.Num()))];
+		OutTypes.Add(Slot.Payload.IsValid() ? Slot.Payload->Type : FString());
+	}
+}
+
+FEventRingStats FEventRing::GetStats() const
+{
+	FScopeLock Lock(&Mutex);
+	FEventRingStats Stats;
+	Stats.HeadSeq = NextSeq - 1;
+	Stats.TailSeq = TailSeqLocked();
+	Stats.Dropped = Dropped;
+	Stats.Count = Count;
+	Stats.Capacity = Slots.Num();
+	Stats.EncodedEvents = EncodedEvents;
+	Stats.PayloadBytes = PayloadBytes;
+	Stats.FanoutSends = FanoutSends.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+void FEventRing::Reset()
+{
+	FScopeLock Lock(&Mutex);
+	for (FEventRecord& Slot : Slots)
+	{
+		Slot = FEventRecord();
+	}
+	Dropped = 0;
+	Count = 0;
+	EncodedEvents = 0;
+	PayloadBytes = 0;
+	FanoutSends.store(0, std::memory_order_relaxed);
+}
+} // namespace NovaBridgeCore
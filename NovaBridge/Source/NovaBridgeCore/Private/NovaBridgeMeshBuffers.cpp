@@ -0,0 +1,276 @@
+#include "NovaBridgeMeshBuffers.h"
+
+#include "Dom/JsonValue.h"
+#include "Misc/Base64.h"
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "Mesh streams are copied straight from little-endian wire bytes");
+
+namespace NovaBridgeCore
+{
+namespace
+{
+constexpr uint8 MeshBinaryMagic[4] = { 'N', 'B', 'M', 'S' };
+
+uint32 ReadUInt32(const uint8* Data)
+{
+	uint32 Value = 0;
+	FMemory::Memcpy(&Value, Data, sizeof(Value));
+	return Value;
+}
+
+template <typename ElementType>
+void CopyStream(const uint8*& Cursor, int32 Count, TArray<ElementType>& Out)
+{
+	Out.SetNumUninitialized(Count);
+	const int64 Bytes = static_cast<int64>(Count) * sizeof(ElementType);
+	FMemory::Memcpy(Out.GetData(), Cursor, Bytes);
+	Cursor += Bytes;
+}
+
+template <typename ElementType>
+void AppendStream(TArray<uint8>& Bytes, const ElementType* Elements, int32 Count)
+{
+	Bytes.Append(reinterpret_cast<const uint8*>(Elements), Count * static_cast<int32>(sizeof(ElementType)));
+}
+
+template <typename ElementType>
+bool DecodeBase64Stream(const FJsonObject& Body, const TCHAR* Field, TArray<ElementType>& Out, FString& OutError)
+{
+	FString Encoded;
+	if (!Body.TryGetStringField(Field, Encoded))
+	{
+		return true;
+	}
+
+	TArray<uint8> Bytes;
+	if (!FBase64::Decode(Encoded, Bytes))
+	{
+		OutError = FString::Printf(TEXT("'%s' is not valid base64"), Field);
+		return false;
+	}
+	constexpr int32 ElementSize = static_cast<int32>(sizeof(ElementType));
+	if (Bytes.Num() % ElementSize != 0)
+	{
+		OutError = FString::Printf(TEXT("'%s' length %d is not a multiple of %d bytes"), Field, Bytes.Num(), ElementSize);
+		return false;
+	}
+
+	Out.SetNumUninitialized(Bytes.Num() / ElementSize);
+	FMemory::Memcpy(Out.GetData(), Bytes.GetData(), Bytes.Num());
+	return true;
+}
+
+double NumberOrZero(const FJsonObject& Object, const TCHAR* Field)
+{
+	double Value = 0.0;
+	Object.TryGetNumberField(Field, Value);
+	return Value;
+}
+
+bool ParseLegacyMeshJson(const FJsonObject& Body, FMeshBuffers& OutMesh, FString& OutError)
+{
+	const TArray<TSharedPtr<FJsonValue>>* Vertices = nullptr;
+	const TArray<TSharedPtr<FJsonValue>>* Triangles = nullptr;
+	if (!Body.TryGetArrayField(TEXT("vertices"), Vertices) || !Body.TryGetArrayField(TEXT("triangles"), Triangles))
+	{
+		OutError = TEXT("Missing 'vertices'/'triangles' arrays or 'positions'/'indices' streams");
+		return false;
+	}
+	if (Vertices->Num() > MaxMeshVertices || Triangles->Num() > MaxMeshIndices / 3)
+	{
+		OutError = TEXT("Mesh exceeds the vertex or index limit");
+		return false;
+	}
+
+	const int32 VertexCount = Vertices->Num();
+	OutMesh.Positions.SetNumUninitialized(VertexCount);
+	for (int32 Index = 0; Index < VertexCount; ++Index)
+	{
+		const TSharedPtr<FJsonObject>* Vertex = nullptr;
+		if (!(*Vertices)[Index].IsValid() || !(*Vertices)[Index]->TryGetObject(Vertex))
+		{
+			OutError = FString::Printf(TEXT("vertices[%d] is not an object"), Index);
+			return false;
+		}
+
+		const FJsonObject& V = **Vertex;
+		OutMesh.Positions[Index] = FVector3f(NumberOrZero(V, TEXT("x")), NumberOrZero(V, TEXT("y")), NumberOrZero(V, TEXT("z")));
+
+		// Vertices without a UV or normal keep the zero default, as the builder would leave them.
+		if (V.HasField(TEXT("u")))
+		{
+			OutMesh.UVs.SetNumZeroed(VertexCount);
+			OutMesh.UVs[Index] = FVector2f(NumberOrZero(V, TEXT("u")), NumberOrZero(V, TEXT("v")));
+		}
+		if (V.HasField(TEXT("nx")))
+		{
+			OutMesh.Normals.SetNumZeroed(VertexCount);
+			OutMesh.Normals[Index] = FVector3f(NumberOrZero(V, TEXT("nx")), NumberOrZero(V, TEXT("ny")), NumberOrZero(V, TEXT("nz")));
+		}
+	}
+
+	OutMesh.Indices.SetNumUninitialized(Triangles->Num() * 3);
+	for (int32 Index = 0; Index < Triangles->Num(); ++Index)
+	{
+		const TSharedPtr<FJsonObject>* Triangle = nullptr;
+		if (!(*Triangles)[Index].IsValid() || !(*Triangles)[Index]->TryGetObject(Triangle))
+		{
+			OutError = FString::Printf(TEXT("triangles[%d] is not an object"), Index);
+			return false;
+		}
+
+		const TCHAR* Corners[3] = { TEXT("i0"), TEXT("i1"), TEXT("i2") };
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const double Value = NumberOrZero(**Triangle, Corners[Corner]);
+			if (Value < 0.0 || Value >= static_cast<double>(MAX_uint32))
+			{
+				OutError = FString::Printf(TEXT("triangles[%d].%s is out of range"), Index, Corners[Corner]);
+				return false;
+			}
+			OutMesh.Indices[Index * 3 + Corner] = static_cast<uint32>(Value);
+		}
+	}
+	return true;
+}
+} // namespace
+
+bool ParseMeshBinary(const uint8* Data, int64 Size, FMeshBuffers& OutMesh, FString& OutError)
+{
+	if (!Data || Size < MeshBinaryHeaderSize || FMemory::Memcmp(Data, MeshBinaryMagic, sizeof(MeshBinaryMagic)) != 0)
+	{
+		OutError = TEXT("Binary mesh body must start with the 'NBMS' header");
+		return false;
+	}
+
+	const uint32 Version = ReadUInt32(Data + 4);
+	const uint32 Flags = ReadUInt32(Data + 8);
+	const uint32 VertexCount = ReadUInt32(Data + 12);
+	const uint32 IndexCount = ReadUInt32(Data + 16);
+	if (Version != MeshBinaryVersion)
+	{
+		OutError = FString::Printf(TEXT("Unsupported binary mesh version %u"), Version);
+		return false;
+	}
+	if (VertexCount > static_cast<uint32>(MaxMeshVertices) || IndexCount > static_cast<uint32>(MaxMeshIndices))
+	{
+		OutError = TEXT("Mesh exceeds the vertex or index limit");
+		return false;
+	}
+
+	const bool bHasNormals = (Flags & MeshBinaryFlagNormals) != 0;
+	const bool bHasUVs = (Flags & MeshBinaryFlagUVs) != 0;
+	const int64 ExpectedSize = MeshBinaryHeaderSize
+		+ static_cast<int64>(VertexCount) * sizeof(FVector3f) * (bHasNormals ? 2 : 1)
+		+ static_cast<int64>(VertexCount) * (bHasUVs ? sizeof(FVector2f) : 0)
+		+ static_cast<int64>(IndexCount) * sizeof(uint32);
+	if (Size != ExpectedSize)
+	{
+		OutError = FString::Printf(TEXT("Binary mesh body is %lld bytes, header describes %lld"), Size, ExpectedSize);
+		return false;
+	}
+
+	const uint8* Cursor = Data + MeshBinaryHeaderSize;
+	CopyStream(Cursor, static_cast<int32>(VertexCount), OutMesh.Positions);
+	if (bHasNormals)
+	{
+		CopyStream(Cursor, static_cast<int32>(VertexCount), OutMesh.Normals);
+	}
+	if (bHasUVs)
+	{
+		CopyStream(Cursor, static_cast<int32>(VertexCount), OutMesh.UVs);
+	}
+	CopyStream(Cursor, static_cast<int32>(IndexCount), OutMesh.Indices);
+	return true;
+}
+
+bool ParseMeshJson(const FJsonObject& Body, FMeshBuffers& OutMesh, FString& OutError)
+{
+	if (!Body.HasTypedField<EJson::String>(TEXT("positions")))
+	{
+		return ParseLegacyMeshJson(Body, OutMesh, OutError);
+	}
+
+	if (!Body.HasTypedField<EJson::String>(TEXT("indices")))
+	{
+		OutError = TEXT("Missing 'indices' stream");
+		return false;
+	}
+	return DecodeBase64Stream(Body, TEXT("positions"), OutMesh.Positions, OutError)
+		&& DecodeBase64Stream(Body, TEXT("normals"), OutMesh.Normals, OutError)
+		&& DecodeBase64Stream(Body, TEXT("uvs"), OutMesh.UVs, OutError)
+		&& DecodeBase64Stream(Body, TEXT("indices"), OutMesh.Indices, OutError);
+}
+
+bool ValidateMeshBuffers(const FMeshBuffers& Mesh, FString& OutError)
+{
+	const int32 VertexCount = Mesh.Positions.Num();
+	if (VertexCount == 0 || Mesh.Indices.Num() == 0)
+	{
+		OutError = TEXT("Mesh needs at least one vertex and one triangle");
+		return false;
+	}
+	if (VertexCount > MaxMeshVertices || Mesh.Indices.Num() > MaxMeshIndices)
+	{
+		OutError = TEXT("Mesh exceeds the vertex or index limit");
+		return false;
+	}
+	if (Mesh.Indices.Num() % 3 != 0)
+	{
+		OutError = FString::Printf(TEXT("Index count %d is not a multiple of 3"), Mesh.Indices.Num());
+		return false;
+	}
+	if ((Mesh.Normals.Num() != 0 && Mesh.Normals.Num() != VertexCount) || (Mesh.UVs.Num() != 0 && Mesh.UVs.Num() != VertexCount))
+	{
+		OutError = TEXT("Normal and UV streams must have one entry per vertex");
+		return false;
+	}
+
+	for (int32 Index = 0; Index < Mesh.Indices.Num(); ++Index)
+	{
+		if (Mesh.Indices[Index] >= static_cast<uint32>(VertexCount))
+		{
+			OutError = FString::Printf(TEXT("Index %u at %d is out of range for %d vertices"), Mesh.Indices[Index], Index, VertexCount);
+			return false;
+		}
+	}
+
+	// Scan the float streams as flat arrays; one non-finite component poisons the whole build.
+	auto AllFinite = [](const float* Values, int64 Count)
+	{
+		for (int64 Index = 0; Index < Count; ++Index)
+		{
+			if (!FMath::IsFinite(Values[Index]))
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+	if (!AllFinite(&Mesh.Positions.GetData()->X, VertexCount * 3LL)
+		|| (Mesh.Normals.Num() > 0 && !AllFinite(&Mesh.Normals.GetData()->X, VertexCount * 3LL))
+		|| (Mesh.UVs.Num() > 0 && !AllFinite(&Mesh.UVs.GetData()->X, VertexCount * 2LL)))
+	{
+		OutError = TEXT("Mesh streams contain NaN or infinite values");
+		return false;
+	}
+	return true;
+}
+
+TArray<uint8> EncodeMeshBinary(const FMeshBuffers& Mesh)
+{
+	const uint32 Flags = (Mesh.Normals.Num() > 0 ? MeshBinaryFlagNormals : 0) | (Mesh.UVs.Num() > 0 ? MeshBinaryFlagUVs : 0);
+	const uint32 Header[4] = { MeshBinaryVersion, Flags, static_cast<uint32>(Mesh.Positions.Num()), static_cast<uint32>(Mesh.Indices.Num()) };
+
+	TArray<uint8> Bytes;
+	Bytes.Reserve(static_cast<int32>(MeshBinaryHeaderSize + Mesh.Positions.GetAllocatedSize() + Mesh.Normals.GetAllocatedSize()
+		+ Mesh.UVs.GetAllocatedSize() + Mesh.Indices.GetAllocatedSize()));
+	Bytes.Append(MeshBinaryMagic, UE_ARRAY_COUNT(MeshBinaryMagic));
+	AppendStream(Bytes, Header, UE_ARRAY_COUNT(Header));
+	AppendStream(Bytes, Mesh.Positions.GetData(), Mesh.Positions.Num());
+	AppendStream(Bytes, Mesh.Normals.GetData(), Mesh.Normals.Num());
+	AppendStream(Bytes, Mesh.UVs.GetData(), Mesh.UVs.Num());
+	AppendStream(Bytes, Mesh.Indices.GetData(), Mesh.Indices.Num());
+	return Bytes;
+}
+} // namespace NovaBridgeCore
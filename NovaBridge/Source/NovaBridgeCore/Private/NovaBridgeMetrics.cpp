@@ -0,0 +1,271 @@
+#include "NovaBridgeMetrics.h"
+
+#include "Misc/ScopeLock.h"
+
+namespace NovaBridgeCore
+{
+namespace
+{
+struct FPrometheusQuantile
+{
+	double Value;
+	const TCHAR* Label;
+};
+
+const FPrometheusQuantile PrometheusQuantiles[] = {
+	{ 0.5, TEXT("0.5") },
+	{ 0.9, TEXT("0.9") },
+	{ 0.99, TEXT("0.99") },
+	{ 0.999, TEXT("0.999") },
+};
+
+FString EscapePrometheusLabel(const FString& Value)
+{
+	FString Escaped = Value.Replace(TEXT("\\"), TEXT("\\\\"));
+	Escaped = Escaped.Replace(TEXT("\""), TEXT("\\\""));
+	return Escaped;
+}
+
+void AppendSummary(
+	FString& Out,
+	const FString& MetricName,
+	const FString& Labels,
+	const FLatencyHistogram& Histogram,
+	double Scale)
+{
+	for (const FPrometheusQuantile& Quantile : PrometheusQuantiles)
+	{
+		Out += FString::Printf(
+			TEXT("%s{%s,quantile=\"%s\"} %.6f\n"),
+			*MetricName,
+			*Labels,
+			Quantile.Label,
+			static_cast<double>(Histogram.ValueAtQuantile(Quantile.Value)) * Scale);
+	}
+	Out += FString::Printf(TEXT("%s_sum{%s} %.6f\n"), *MetricName, *Labels, static_cast<double>(Histogram.GetSum()) * Scale);
+	Out += FString::Printf(TEXT("%s_count{%s} %llu\n"), *MetricName, *Labels, Histogram.GetCount());
+}
+} // namespace
+
+FLatencyHistogram::FLatencyHistogram()
+{
+	Reset();
+}
+
+int32 FLatencyHistogram::BucketIndexForValue(uint64 Value)
+{
+	const uint64 MaxValue = (uint64(1) << MaxValueBits) - 1;
+	Value = FMath::Min(Value, MaxValue);
+	if (Value < static_cast<uint64>(SubBucketCount))
+	{
+		return static_cast<int32>(Value);
+	}
+
+	const int32 HighestBit = static_cast<int32>(FMath::FloorLog2_64(Value));
+	const int32 Shift = HighestBit - SubBucketBits;
+	const int32 SubBucket = static_cast<int32>((Value >> Shift) & (SubBucketCount - 1));
+	return (Shift + 1) * SubBucketCount + SubBucket;
+}
+
+uint64 FLatencyHistogram::BucketUpperBound(int32 BucketIndex)
+{
+	BucketIndex = FMath::Clamp(BucketIndex, 0, BucketCount - 1);
+	if (BucketIndex < SubBucketCount)
+	{
+		return static_cast<uint64>(BucketIndex);
+	}
+
+	const int32 Shift = (BucketIndex / SubBucketCount) - 1;
+	const uint64 SubBucket = static_cast<uint64>(BucketIndex % SubBucketCount);
+	const uint64 LowerBound = (static_cast<uint64>(SubBucketCount) + SubBucket) << Shift;
+	return LowerBound + ((uint64(1) << Shift) - 1);
+}
+
+void FLatencyHistogram::Record(uint64 Value)
+{
+	Buckets[BucketIndexForValue(Value)].fetch_add(1, std::memory_order_relaxed);
+	Count.fetch_add(1, std::memory_order_relaxed);
+	Sum.fetch_add(Value, std::memory_order_relaxed);
+
+	uint64 PreviousMax = Max.load(std::memory_order_relaxed);
+	while (Value > PreviousMax && !Max.compare_exchange_weak(PreviousMax, Value, std::memory_order_relaxed))
+	{
+	}
+}
+
+void FLatencyHistogram::Reset()
+{
+	for (std::atomic<uint64>& Bucket : Buckets)
+	{
+		Bucket.store(0, std::memory_order_relaxed);
+	}
+	Count.store(0, std::memory_order_relaxed);
+	Sum.store(0, std::memory_order_relaxed);
+	Max.store(0, std::memory_order_relaxed);
+}
+
+uint64 FLatencyHistogram::GetCount() const
+{
+	return Count.load(std::memory_order_relaxed);
+}
+
+uint64 FLatencyHistogram::GetSum() const
+{
+	return Sum.load(std::memory_order_relaxed);
+}
+
+uint64 FLatencyHistogram::GetMax() const
+{
+	return Max.load(std::memory_order_relaxed);
+}
+
+uint64 FLatencyHistogram::ValueAtQuantile(double Quantile) const
+{
+	// Sum the buckets rather than trusting Count, which may run ahead of them under concurrent Record().
+	uint64 Total = 0;
+	for (const std::atomic<uint64>& Bucket : Buckets)
+	{
+		Total += Bucket.load(std::memory_order_relaxed);
+	}
+	if (Total == 0)
+	{
+		return 0;
+	}
+
+	const uint64 Target = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(FMath::Clamp(Quantile, 0.0, 1.0) * static_cast<double>(Total))));
+	uint64 Cumulative = 0;
+	for (int32 BucketIndex = 0; BucketIndex < BucketCount; ++BucketIndex)
+	{
+		Cumulative += Buckets[BucketIndex].load(std::memory_order_relaxed);
+		if (Cumulative >= Target)
+		{
+			return FMath::Min(BucketUpperBound(BucketIndex), GetMax());
+		}
+	}
+	return GetMax();
+}
+
+void FRouteMetrics::RecordStatus(int32 StatusCode)
+{
+	if (StatusCode >= 500)
+	{
+		Responses5xx.fetch_add(1, std::memory_order_relaxed);
+	}
+	else if (StatusCode >= 400)
+	{
+		Responses4xx.fetch_add(1, std::memory_order_relaxed);
+	}
+	else if (StatusCode >= 300)
+	{
+		Responses3xx.fetch_add(1, std::memory_order_relaxed);
+	}
+	else
+	{
+		Responses2xx.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+void FRouteMetrics::Reset()
+{
+	CheckUs.Reset();
+	QueueWaitUs.Reset();
+	HandlerUs.Reset();
+	SerializeUs.Reset();
+	ResponseBytes.Reset();
+	CompressUs.Reset();
+	CompressionRatioPermille.Reset();
+	Responses2xx.store(0, std::memory_order_relaxed);
+	Responses3xx.store(0, std::memory_order_relaxed);
+	Responses4xx.store(0, std::memory_order_relaxed);
+	Responses5xx.store(0, std::memory_order_relaxed);
+	DroppedExpired.store(0, std::memory_order_relaxed);
+	Cancelled.store(0, std::memory_order_relaxed);
+}
+
+FRouteMetricsRegistry& FRouteMetricsRegistry::Get()
+{
+	static FRouteMetricsRegistry Registry;
+	return Registry;
+}
+
+void FRouteMetricsRegistry::Reset()
+{
+	FScopeLock Lock(&Mutex);
+	for (const TUniquePtr<FRouteMetrics>& Metrics : Routes)
+	{
+		Metrics->Reset();
+	}
+}
+
+FRouteMetrics* FRouteMetricsRegistry::RegisterRoute(const FString& Route)
+{
+	FScopeLock Lock(&Mutex);
+	for (const TUniquePtr<FRouteMetrics>& Existing : Routes)
+	{
+		if (Existing->Route == Route)
+		{
+			return Existing.Get();
+		}
+	}
+
+	TUniquePtr<FRouteMetrics> Metrics = MakeUnique<FRouteMetrics>();
+	Metrics->Route = Route;
+	FRouteMetrics* Registered = Metrics.Get();
+	Routes.Add(MoveTemp(Metrics));
+	return Registered;
+}
+
+FString FRouteMetricsRegistry::BuildPrometheusText(const FString& MetricPrefix) const
+{
+	struct FSeries
+	{
+		const TCHAR* Suffix;
+		const TCHAR* Help;
+		FLatencyHistogram FRouteMetrics::*Histogram;
+		double Scale;
+	};
+	const FSeries Series[] = {
+		{ TEXT("check_seconds"), TEXT("Time spent in auth, role and rate-limit checks."), &FRouteMetrics::CheckUs, 1.0e-6 },
+		{ TEXT("queue_wait_seconds"), TEXT("Time from game-thread enqueue to task start."), &FRouteMetrics::QueueWaitUs, 1.0e-6 },
+		{ TEXT("handler_seconds"), TEXT("Time spent running handler code."), &FRouteMetrics::HandlerUs, 1.0e-6 },
+		{ TEXT("serialize_seconds"), TEXT("Time spent serializing the response body."), &FRouteMetrics::SerializeUs, 1.0e-6 },
+		{ TEXT("response_bytes"), TEXT("Response body size."), &FRouteMetrics::ResponseBytes, 1.0 },
+		{ TEXT("compress_seconds"), TEXT("Worker time spent compressing the response body."), &FRouteMetrics::CompressUs, 1.0e-6 },
+		{ TEXT("compression_ratio"), TEXT("Compressed size over original size for compressed responses."), &FRouteMetrics::CompressionRatioPermille, 1.0e-3 },
+	};
+
+	FScopeLock Lock(&Mutex);
+	FString Out;
+	for (const FSeries& Entry : Series)
+	{
+		const FString MetricName = FString::Printf(TEXT("%s_route_%s"), *MetricPrefix, Entry.Suffix);
+		Out += FString::Printf(TEXT("# HELP %s %s\n# TYPE %s summary\n"), *MetricName, Entry.Help, *MetricName);
+		for (const TUniquePtr<FRouteMetrics>& Route : Routes)
+		{
+			const FString Labels = FString::Printf(TEXT("route=\"%s\""), *EscapePrometheusLabel(Route->Route));
+			AppendSummary(Out, MetricName, Labels, (*Route).*(Entry.Histogram), Entry.Scale);
+		}
+	}
+
+	const FString ResponsesName = FString::Printf(TEXT("%s_route_responses_total"), *MetricPrefix);
+	Out += FString::Printf(TEXT("# HELP %s Responses by status class.\n# TYPE %s counter\n"), *ResponsesName, *ResponsesName);
+	for (const TUniquePtr<FRouteMetrics>& Route : Routes)
+	{
+		const FString Labels = FString::Printf(TEXT("route=\"%s\""), *EscapePrometheusLabel(Route->Route));
+		Out += FString::Printf(TEXT("%s{%s,class=\"2xx\"} %llu\n"), *ResponsesName, *Labels, Route->Responses2xx.load(std::memory_order_relaxed));
+		Out += FString::Printf(TEXT("%s{%s,class=\"3xx\"} %llu\n"), *ResponsesName, *Labels, Route->Responses3xx.load(std::memory_order_relaxed));
+		Out += FString::Printf(TEXT("%s{%s,class=\"4xx\"} %llu\n"), *ResponsesName, *Labels, Route->Responses4xx.load(std::memory_order_relaxed));
+		Out += FString::Printf(TEXT("%s{%s,class=\"5xx\"} %llu\n"), *ResponsesName, *Labels, Route->Responses5xx.load(std::memory_order_relaxed));
+	}
+
+	const FString DroppedName = FString::Printf(TEXT("%s_route_dropped_total"), *MetricPrefix);
+	Out += FString::Printf(TEXT("# HELP %s Work abandoned after the request deadline passed.\n# TYPE %s counter\n"), *DroppedName, *DroppedName);
+	for (const TUniquePtr<FRouteMetrics>& Route : Routes)
+	{
+		const FString Labels = FString::Printf(TEXT("route=\"%s\""), *EscapePrometheusLabel(Route->Route));
+		Out += FString::Printf(TEXT("%s{%s,reason=\"expired\"} %llu\n"), *DroppedName, *Labels, Route->DroppedExpired.load(std::memory_order_relaxed));
+		Out += FString::Printf(TEXT("%s{%s,reason=\"cancelled\"} %llu\n"), *DroppedName, *Labels, Route->Cancelled.load(std::memory_order_relaxed));
+	}
+	return Out;
+}
+} // namespace NovaBridgeCore
@@ -0,0 +1,792 @@
+#include "NovaBridgeModelImport.h"
+
+#include "Async/MappedFileHandle.h"
+#include "Async/ParallelFor.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace NovaBridgeCore
+{
+namespace
+{
+// ---- OBJ ----
+
+enum EObjAttribute : int32
+{
+	ObjPosition = 0,
+	ObjUV = 1,
+	ObjNormal = 2,
+	ObjAttributeCount = 3,
+};
+
+struct FObjCorner
+{
+	int32 Index[ObjAttributeCount] = { INDEX_NONE, INDEX_NONE, INDEX_NONE };
+	// Bit N set: Index[N] came from a negative (relative) reference and is local to the parsing chunk.
+	uint8 RelativeMask = 0;
+};
+
+struct FObjChunk
+{
+	const uint8* Begin = nullptr;
+	const uint8* End = nullptr;
+	TArray<FVector3f> Positions;
+	TArray<FVector2f> UVs;
+	TArray<FVector3f> Normals;
+	TArray<FObjCorner> Corners;
+	int32 Faces = 0;
+	int32 Base[ObjAttributeCount] = {};
+	int32 CornerBase = 0;
+};
+
+bool IsObjSpace(uint8 C)
+{
+	return C == ' ' || C == '\t' || C == '\r';
+}
+
+bool IsObjDigit(uint8 C)
+{
+	return C >= '0' && C <= '9';
+}
+
+const uint8* SkipObjSpaces(const uint8* P, const uint8* End)
+{
+	while (P < End && IsObjSpace(*P))
+	{
+		++P;
+	}
+	return P;
+}
+
+bool ParseObjInt(const uint8*& P, const uint8* End, int32& Out)
+{
+	const uint8* C = P;
+	const bool bNegative = C < End && *C == '-';
+	if (C < End && (*C == '-' || *C == '+'))
+	{
+		++C;
+	}
+	if (C >= End || !IsObjDigit(*C))
+	{
+		return false;
+	}
+
+	int64 Value = 0;
+	while (C < End && IsObjDigit(*C))
+	{
+		Value = FMath::Min<int64>(Value * 10 + (*C - '0'), MAX_int32);
+		++C;
+	}
+	Out = static_cast<int32>(bNegative ? -Value : Value);
+	P = C;
+	return true;
+}
+
+bool ParseObjFloat(const uint8*& P, const uint8* End, float& Out)
+{
+	const uint8* C = SkipObjSpaces(P, End);
+	const bool bNegative = C < End && *C == '-';
+	if (C < End && (*C == '-' || *C == '+'))
+	{
+		++C;
+	}
+
+	double Mantissa = 0.0;
+	int32 Exponent = 0;
+	bool bDigits = false;
+	for (; C < End && IsObjDigit(*C); ++C)
+	{
+		Mantissa = Mantissa * 10.0 + (*C - '0');
+		bDigits = true;
+	}
+	if (C < End && *C == '.')
+	{
+		for (++C; C < End && IsObjDigit(*C); ++C)
+		{
+			Mantissa = Mantissa * 10.0 + (*C - '0');
+			--Exponent;
+			bDigits = true;
+		}
+	}
+	if (!bDigits)
+	{
+		return false;
+	}
+
+	if (C < End && (*C == 'e' || *C == 'E'))
+	{
+		const uint8* ExponentStart = C + 1;
+		int32 ExplicitExponent = 0;
+		if (ParseObjInt(ExponentStart, End, ExplicitExponent))
+		{
+			Exponent += FMath::Clamp(ExplicitExponent, -400, 400);
+			C = ExponentStart;
+		}
+	}
+
+	double Value = Exponent >= 0 ? Mantissa * FMath::Pow(10.0, static_cast<double>(Exponent)) : Mantissa / FMath::Pow(10.0, static_cast<double>(-Exponent));
+	Out = static_cast<float>(bNegative ? -Value : Value);
+	P = C;
+	return true;
+}
+
+template <int32 Count>
+bool ParseObjFloats(const uint8* P, const uint8* End, float (&Out)[Count])
+{
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		if (!ParseObjFloat(P, End, Out[Index]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void ParseObjFace(const uint8* P, const uint8* End, FObjChunk& Chunk)
+{
+	const int32 LocalCount[ObjAttributeCount] = { Chunk.Positions.Num(), Chunk.UVs.Num(), Chunk.Normals.Num() };
+	TArray<FObjCorner, TInlineAllocator<8>> FaceCorners;
+	while (true)
+	{
+		P = SkipObjSpaces(P, End);
+		if (P >= End)
+		{
+			break;
+		}
+
+		// v, v/vt, v//vn or v/vt/vn; OBJ indices are 1-based, negative ones count back from the latest element.
+		FObjCorner Corner;
+		for (int32 Attribute = 0; Attribute < ObjAttributeCount; ++Attribute)
+		{
+			if (Attribute > 0)
+			{
+				if (P >= End || *P != '/')
+				{
+					break;
+				}
+				++P;
+			}
+
+			int32 Value = 0;
+			if (ParseObjInt(P, End, Value) && Value != 0)
+			{
+				if (Value > 0)
+				{
+					Corner.Index[Attribute] = Value - 1;
+				}
+				else
+				{
+					Corner.Index[Attribute] = LocalCount[Attribute] + Value;
+					Corner.RelativeMask |= static_cast<uint8>(1u << Attribute);
+				}
+			}
+		}
+		while (P < End && !IsObjSpace(*P))
+		{
+			++P;
+		}
+		FaceCorners.Add(Corner);
+	}
+
+	if (FaceCorners.Num() < 3)
+	{
+		return;
+	}
+
+	++Chunk.Faces;
+	for (int32 Index = 1; Index + 1 < FaceCorners.Num(); ++Index)
+	{
+		Chunk.Corners.Add(FaceCorners[0]);
+		Chunk.Corners.Add(FaceCorners[Index]);
+		Chunk.Corners.Add(FaceCorners[Index + 1]);
+	}
+}
+
+void ParseObjLine(const uint8* P, const uint8* End, FObjChunk& Chunk)
+{
+	P = SkipObjSpaces(P, End);
+	if (End - P < 2)
+	{
+		return;
+	}
+
+	if (P[0] == 'v' && IsObjSpace(P[1]))
+	{
+		float Values[3];
+		if (ParseObjFloats(P + 2, End, Values))
+		{
+			Chunk.Positions.Add(FVector3f(Values[0], Values[1], Values[2]));
+		}
+	}
+	else if (P[0] == 'v' && End - P > 2 && IsObjSpace(P[2]) && (P[1] == 't' || P[1] == 'n'))
+	{
+		if (P[1] == 't')
+		{
+			float Values[2];
+			if (ParseObjFloats(P + 3, End, Values))
+			{
+				Chunk.UVs.Add(FVector2f(Values[0], Values[1]));
+			}
+		}
+		else
+		{
+			float Values[3];
+			if (ParseObjFloats(P + 3, End, Values))
+			{
+				Chunk.Normals.Add(FVector3f(Values[0], Values[1], Values[2]));
+			}
+		}
+	}
+	else if (P[0] == 'f' && IsObjSpace(P[1]))
+	{
+		ParseObjFace(P + 2, End, Chunk);
+	}
+}
+
+void ParseObjChunk(FObjChunk& Chunk)
+{
+	const uint8* LineStart = Chunk.Begin;
+	while (LineStart < Chunk.End)
+	{
+		const uint8* LineEnd = LineStart;
+		while (LineEnd < Chunk.End && *LineEnd != '\n')
+		{
+			++LineEnd;
+		}
+		ParseObjLine(LineStart, LineEnd, Chunk);
+		LineStart = LineEnd + 1;
+	}
+}
+
+int32 ResolveObjIndex(const FObjCorner& Corner, int32 Attribute, const FObjChunk& Chunk)
+{
+	const int32 Index = Corner.Index[Attribute];
+	return (Corner.RelativeMask & (1u << Attribute)) != 0 ? Chunk.Base[Attribute] + Index : Index;
+}
+
+template <typename ElementType>
+void GatherChunkStreams(const TArray<FObjChunk>& Chunks, int32 Total, TArray<ElementType> FObjChunk::* Member, int32 Attribute, TArray<ElementType>& Out)
+{
+	Out.SetNumUninitialized(Total);
+	ParallelFor(Chunks.Num(), [&Chunks, Member, Attribute, &Out](int32 ChunkIndex)
+	{
+		const FObjChunk& Chunk = Chunks[ChunkIndex];
+		const TArray<ElementType>& Source = Chunk.*Member;
+		if (Source.Num() > 0)
+		{
+			FMemory::Memcpy(Out.GetData() + Chunk.Base[Attribute], Source.GetData(), Source.Num() * sizeof(ElementType));
+		}
+	});
+}
+
+// ---- GLB ----
+
+constexpr uint32 GlbMagic = 0x46546C67; // "glTF"
+constexpr uint32 GlbChunkJson = 0x4E4F534A; // "JSON"
+constexpr uint32 GlbChunkBin = 0x004E4942; // "BIN\0"
+constexpr int32 GltfUnsignedByte = 5121;
+constexpr int32 GltfUnsignedShort = 5123;
+constexpr int32 GltfUnsignedInt = 5125;
+constexpr int32 GltfFloat = 5126;
+constexpr int32 GltfTriangles = 4;
+
+uint32 ReadLittleUInt32(const uint8* Data)
+{
+	uint32 Value = 0;
+	FMemory::Memcpy(&Value, Data, sizeof(Value));
+	return Value;
+}
+
+struct FGlbAccessor
+{
+	const uint8* Data = nullptr;
+	int32 Count = 0;
+	int32 Stride = 0;
+	int32 ComponentType = 0;
+};
+
+struct FGlbPrimitive
+{
+	FGlbAccessor Positions;
+	FGlbAccessor Normals;
+	FGlbAccessor UVs;
+	FGlbAccessor Indices;
+	bool bIndexed = false;
+	int32 VertexBase = 0;
+	int32 IndexBase = 0;
+	int32 IndexCount = 0;
+};
+
+int32 GltfComponentSize(int32 ComponentType)
+{
+	switch (ComponentType)
+	{
+	case GltfUnsignedByte:
+		return 1;
+	case GltfUnsignedShort:
+		return 2;
+	case GltfUnsignedInt:
+	case GltfFloat:
+		return 4;
+	default:
+		return 0;
+	}
+}
+
+bool ResolveGlbAccessor(
+	const FJsonObject& Root,
+	int32 AccessorIndex,
+	const TCHAR* ExpectedType,
+	bool bIndices,
+	const uint8* Bin,
+	int64 BinSize,
+	FGlbAccessor& Out,
+	FString& OutError)
+{
+	const TArray<TSharedPtr<FJsonValue>>* Accessors = nullptr;
+	const TArray<TSharedPtr<FJsonValue>>* BufferViews = nullptr;
+	if (!Root.TryGetArrayField(TEXT("accessors"), Accessors) || !Root.TryGetArrayField(TEXT("bufferViews"), BufferViews)
+		|| !Accessors->IsValidIndex(AccessorIndex))
+	{
+		OutError = FString::Printf(TEXT("GLB accessor %d not found"), AccessorIndex);
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject> Accessor = (*Accessors)[AccessorIndex]->AsObject();
+	int32 ViewIndex = INDEX_NONE;
+	FString Type;
+	if (!Accessor.IsValid() || Accessor->HasField(TEXT("sparse")) || !Accessor->TryGetNumberField(TEXT("bufferView"), ViewIndex)
+		|| !BufferViews->IsValidIndex(ViewIndex) || !Accessor->TryGetStringField(TEXT("type"), Type) || Type != ExpectedType)
+	{
+		OutError = FString::Printf(TEXT("GLB accessor %d must be a dense %s accessor backed by a buffer view"), AccessorIndex, ExpectedType);
+		return false;
+	}
+
+	Out.ComponentType = static_cast<int32>(Accessor->GetNumberField(TEXT("componentType")));
+	Out.Count = static_cast<int32>(Accessor->GetNumberField(TEXT("count")));
+	const bool bComponentTypeOk = bIndices ? (Out.ComponentType == GltfUnsignedByte || Out.ComponentType == GltfUnsignedShort || Out.ComponentType == GltfUnsignedInt)
+		: Out.ComponentType == GltfFloat;
+	if (!bComponentTypeOk || Out.Count < 0 || Out.Count > MaxMeshIndices)
+	{
+		OutError = FString::Printf(TEXT("GLB accessor %d has an unsupported component type or count"), AccessorIndex);
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject> View = (*BufferViews)[ViewIndex]->AsObject();
+	int32 BufferIndex = 0;
+	double ViewOffset = 0.0;
+	double ViewLength = 0.0;
+	double ViewStride = 0.0;
+	double AccessorOffset = 0.0;
+	if (!View.IsValid())
+	{
+		OutError = FString::Printf(TEXT("GLB buffer view %d is invalid"), ViewIndex);
+		return false;
+	}
+	View->TryGetNumberField(TEXT("buffer"), BufferIndex);
+	View->TryGetNumberField(TEXT("byteOffset"), ViewOffset);
+	View->TryGetNumberField(TEXT("byteLength"), ViewLength);
+	View->TryGetNumberField(TEXT("byteStride"), ViewStride);
+	Accessor->TryGetNumberField(TEXT("byteOffset"), AccessorOffset);
+
+	const int32 Components = Type == TEXT("VEC3") ? 3 : (Type == TEXT("VEC2") ? 2 : 1);
+	const int64 ElementSize = static_cast<int64>(GltfComponentSize(Out.ComponentType)) * Components;
+	Out.Stride = ViewStride > 0.0 ? static_cast<int32>(ViewStride) : static_cast<int32>(ElementSize);
+	const int64 Start = static_cast<int64>(ViewOffset) + static_cast<int64>(AccessorOffset);
+	const int64 Needed = Out.Count > 0 ? static_cast<int64>(Out.Count - 1) * Out.Stride + ElementSize : 0;
+	if (BufferIndex != 0 || Out.Stride < ElementSize || ViewOffset < 0.0 || AccessorOffset < 0.0
+		|| static_cast<int64>(AccessorOffset) + Needed > static_cast<int64>(ViewLength) || Start + Needed > BinSize)
+	{
+		OutError = FString::Printf(TEXT("GLB accessor %d reads outside the embedded binary buffer"), AccessorIndex);
+		return false;
+	}
+
+	Out.Data = Bin + Start;
+	return true;
+}
+
+FVector3f ReadGlbVec3(const FGlbAccessor& Accessor, int32 Index)
+{
+	FVector3f Value;
+	FMemory::Memcpy(&Value, Accessor.Data + static_cast<int64>(Index) * Accessor.Stride, sizeof(Value));
+	return Value;
+}
+
+FVector2f ReadGlbVec2(const FGlbAccessor& Accessor, int32 Index)
+{
+	FVector2f Value;
+	FMemory::Memcpy(&Value, Accessor.Data + static_cast<int64>(Index) * Accessor.Stride, sizeof(Value));
+	return Value;
+}
+
+uint32 ReadGlbIndex(const FGlbAccessor& Accessor, int32 Index)
+{
+	const uint8* Element = Accessor.Data + static_cast<int64>(Index) * Accessor.Stride;
+	switch (Accessor.ComponentType)
+	{
+	case GltfUnsignedByte:
+		return *Element;
+	case GltfUnsignedShort:
+	{
+		uint16 Value = 0;
+		FMemory::Memcpy(&Value, Element, sizeof(Value));
+		return Value;
+	}
+	default:
+		return ReadLittleUInt32(Element);
+	}
+}
+
+// glTF is Y-up right-handed in meters; swapping Y and Z gives Unreal's Z-up left-handed frame.
+FVector3f GltfToUnreal(const FVector3f& Value)
+{
+	return FVector3f(Value.X, Value.Z, Value.Y);
+}
+} // namespace
+
+bool ParseObjMesh(const uint8* Data, int64 Size, float Scale, FMeshBuffers& OutMesh, FModelImportStats& OutStats, FString& OutError, int64 ChunkBytes)
+{
+	// Split at line boundaries; each chunk parses into its own arrays so workers never share state.
+	TArray<FObjChunk> Chunks;
+	const int64 SafeChunkBytes = FMath::Max<int64>(ChunkBytes, 1);
+	const int32 ChunkCount = static_cast<int32>(FMath::Clamp<int64>((Size + SafeChunkBytes - 1) / SafeChunkBytes, 1, 4096));
+	const uint8* End = Data + Size;
+	const uint8* ChunkStart = Data;
+	for (int32 Index = 1; Index <= ChunkCount && ChunkStart < End; ++Index)
+	{
+		const uint8* ChunkEnd = Index == ChunkCount ? End : FMath::Max(ChunkStart, Data + Size * Index / ChunkCount);
+		while (ChunkEnd < End && ChunkEnd > Data && ChunkEnd[-1] != '\n')
+		{
+			++ChunkEnd;
+		}
+		FObjChunk& Chunk = Chunks.AddDefaulted_GetRef();
+		Chunk.Begin = ChunkStart;
+		Chunk.End = ChunkEnd;
+		ChunkStart = ChunkEnd;
+	}
+
+	ParallelFor(Chunks.Num(), [&Chunks](int32 ChunkIndex)
+	{
+		ParseObjChunk(Chunks[ChunkIndex]);
+	});
+
+	int64 Totals[ObjAttributeCount] = {};
+	int64 TotalCorners = 0;
+	OutStats.SourceFaces = 0;
+	for (FObjChunk& Chunk : Chunks)
+	{
+		const int32 Counts[ObjAttributeCount] = { Chunk.Positions.Num(), Chunk.UVs.Num(), Chunk.Normals.Num() };
+		for (int32 Attribute = 0; Attribute < ObjAttributeCount; ++Attribute)
+		{
+			Chunk.Base[Attribute] = static_cast<int32>(FMath::Min<int64>(Totals[Attribute], MAX_int32));
+			Totals[Attribute] += Counts[Attribute];
+		}
+		Chunk.CornerBase = static_cast<int32>(FMath::Min<int64>(TotalCorners, MAX_int32));
+		TotalCorners += Chunk.Corners.Num();
+		OutStats.SourceFaces += Chunk.Faces;
+	}
+	OutStats.SourcePositions = static_cast<int32>(FMath::Min<int64>(Totals[ObjPosition], MAX_int32));
+	OutStats.ParseChunks = Chunks.Num();
+
+	if (Totals[ObjPosition] == 0 || OutStats.SourceFaces == 0)
+	{
+		OutError = FString::Printf(TEXT("OBJ parse failed: %lld positions, %d faces"), Totals[ObjPosition], OutStats.SourceFaces);
+		return false;
+	}
+	if (TotalCorners > MaxMeshVertices || Totals[ObjPosition] > MAX_int32 || Totals[ObjUV] > MAX_int32 || Totals[ObjNormal] > MAX_int32)
+	{
+		OutError = FString::Printf(TEXT("OBJ has %lld triangle corners; the limit is %d"), TotalCorners, MaxMeshVertices);
+		return false;
+	}
+
+	TArray<FVector3f> Positions;
+	TArray<FVector2f> UVs;
+	TArray<FVector3f> Normals;
+	GatherChunkStreams(Chunks, static_cast<int32>(Totals[ObjPosition]), &FObjChunk::Positions, ObjPosition, Positions);
+	GatherChunkStreams(Chunks, static_cast<int32>(Totals[ObjUV]), &FObjChunk::UVs, ObjUV, UVs);
+	GatherChunkStreams(Chunks, static_cast<int32>(Totals[ObjNormal]), &FObjChunk::Normals, ObjNormal, Normals);
+
+	// Expand corners in parallel: one vertex per corner, out-of-range references fall back to defaults.
+	const int32 CornerCount = static_cast<int32>(TotalCorners);
+	OutMesh.Positions.SetNumUninitialized(CornerCount);
+	OutMesh.UVs.SetNumUninitialized(CornerCount);
+	OutMesh.Normals.SetNumUninitialized(CornerCount);
+	OutMesh.Indices.SetNumUninitialized(CornerCount);
+	ParallelFor(Chunks.Num(), [&Chunks, &Positions, &UVs, &Normals, &OutMesh, Scale](int32 ChunkIndex)
+	{
+		const FObjChunk& Chunk = Chunks[ChunkIndex];
+		for (int32 Index = 0; Index < Chunk.Corners.Num(); ++Index)
+		{
+			const FObjCorner& Corner = Chunk.Corners[Index];
+			const int32 Out = Chunk.CornerBase + Index;
+
+			const int32 PositionIndex = ResolveObjIndex(Corner, ObjPosition, Chunk);
+			const FVector3f Position = Positions.IsValidIndex(PositionIndex) ? Positions[PositionIndex] : FVector3f::ZeroVector;
+			OutMesh.Positions[Out] = FVector3f(Position.X * Scale, -Position.Y * Scale, Position.Z * Scale);
+
+			const int32 UVIndex = ResolveObjIndex(Corner, ObjUV, Chunk);
+			OutMesh.UVs[Out] = UVs.IsValidIndex(UVIndex) ? FVector2f(UVs[UVIndex].X, 1.0f - UVs[UVIndex].Y) : FVector2f::ZeroVector;
+
+			const int32 NormalIndex = ResolveObjIndex(Corner, ObjNormal, Chunk);
+			OutMesh.Normals[Out] = Normals.IsValidIndex(NormalIndex) ? FVector3f(Normals[NormalIndex].X, -Normals[NormalIndex].Y, Normals[NormalIndex].Z) : FVector3f(0.0f, 0.0f, 1.0f);
+
+			OutMesh.Indices[Out] = static_cast<uint32>(Out);
+		}
+	});
+	return true;
+}
+
+bool ParseGlbMesh(const uint8* Data, int64 Size, float Scale, FMeshBuffers& OutMesh, FModelImportStats& OutStats, FString& OutError)
+{
+	if (!Data || Size < 20 || ReadLittleUInt32(Data) != GlbMagic || ReadLittleUInt32(Data + 4) != 2)
+	{
+		OutError = TEXT("Not a glTF 2.0 binary (.glb) file");
+		return false;
+	}
+
+	// Header, then a JSON chunk and an optional BIN chunk, each prefixed by length and type.
+	const int64 DeclaredSize = FMath::Min<int64>(ReadLittleUInt32(Data + 8), Size);
+	const uint8* JsonChunk = nullptr;
+	int64 JsonSize = 0;
+	const uint8* BinChunk = nullptr;
+	int64 BinSize = 0;
+	for (int64 Offset = 12; Offset + 8 <= DeclaredSize;)
+	{
+		const int64 ChunkLength = ReadLittleUInt32(Data + Offset);
+		const uint32 ChunkType = ReadLittleUInt32(Data + Offset + 4);
+		if (Offset + 8 + ChunkLength > DeclaredSize)
+		{
+			OutError = TEXT("GLB chunk runs past the end of the file");
+			return false;
+		}
+		if (ChunkType == GlbChunkJson && !JsonChunk)
+		{
+			JsonChunk = Data + Offset + 8;
+			JsonSize = ChunkLength;
+		}
+		else if (ChunkType == GlbChunkBin && !BinChunk)
+		{
+			BinChunk = Data + Offset + 8;
+			BinSize = ChunkLength;
+		}
+		Offset += 8 + ChunkLength;
+	}
+	if (!JsonChunk || !BinChunk)
+	{
+		OutError = TEXT("GLB must contain a JSON chunk and an embedded BIN chunk");
+		return false;
+	}
+
+	const FUTF8ToTCHAR JsonText(reinterpret_cast<const ANSICHAR*>(JsonChunk), static_cast<int32>(JsonSize));
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(FString(JsonText.Length(), JsonText.Get())), Root) || !Root.IsValid())
+	{
+		OutError = TEXT("GLB JSON chunk is not valid JSON");
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Buffers = nullptr;
+	if (Root->TryGetArrayField(TEXT("buffers"), Buffers) && Buffers->Num() > 0 && (*Buffers)[0]->AsObject().IsValid()
+		&& (*Buffers)[0]->AsObject()->HasField(TEXT("uri")))
+	{
+		OutError = TEXT("GLB buffer 0 must be the embedded BIN chunk");
+		return false;
+	}
+
+	// Resolve every triangle primitive up front so decoding can run in parallel with fixed output offsets.
+	TArray<FGlbPrimitive> Primitives;
+	int64 TotalVertices = 0;
+	int64 TotalIndices = 0;
+	bool bAnyNormals = false;
+	bool bAnyUVs = false;
+	const TArray<TSharedPtr<FJsonValue>>* Meshes = nullptr;
+	if (Root->TryGetArrayField(TEXT("meshes"), Meshes))
+	{
+		for (const TSharedPtr<FJsonValue>& MeshValue : *Meshes)
+		{
+			const TSharedPtr<FJsonObject> MeshObject = MeshValue->AsObject();
+			const TArray<TSharedPtr<FJsonValue>>* PrimitiveValues = nullptr;
+			if (!MeshObject.IsValid() || !MeshObject->TryGetArrayField(TEXT("primitives"), PrimitiveValues))
+			{
+				continue;
+			}
+
+			for (const TSharedPtr<FJsonValue>& PrimitiveValue : *PrimitiveValues)
+			{
+				const TSharedPtr<FJsonObject> PrimitiveObject = PrimitiveValue->AsObject();
+				int32 Mode = GltfTriangles;
+				const TSharedPtr<FJsonObject>* Attributes = nullptr;
+				if (!PrimitiveObject.IsValid() || (PrimitiveObject->TryGetNumberField(TEXT("mode"), Mode) && Mode != GltfTriangles)
+					|| !PrimitiveObject->TryGetObjectField(TEXT("attributes"), Attributes))
+				{
+					continue;
+				}
+
+				FGlbPrimitive Primitive;
+				int32 AccessorIndex = INDEX_NONE;
+				if (!(*Attributes)->TryGetNumberField(TEXT("POSITION"), AccessorIndex)
+					|| !ResolveGlbAccessor(*Root, AccessorIndex, TEXT("VEC3"), false, BinChunk, BinSize, Primitive.Positions, OutError))
+				{
+					if (OutError.IsEmpty())
+					{
+						OutError = TEXT("GLB primitive has no POSITION attribute");
+					}
+					return false;
+				}
+				if ((*Attributes)->TryGetNumberField(TEXT("NORMAL"), AccessorIndex))
+				{
+					if (!ResolveGlbAccessor(*Root, AccessorIndex, TEXT("VEC3"), false, BinChunk, BinSize, Primitive.Normals, OutError))
+					{
+						return false;
+					}
+					bAnyNormals = true;
+				}
+				if ((*Attributes)->TryGetNumberField(TEXT("TEXCOORD_0"), AccessorIndex))
+				{
+					if (!ResolveGlbAccessor(*Root, AccessorIndex, TEXT("VEC2"), false, BinChunk, BinSize, Primitive.UVs, OutError))
+					{
+						return false;
+					}
+					bAnyUVs = true;
+				}
+				if (PrimitiveObject->TryGetNumberField(TEXT("indices"), AccessorIndex))
+				{
+					if (!ResolveGlbAccessor(*Root, AccessorIndex, TEXT("SCALAR"), true, BinChunk, BinSize, Primitive.Indices, OutError))
+					{
+						return false;
+					}
+					Primitive.bIndexed = true;
+				}
+
+				Primitive.IndexCount = Primitive.bIndexed ? Primitive.Indices.Count : Primitive.Positions.Count;
+				if (Primitive.IndexCount % 3 != 0 || (Primitive.Normals.Data && Primitive.Normals.Count != Primitive.Positions.Count)
+					|| (Primitive.UVs.Data && Primitive.UVs.Count != Primitive.Positions.Count))
+				{
+					OutError = TEXT("GLB primitive has mismatched attribute or index counts");
+					return false;
+				}
+
+				Primitive.VertexBase = static_cast<int32>(FMath::Min<int64>(TotalVertices, MAX_int32));
+				Primitive.IndexBase = static_cast<int32>(FMath::Min<int64>(TotalIndices, MAX_int32));
+				TotalVertices += Primitive.Positions.Count;
+				TotalIndices += Primitive.IndexCount;
+				Primitives.Add(Primitive);
+			}
+		}
+	}
+
+	if (Primitives.Num() == 0 || TotalIndices == 0)
+	{
+		OutError = TEXT("GLB contains no triangle primitives");
+		return false;
+	}
+	if (TotalVertices > MaxMeshVertices || TotalIndices > MaxMeshIndices)
+	{
+		OutError = TEXT("GLB exceeds the vertex or index limit");
+		return false;
+	}
+
+	OutMesh.Positions.SetNumUninitialized(static_cast<int32>(TotalVertices));
+	OutMesh.Normals.SetNumZeroed(bAnyNormals ? static_cast<int32>(TotalVertices) : 0);
+	OutMesh.UVs.SetNumZeroed(bAnyUVs ? static_cast<int32>(TotalVertices) : 0);
+	OutMesh.Indices.SetNumUninitialized(static_cast<int32>(TotalIndices));
+	TArray<bool> IndexInRange;
+	IndexInRange.Init(true, Primitives.Num());
+	ParallelFor(Primitives.Num(), [&Primitives, &OutMesh, &IndexInRange, Scale](int32 PrimitiveIndex)
+	{
+		const FGlbPrimitive& Primitive = Primitives[PrimitiveIndex];
+		for (int32 Index = 0; Index < Primitive.Positions.Count; ++Index)
+		{
+			const int32 Out = Primitive.VertexBase + Index;
+			OutMesh.Positions[Out] = GltfToUnreal(ReadGlbVec3(Primitive.Positions, Index)) * Scale;
+			if (Primitive.Normals.Data)
+			{
+				OutMesh.Normals[Out] = GltfToUnreal(ReadGlbVec3(Primitive.Normals, Index));
+			}
+			if (Primitive.UVs.Data)
+			{
+				OutMesh.UVs[Out] = ReadGlbVec2(Primitive.UVs, Index);
+			}
+		}
+
+		// The handedness swap mirrors the mesh, so reverse winding to keep faces pointing outwards.
+		const uint32 VertexCount = static_cast<uint32>(Primitive.Positions.Count);
+		for (int32 Tri = 0; Tri < Primitive.IndexCount / 3; ++Tri)
+		{
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const int32 Source = Tri * 3 + (Corner == 0 ? 0 : 3 - Corner);
+				const uint32 Index = Primitive.bIndexed ? ReadGlbIndex(Primitive.Indices, Source) : static_cast<uint32>(Source);
+				if (Index >= VertexCount)
+				{
+					IndexInRange[PrimitiveIndex] = false;
+				}
+				OutMesh.Indices[Primitive.IndexBase + Tri * 3 + Corner] = static_cast<uint32>(Primitive.VertexBase) + Index;
+			}
+		}
+	});
+
+	if (IndexInRange.Contains(false))
+	{
+		OutError = TEXT("GLB primitive indices reference vertices outside the primitive");
+		return false;
+	}
+
+	OutStats.SourcePositions = static_cast<int32>(TotalVertices);
+	OutStats.SourceFaces = static_cast<int32>(TotalIndices / 3);
+	OutStats.ParseChunks = Primitives.Num();
+	return true;
+}
+
+bool ImportMeshFile(const FString& FilePath, float Scale, FMeshBuffers& OutMesh, FModelImportStats& OutStats, FString& OutError)
+{
+	const bool bIsObj = FilePath.EndsWith(TEXT(".obj"), ESearchCase::IgnoreCase);
+	const bool bIsGlb = FilePath.EndsWith(TEXT(".glb"), ESearchCase::IgnoreCase);
+	if (!bIsObj && !bIsGlb)
+	{
+		OutError = TEXT("Native import supports .obj and .glb");
+		return false;
+	}
+
+	// Map the file so chunk workers read straight from the page cache; fall back to one read when mapping is
+	// unavailable. The region is declared after the handle so it is unmapped first.
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TArray<uint8> FileBytes;
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+	FOpenMappedResult OpenResult = FPlatformFileManager::Get().GetPlatformFile().OpenMappedEx(*FilePath);
+	if (OpenResult.HasValue())
+	{
+		MappedFile = OpenResult.StealValue();
+		if (MappedFile->GetFileSize() > 0)
+		{
+			MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+		}
+	}
+	if (MappedRegion.IsValid())
+	{
+		Data = MappedRegion->GetMappedPtr();
+		Size = MappedRegion->GetMappedSize();
+		OutStats.bMemoryMapped = true;
+	}
+	else if (FFileHelper::LoadFileToArray(FileBytes, *FilePath))
+	{
+		Data = FileBytes.GetData();
+		Size = FileBytes.Num();
+	}
+	else
+	{
+		OutError = FString::Printf(TEXT("Failed to read %s"), *FPaths::GetCleanFilename(FilePath));
+		return false;
+	}
+
+	return bIsObj ? ParseObjMesh(Data, Size, Scale, OutMesh, OutStats, OutError) : ParseGlbMesh(Data, Size, Scale, OutMesh, OutStats, OutError);
+}
+} // namespace NovaBridgeCore
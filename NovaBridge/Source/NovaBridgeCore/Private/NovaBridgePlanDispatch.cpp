@@ -2,6 +2,41 @@
 
 namespace NovaBridgeCore
 {
+FPlanSliceRunner::FPlanSliceRunner(const int32 InStepCount, const double InFrameBudgetMs)
+	: StepCount(FMath::Max(0, InStepCount))
+	, FrameBudgetMs(FMath::Max(0.0, InFrameBudgetMs))
+{
+}
+
+void FPlanSliceRunner::RunSlice(TFunctionRef<void(int32 StepIndex)> RunStep, TFunctionRef<double()> Clock)
+{
+	if (IsFinished())
+	{
+		return;
+	}
+
+	++SliceCount;
+	const double StartSec = Clock();
+	double ElapsedMs = 0.0;
+	do
+	{
+		RunStep(NextStep++);
+		ElapsedMs = (Clock() - StartSec) * 1000.0;
+	}
+	while (!IsFinished() && (FrameBudgetMs <= 0.0 || ElapsedMs < FrameBudgetMs));
+	LongestSliceMs = FMath::Max(LongestSliceMs, ElapsedMs);
+}
+
+double ClampRequestedPlanFrameBudgetMs(const double RequestedMs, const double MaxMs)
+{
+	const double UpperMs = FMath::Max(MinRequestedPlanFrameBudgetMs, MaxMs);
+	if (!FMath::IsFinite(RequestedMs))
+	{
+		return UpperMs;
+	}
+	return FMath::Clamp(RequestedMs, MinRequestedPlanFrameBudgetMs, UpperMs);
+}
+
 FString NormalizePlanAction(const FString& RawAction)
 {
 	FString Action = RawAction;
@@ -240,12 +240,40 @@ static bool ValidateSpawnParams(
 	return true;
 }
 
+// Optional locality target shared by delete and set: "near" point, "radius" and "class" filter.
+static bool ValidateNearTargetParams(const TSharedPtr<FJsonObject>& Params, const TCHAR* Action, FString& OutError)
+{
+	if (Params->HasField(TEXT("near")) && !IsVectorJsonValue(Params->TryGetField(TEXT("near"))))
+	{
+		OutError = FString::Printf(TEXT("%s.params.near must be [x,y,z] or {x,y,z}"), Action);
+		return false;
+	}
+	if (Params->HasField(TEXT("radius")))
+	{
+		double Radius = 0.0;
+		if (!Params->TryGetNumberField(TEXT("radius"), Radius) || Radius <= 0.0)
+		{
+			OutError = FString::Printf(TEXT("%s.params.radius must be a positive number"), Action);
+			return false;
+		}
+	}
+	if (Params->HasField(TEXT("class")) && !Params->HasTypedField<EJson::String>(TEXT("class")))
+	{
+		OutError = FString::Printf(TEXT("%s.params.class must be a string"), Action);
+		return false;
+	}
+	return true;
+}
+
 static bool ValidateDeleteParams(const TSharedPtr<FJsonObject>& Params, FString& OutError)
 {
 	const TSet<FString> AllowedDeleteFields =
 	{
 		TEXT("name"),
-		TEXT("target")
+		TEXT("target"),
+		TEXT("near"),
+		TEXT("radius"),
+		TEXT("class")
 	};
 
 	FString UnknownField;
@@ -265,7 +293,7 @@ static bool ValidateDeleteParams(const TSharedPtr<FJsonObject>& Params, FString&
 		OutError = TEXT("delete.params.target must be a string");
 		return false;
 	}
-	return true;
+	return ValidateNearTargetParams(Params, TEXT("delete"), OutError);
 }
 
 static bool ValidateSetParams(const TSharedPtr<FJsonObject>& Params, FString& OutError)
@@ -274,7 +302,10 @@ static bool ValidateSetParams(const TSharedPtr<FJsonObject>& Params, FString& Ou
 	{
 		TEXT("target"),
 		TEXT("name"),
-		TEXT("props")
+		TEXT("props"),
+		TEXT("near"),
+		TEXT("radius"),
+		TEXT("class")
 	};
 
 	FString UnknownField;
@@ -299,7 +330,7 @@ static bool ValidateSetParams(const TSharedPtr<FJsonObject>& Params, FString& Ou
 		OutError = TEXT("set.params.props must be an object");
 		return false;
 	}
-	return true;
+	return ValidateNearTargetParams(Params, TEXT("set"), OutError);
 }
 
 static bool ValidateScreenshotParams(const TSharedPtr<FJsonObject>& Params, FString& OutError)
@@ -458,6 +489,7 @@ bool ValidateExecutePlanSchema(
 	if (Mode == ENovaBridgePlanMode::Editor)
 	{
 		AllowedTopLevelFields.Add(TEXT("role"));
+		AllowedTopLevelFields.Add(TEXT("frame_budget_ms"));
 	}
 
 	FString UnknownField;
@@ -479,6 +511,13 @@ bool ValidateExecutePlanSchema(
 		return false;
 	}
 
+	if (Body->HasField(TEXT("frame_budget_ms"))
+		&& (!Body->HasTypedField<EJson::Number>(TEXT("frame_budget_ms")) || Body->GetNumberField(TEXT("frame_budget_ms")) < 0.0))
+	{
+		OutError.Message = TEXT("frame_budget_ms must be a non-negative number");
+		return false;
+	}
+
 	if (!Body->HasTypedField<EJson::Array>(TEXT("steps")))
 	{
 		OutError.Message = TEXT("Missing required field: steps");
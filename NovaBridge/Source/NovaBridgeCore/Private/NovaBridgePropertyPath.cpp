@@ -0,0 +1,71 @@
+#include "NovaBridgePropertyPath.h"
+
+namespace NovaBridgeCore
+{
+FString NormalizeComponentKey(const FString& Value)
+{
+	FString Out;
+	Out.Reserve(Value.Len());
+	for (TCHAR Ch : Value)
+	{
+		if (FChar::IsAlnum(Ch))
+		{
+			Out.AppendChar(FChar::ToLower(Ch));
+		}
+	}
+
+	// Ignore trailing numeric suffixes often used in component names (e.g. LightComponent0).
+	while (Out.Len() > 0 && FChar::IsDigit(Out[Out.Len() - 1]))
+	{
+		Out.LeftChopInline(1, EAllowShrinking::No);
+	}
+
+	return Out;
+}
+
+int32 FindComponentForSelector(const FString& Selector, TArrayView<const FComponentIdentity> Components)
+{
+	for (int32 Index = 0; Index < Components.Num(); ++Index)
+	{
+		const FComponentIdentity& Component = Components[Index];
+		if (Component.Name == Selector || Component.ClassName == Selector || Component.Name.Contains(Selector))
+		{
+			return Index;
+		}
+	}
+
+	const FString RequestedKey = NormalizeComponentKey(Selector);
+	if (RequestedKey.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	for (int32 Index = 0; Index < Components.Num(); ++Index)
+	{
+		const FComponentIdentity& Component = Components[Index];
+		const FString CompNameKey = NormalizeComponentKey(Component.Name);
+		const FString ClassNameKey = NormalizeComponentKey(Component.ClassName);
+		const FString ClassNameNoPrefixKey = NormalizeComponentKey(
+			Component.ClassName.StartsWith(TEXT("U")) ? Component.ClassName.RightChop(1) : Component.ClassName);
+
+		const bool bClassMatch =
+			(RequestedKey == ClassNameKey) ||
+			(RequestedKey == ClassNameNoPrefixKey) ||
+			(RequestedKey.Contains(ClassNameKey)) ||
+			(RequestedKey.Contains(ClassNameNoPrefixKey)) ||
+			(ClassNameKey.Contains(RequestedKey)) ||
+			(ClassNameNoPrefixKey.Contains(RequestedKey));
+
+		const bool bNameMatch =
+			(RequestedKey == CompNameKey) ||
+			(RequestedKey.Contains(CompNameKey)) ||
+			(CompNameKey.Contains(RequestedKey));
+
+		if (bClassMatch || bNameMatch)
+		{
+			return Index;
+		}
+	}
+	return INDEX_NONE;
+}
+} // namespace NovaBridgeCore
@@ -0,0 +1,157 @@
+#include "NovaBridgeRateLimiter.h"
+
+#include "HttpServerResponse.h"
+#include "Misc/ScopeLock.h"
+
+namespace NovaBridgeCore
+{
+namespace
+{
+// Bucket word: [63] initialised, [62..24] last refill tick, [23..0] token units.
+constexpr uint64 InitialisedBit = 1ull << 63;
+constexpr int32 TokenBits = 24;
+constexpr uint64 TokenMask = (1ull << TokenBits) - 1;
+constexpr uint64 TimeMask = (1ull << (63 - TokenBits)) - 1;
+constexpr int32 MaxLimitPerMinute = 64000;
+
+// Refill happens in whole 60 ms ticks, 1000 to the minute, at RefillPerMinute units a tick, so there is no
+// fractional refill to lose. A token costs one unit more than 1000 ticks refill, so no window shorter than
+// 60 s collects a whole extra token, whatever tick boundaries it straddles.
+constexpr uint64 MsPerTick = 60;
+constexpr uint64 UnitsPerToken = 1001;
+
+uint64 PackBucket(uint64 Tick, uint64 Units)
+{
+	return InitialisedBit | ((Tick & TimeMask) << TokenBits) | (Units & TokenMask);
+}
+
+// Seconds, rounded up, until Refill units a tick add up to Missing units.
+int32 CeilUnitsToSeconds(uint64 Missing, uint64 Refill)
+{
+	const uint64 Ticks = (Missing + Refill - 1) / Refill;
+	return static_cast<int32>((Ticks * MsPerTick + 999) / 1000);
+}
+} // namespace
+
+FTokenBucketRateLimiter::FTokenBucketRateLimiter()
+{
+	Reset();
+}
+
+int32 FTokenBucketRateLimiter::RegisterRoute(const FString& RouteKey)
+{
+	FScopeLock Lock(&RegistrationMutex);
+	const int32 Existing = RouteKeys.IndexOfByKey(RouteKey);
+	if (Existing != INDEX_NONE)
+	{
+		return Existing;
+	}
+	if (RouteKeys.Num() >= MaxRoutes)
+	{
+		return INDEX_NONE;
+	}
+	return RouteKeys.Add(RouteKey);
+}
+
+FRateLimitDecision FTokenBucketRateLimiter::Consume(int32 RouteId, int32 RoleSlot, int32 LimitPerMinute, double NowSec)
+{
+	FRateLimitDecision Decision;
+	Decision.LimitPerMinute = FMath::Min(LimitPerMinute, MaxLimitPerMinute);
+	if (Decision.LimitPerMinute <= 0 || RouteId < 0 || RouteId >= MaxRoutes || RoleSlot < 0 || RoleSlot >= RoleSlotCount)
+	{
+		return Decision;
+	}
+
+	const uint64 Refill = static_cast<uint64>(RefillPerMinuteForLimit(Decision.LimitPerMinute));
+	const uint64 Capacity = static_cast<uint64>(BurstForLimit(Decision.LimitPerMinute)) * UnitsPerToken;
+	const uint64 NowTick = (static_cast<uint64>(FMath::Max(0.0, NowSec) * 1000.0) / MsPerTick) & TimeMask;
+	std::atomic<uint64>& Bucket = Buckets[RouteId * RoleSlotCount + RoleSlot];
+
+	uint64 Observed = Bucket.load(std::memory_order_relaxed);
+	uint64 Units = 0;
+	for (;;)
+	{
+		if ((Observed & InitialisedBit) == 0)
+		{
+			Units = Capacity;
+		}
+		else
+		{
+			const uint64 LastTick = (Observed >> TokenBits) & TimeMask;
+			const uint64 ElapsedTicks = NowTick > LastTick ? NowTick - LastTick : 0;
+			Units = FMath::Min(FMath::Min(Observed & TokenMask, Capacity) + ElapsedTicks * Refill, Capacity);
+		}
+
+		Decision.bAllowed = Units >= UnitsPerToken;
+		const uint64 NewUnits = Decision.bAllowed ? Units - UnitsPerToken : Units;
+		if (Bucket.compare_exchange_weak(Observed, PackBucket(NowTick, NewUnits), std::memory_order_relaxed))
+		{
+			Units = NewUnits;
+			break;
+		}
+	}
+
+	Decision.Remaining = static_cast<int32>(Units / UnitsPerToken);
+	Decision.ResetSeconds = CeilUnitsToSeconds(Capacity - Units, Refill);
+	if (!Decision.bAllowed)
+	{
+		Decision.RetryAfterSeconds = FMath::Max(1, CeilUnitsToSeconds(UnitsPerToken - Units, Refill));
+	}
+	return Decision;
+}
+
+void FTokenBucketRateLimiter::Reset()
+{
+	for (std::atomic<uint64>& Bucket : Buckets)
+	{
+		Bucket.store(0, std::memory_order_relaxed);
+	}
+}
+
+int32 FTokenBucketRateLimiter::RoleSlotForName(const FString& NormalizedRole)
+{
+	if (NormalizedRole == TEXT("admin"))
+	{
+		return 0;
+	}
+	if (NormalizedRole == TEXT("automation"))
+	{
+		return 1;
+	}
+	if (NormalizedRole == TEXT("read_only"))
+	{
+		return 2;
+	}
+	return RoleSlotCount - 1;
+}
+
+int32 FTokenBucketRateLimiter::BurstForLimit(int32 LimitPerMinute)
+{
+	return FMath::Max(1, FMath::Min(LimitPerMinute, MaxLimitPerMinute) / 4);
+}
+
+int32 FTokenBucketRateLimiter::RefillPerMinuteForLimit(int32 LimitPerMinute)
+{
+	// One over Limit - Burst: the unit a token costs above a minute of refill takes the extra one back.
+	const int32 Limit = FMath::Clamp(LimitPerMinute, 1, MaxLimitPerMinute);
+	return Limit - BurstForLimit(Limit) + 1;
+}
+
+FHttpResultCallback WrapResultCallbackWithRateLimitHeaders(const FRateLimitDecision& Decision, const FHttpResultCallback& OnComplete)
+{
+	return [Decision, OnComplete](TUniquePtr<FHttpServerResponse>&& Response)
+	{
+		if (Response)
+		{
+			Response->Headers.Add(TEXT("X-RateLimit-Limit"), { FString::FromInt(Decision.LimitPerMinute) });
+			Response->Headers.Add(TEXT("X-RateLimit-Remaining"), { FString::FromInt(Decision.Remaining) });
+			Response->Headers.Add(TEXT("X-RateLimit-Reset"), { FString::FromInt(Decision.ResetSeconds) });
+			if (!Decision.bAllowed && Decision.RetryAfterSeconds > 0)
+			{
+				Response->Headers.Add(TEXT("Retry-After"), { FString::FromInt(Decision.RetryAfterSeconds) });
+			}
+		}
+		OnComplete(MoveTemp(Response));
+	};
+}
+} // namespace NovaBridgeCore
@@ -0,0 +1,169 @@
+#include "NovaBridgeResponseCompression.h"
+
+#include "NovaBridgeMetrics.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "HttpServerResponse.h"
+#include "Misc/Compression.h"
+
+namespace NovaBridgeCore
+{
+namespace
+{
+bool IsCompressibleResponse(const FHttpServerResponse& Response)
+{
+	FString ContentType;
+	for (const TPair<FString, TArray<FString>>& Header : Response.Headers)
+	{
+		if (Header.Key.Equals(TEXT("Content-Encoding"), ESearchCase::IgnoreCase))
+		{
+			return false;
+		}
+		if (Header.Key.Equals(TEXT("Content-Type"), ESearchCase::IgnoreCase) && Header.Value.Num() > 0)
+		{
+			ContentType = Header.Value[0];
+		}
+	}
+	// PNG/JPEG and packed binary bodies are already dense; base64 images inside JSON still compress.
+	return ContentType.StartsWith(TEXT("application/json"), ESearchCase::IgnoreCase)
+		|| ContentType.StartsWith(TEXT("text/"), ESearchCase::IgnoreCase);
+}
+
+// Whether or not this response was compressed, another Accept-Encoding could have changed that.
+void AddAcceptEncodingVary(FHttpServerResponse& Response)
+{
+	Response.Headers.FindOrAdd(TEXT("Vary")).AddUnique(TEXT("Accept-Encoding"));
+}
+} // namespace
+
+EContentEncoding NegotiateContentEncoding(const FString& AcceptEncoding)
+{
+	float GzipQ = -1.0f;
+	float DeflateQ = -1.0f;
+	float WildcardQ = -1.0f;
+
+	TArray<FString> Codings;
+	AcceptEncoding.ParseIntoArray(Codings, TEXT(","), true);
+	for (const FString& Entry : Codings)
+	{
+		TArray<FString> Parts;
+		Entry.ParseIntoArray(Parts, TEXT(";"), true);
+		if (Parts.Num() == 0)
+		{
+			continue;
+		}
+
+		float Quality = 1.0f;
+		for (int32 Index = 1; Index < Parts.Num(); ++Index)
+		{
+			const FString Param = Parts[Index].TrimStartAndEnd();
+			if (Param.StartsWith(TEXT("q="), ESearchCase::IgnoreCase))
+			{
+				Quality = FCString::Atof(*Param.RightChop(2));
+			}
+		}
+
+		const FString Coding = Parts[0].TrimStartAndEnd();
+		if (Coding.Equals(TEXT("gzip"), ESearchCase::IgnoreCase) || Coding.Equals(TEXT("x-gzip"), ESearchCase::IgnoreCase))
+		{
+			GzipQ = Quality;
+		}
+		else if (Coding.Equals(TEXT("deflate"), ESearchCase::IgnoreCase))
+		{
+			DeflateQ = Quality;
+		}
+		else if (Coding == TEXT("*"))
+		{
+			WildcardQ = Quality;
+		}
+	}
+
+	// Codings not listed take the wildcard's weight.
+	GzipQ = GzipQ < 0.0f ? WildcardQ : GzipQ;
+	DeflateQ = DeflateQ < 0.0f ? WildcardQ : DeflateQ;
+	if (GzipQ > 0.0f && GzipQ >= DeflateQ)
+	{
+		return EContentEncoding::Gzip;
+	}
+	return DeflateQ > 0.0f ? EContentEncoding::Deflate : EContentEncoding::Identity;
+}
+
+const TCHAR* GetContentEncodingName(EContentEncoding Encoding)
+{
+	switch (Encoding)
+	{
+	case EContentEncoding::Gzip:
+		return TEXT("gzip");
+	case EContentEncoding::Deflate:
+		return TEXT("deflate");
+	default:
+		return TEXT("identity");
+	}
+}
+
+bool CompressResponseBody(EContentEncoding Encoding, TConstArrayView<uint8> Body, TArray<uint8>& OutCompressed)
+{
+	if (Encoding == EContentEncoding::Identity)
+	{
+		return false;
+	}
+
+	const FName Format = Encoding == EContentEncoding::Gzip ? NAME_Gzip : NAME_Zlib;
+	int32 CompressedSize = FCompression::CompressMemoryBound(Format, Body.Num());
+	OutCompressed.SetNumUninitialized(CompressedSize);
+	if (!FCompression::CompressMemory(Format, OutCompressed.GetData(), CompressedSize, Body.GetData(), Body.Num(), COMPRESS_BiasSpeed))
+	{
+		OutCompressed.Reset();
+		return false;
+	}
+	OutCompressed.SetNum(CompressedSize, EAllowShrinking::No);
+	return true;
+}
+
+FHttpResultCallback WrapResultCallbackWithCompression(EContentEncoding Encoding, int32 MinBytes, FRouteMetrics* Metrics, const FHttpResultCallback& OnComplete)
+{
+	if (MinBytes <= 0)
+	{
+		return OnComplete;
+	}
+
+	return [Encoding, MinBytes, Metrics, OnComplete](TUniquePtr<FHttpServerResponse>&& Response)
+	{
+		if (Response)
+		{
+			AddAcceptEncodingVary(*Response);
+		}
+		if (!Response || Encoding == EContentEncoding::Identity || Response->Body.Num() < MinBytes || !IsCompressibleResponse(*Response))
+		{
+			OnComplete(MoveTemp(Response));
+			return;
+		}
+
+		Async(EAsyncExecution::ThreadPool, [Encoding, Metrics, OnComplete, Response = MoveTemp(Response)]() mutable
+		{
+			const double StartSec = FPlatformTime::Seconds();
+			TArray<uint8> Compressed;
+			const bool bCompressed = CompressResponseBody(Encoding, Response->Body, Compressed);
+			const double ElapsedSec = FPlatformTime::Seconds() - StartSec;
+
+			// Keep the original when compression fails or does not shrink the body.
+			const int32 OriginalBytes = Response->Body.Num();
+			if (bCompressed && Compressed.Num() < OriginalBytes)
+			{
+				Response->Body = MoveTemp(Compressed);
+				Response->Headers.Add(TEXT("Content-Encoding"), { GetContentEncodingName(Encoding) });
+			}
+			if (Metrics)
+			{
+				Metrics->CompressUs.Record(static_cast<uint64>(ElapsedSec * 1000000.0));
+				Metrics->CompressionRatioPermille.Record(static_cast<uint64>(Response->Body.Num()) * 1000 / FMath::Max(OriginalBytes, 1));
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [OnComplete, Response = MoveTemp(Response)]() mutable
+			{
+				OnComplete(MoveTemp(Response));
+			});
+		});
+	};
+}
+} // namespace NovaBridgeCore
@@ -0,0 +1,245 @@
+#include "NovaBridgeResponseProfile.h"
+
+#include "NovaBridgeHttpUtils.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HttpServerRequest.h"
+
+namespace NovaBridgeCore
+{
+namespace
+{
+using FCompactWriter = TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>;
+
+struct FVectorShape
+{
+	const TCHAR* Keys[3];
+	int32 Num;
+};
+
+const FVectorShape CompactVectorShapes[] = {
+	{ { TEXT("x"), TEXT("y"), TEXT("z") }, 3 },
+	{ { TEXT("pitch"), TEXT("yaw"), TEXT("roll") }, 3 },
+	{ { TEXT("x"), TEXT("y"), nullptr }, 2 },
+};
+
+// Components in shape order when Object is exactly one of the vector shapes with numeric values.
+bool ReadCompactVector(const FJsonObject& Object, double (&OutValues)[3], int32& OutNum)
+{
+	for (const FVectorShape& Shape : CompactVectorShapes)
+	{
+		if (Object.Values.Num() != Shape.Num)
+		{
+			continue;
+		}
+		bool bMatches = true;
+		for (int32 Index = 0; Index < Shape.Num && bMatches; ++Index)
+		{
+			const TSharedPtr<FJsonValue>* Value = Object.Values.Find(Shape.Keys[Index]);
+			bMatches = Value && Value->IsValid() && (*Value)->Type == EJson::Number;
+			if (bMatches)
+			{
+				OutValues[Index] = (*Value)->AsNumber();
+			}
+		}
+		if (bMatches)
+		{
+			OutNum = Shape.Num;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool IsDefaultCompactField(const FString& Key, const TSharedPtr<FJsonValue>& Value, int32 Precision)
+{
+	if (!Value.IsValid() || Value->Type == EJson::Null)
+	{
+		return true;
+	}
+	if (Value->Type == EJson::String)
+	{
+		return Value->AsString().IsEmpty();
+	}
+
+	const bool bRotation = Key == TEXT("rotation");
+	if (Value->Type != EJson::Object || (!bRotation && Key != TEXT("scale")))
+	{
+		return false;
+	}
+	double Components[3];
+	int32 Num = 0;
+	if (!ReadCompactVector(*Value->AsObject(), Components, Num) || Num != 3)
+	{
+		return false;
+	}
+	const TCHAR* Default = bRotation ? TEXT("0") : TEXT("1");
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		if (FormatCompactNumber(Components[Index], Precision) != Default)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void WriteCompactValue(FCompactWriter& Writer, const FString* Identifier, const TSharedPtr<FJsonValue>& Value, int32 Precision)
+{
+	if (!Value.IsValid() || Value->Type == EJson::None || Value->Type == EJson::Null)
+	{
+		Identifier ? Writer.WriteNull(*Identifier) : Writer.WriteNull();
+		return;
+	}
+
+	switch (Value->Type)
+	{
+	case EJson::Boolean:
+		Identifier ? Writer.WriteValue(*Identifier, Value->AsBool()) : Writer.WriteValue(Value->AsBool());
+		return;
+	case EJson::Number:
+		Identifier ? Writer.WriteRawJSONValue(*Identifier, FormatCompactNumber(Value->AsNumber(), Precision))
+			: Writer.WriteRawJSONValue(FormatCompactNumber(Value->AsNumber(), Precision));
+		return;
+	case EJson::String:
+		Identifier ? Writer.WriteValue(*Identifier, Value->AsString()) : Writer.WriteValue(Value->AsString());
+		return;
+	case EJson::Array:
+		Identifier ? Writer.WriteArrayStart(*Identifier) : Writer.WriteArrayStart();
+		for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+		{
+			WriteCompactValue(Writer, nullptr, Element, Precision);
+		}
+		Writer.WriteArrayEnd();
+		return;
+	default:
+		break;
+	}
+
+	const FJsonObject& Object = *Value->AsObject();
+	double Components[3];
+	int32 Num = 0;
+	if (ReadCompactVector(Object, Components, Num))
+	{
+		Identifier ? Writer.WriteArrayStart(*Identifier) : Writer.WriteArrayStart();
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Writer.WriteRawJSONValue(FormatCompactNumber(Components[Index], Precision));
+		}
+		Writer.WriteArrayEnd();
+		return;
+	}
+
+	Identifier ? Writer.WriteObjectStart(*Identifier) : Writer.WriteObjectStart();
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Object.Values)
+	{
+		if (!IsDefaultCompactField(Pair.Key, Pair.Value, Precision))
+		{
+			WriteCompactValue(Writer, &Pair.Key, Pair.Value, Precision);
+		}
+	}
+	Writer.WriteObjectEnd();
+}
+} // namespace
+
+FResponseProfile ParseResponseProfile(const FHttpServerRequest& Request)
+{
+	FString ProfileName;
+	FString PrecisionText;
+	if (const FString* Value = Request.QueryParams.Find(TEXT("profile")))
+	{
+		ProfileName = *Value;
+	}
+	if (const FString* Value = Request.QueryParams.Find(TEXT("precision")))
+	{
+		PrecisionText = *Value;
+	}
+
+	if (ProfileName.IsEmpty())
+	{
+		static const TCHAR* const Delimiters[] = { TEXT(";"), TEXT(",") };
+		TArray<FString> Parts;
+		GetHeaderValueCaseInsensitive(Request, TEXT("Accept")).ParseIntoArray(Parts, Delimiters, UE_ARRAY_COUNT(Delimiters), true);
+		for (const FString& Part : Parts)
+		{
+			FString Key;
+			FString Value;
+			if (!Part.TrimStartAndEnd().Split(TEXT("="), &Key, &Value))
+			{
+				continue;
+			}
+			Key.TrimStartAndEndInline();
+			Value.TrimStartAndEndInline();
+			if (Key.Equals(TEXT("profile"), ESearchCase::IgnoreCase))
+			{
+				ProfileName = Value;
+			}
+			else if (Key.Equals(TEXT("precision"), ESearchCase::IgnoreCase) && PrecisionText.IsEmpty())
+			{
+				PrecisionText = Value;
+			}
+		}
+	}
+
+	FResponseProfile Profile;
+	Profile.bCompact = ProfileName.Equals(TEXT("compact"), ESearchCase::IgnoreCase);
+	if (Profile.bCompact && PrecisionText.IsNumeric())
+	{
+		Profile.Precision = FMath::Clamp(FCString::Atoi(*PrecisionText), 0, CompactMaxPrecision);
+	}
+	return Profile;
+}
+
+FString FormatCompactNumber(double Value, int32 Precision)
+{
+	static const double Scales[CompactMaxPrecision + 1] = { 1.0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+	if (!FMath::IsFinite(Value))
+	{
+		return TEXT("null");
+	}
+
+	// Fixed-point in an int64 so the decimal point can be placed without printf precision quirks.
+	int32 Decimals = FMath::Clamp(Precision, 0, CompactMaxPrecision);
+	const double Scaled = FMath::RoundToDouble(Value * Scales[Decimals]);
+	if (FMath::Abs(Scaled) >= 9007199254740992.0)
+	{
+		return FString::Printf(TEXT("%.17g"), Value);
+	}
+
+	const int64 Units = static_cast<int64>(Scaled);
+	if (Units == 0)
+	{
+		return TEXT("0");
+	}
+	uint64 Magnitude = static_cast<uint64>(Units < 0 ? -Units : Units);
+	while (Decimals > 0 && Magnitude % 10 == 0)
+	{
+		Magnitude /= 10;
+		--Decimals;
+	}
+
+	FString Digits = FString::Printf(TEXT("%llu"), static_cast<unsigned long long>(Magnitude));
+	if (Decimals > 0)
+	{
+		if (Digits.Len() <= Decimals)
+		{
+			Digits = FString::ChrN(Decimals - Digits.Len() + 1, TEXT('0')) + Digits;
+		}
+		Digits.InsertAt(Digits.Len() - Decimals, TEXT('.'));
+	}
+	return Units < 0 ? TEXT("-") + Digits : Digits;
+}
+
+void WriteCompactJson(TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>& Writer, const FJsonObject& Object, int32 Precision)
+{
+	Writer.WriteObjectStart();
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Object.Values)
+	{
+		if (!IsDefaultCompactField(Pair.Key, Pair.Value, Precision))
+		{
+			WriteCompactValue(Writer, &Pair.Key, Pair.Value, Precision);
+		}
+	}
+	Writer.WriteObjectEnd();
+}
+} // namespace NovaBridgeCore
@@ -0,0 +1,85 @@
+#include "NovaBridgeRoutePolicy.h"
+
+#include "Dom/JsonObject.h"
+#include "Misc/ScopeLock.h"
+
+namespace NovaBridgeCore
+{
+const FRoutePolicy* FRoutePolicyTable::Add(const FRoutePolicy& Policy)
+{
+	FScopeLock Lock(&Mutex);
+	const FRoutePolicy* Record = Records.Add_GetRef(MakeUnique<FRoutePolicy>(Policy)).Get();
+	if (!CurrentByPath.Contains(Policy.Path))
+	{
+		Paths.Add(Policy.Path);
+	}
+	CurrentByPath.Add(Policy.Path, Record);
+	return Record;
+}
+
+const FRoutePolicy* FRoutePolicyTable::Find(const FString& Path) const
+{
+	FScopeLock Lock(&Mutex);
+	const FRoutePolicy* const* Record = CurrentByPath.Find(Path);
+	return Record ? *Record : nullptr;
+}
+
+TArray<const FRoutePolicy*> FRoutePolicyTable::GetAll() const
+{
+	FScopeLock Lock(&Mutex);
+	TArray<const FRoutePolicy*> Result;
+	Result.Reserve(Paths.Num());
+	for (const FString& Path : Paths)
+	{
+		Result.Add(CurrentByPath.FindChecked(Path));
+	}
+	return Result;
+}
+
+const TCHAR* FRoutePolicyTable::RoleNameForSlot(int32 RoleSlot)
+{
+	switch (RoleSlot)
+	{
+	case 0:
+		return TEXT("admin");
+	case 1:
+		return TEXT("automation");
+	case 2:
+		return TEXT("read_only");
+	default:
+		return TEXT("");
+	}
+}
+
+const TCHAR* RouteAuditLevelToString(ERouteAuditLevel Level)
+{
+	switch (Level)
+	{
+	case ERouteAuditLevel::Quiet:
+		return TEXT("quiet");
+	case ERouteAuditLevel::Denials:
+	default:
+		return TEXT("denials");
+	}
+}
+
+TArray<TSharedPtr<FJsonValue>> MakeRoutePolicyJson(const TArray<const FRoutePolicy*>& Policies, int32 RoleSlot)
+{
+	TArray<TSharedPtr<FJsonValue>> Routes;
+	Routes.Reserve(Policies.Num());
+	for (const FRoutePolicy* Policy : Policies)
+	{
+		TSharedPtr<FJsonObject> Route = MakeShared<FJsonObject>();
+		Route->SetStringField(TEXT("path"), Policy->Path);
+		Route->SetBoolField(TEXT("get"), Policy->Allows(RoleSlot, EHttpServerRequestVerbs::VERB_GET));
+		Route->SetBoolField(TEXT("write"), Policy->Allows(RoleSlot, EHttpServerRequestVerbs::VERB_POST));
+		Route->SetBoolField(TEXT("read_only"), Policy->bReadOnly);
+		Route->SetStringField(TEXT("class"), RouteClassToString(Policy->RouteClass));
+		Route->SetNumberField(TEXT("default_deadline_ms"), Policy->DefaultDeadlineMs);
+		Route->SetNumberField(TEXT("max_requests_per_minute"), Policy->RateLimitFor(RoleSlot));
+		Route->SetStringField(TEXT("audit"), RouteAuditLevelToString(Policy->AuditLevel));
+		Routes.Add(MakeShared<FJsonValueObject>(Route));
+	}
+	return Routes;
+}
+} // namespace NovaBridgeCore
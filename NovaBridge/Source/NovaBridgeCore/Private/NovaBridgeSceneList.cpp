@@ -0,0 +1,196 @@
+#include "NovaBridgeSceneList.h"
+
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+namespace NovaBridgeCore
+{
+namespace
+{
+struct FSceneFieldName
+{
+	const TCHAR* Name;
+	ESceneField Field;
+};
+
+const FSceneFieldName SceneFieldNames[] = {
+	{ TEXT("name"), ESceneField::Name },
+	{ TEXT("label"), ESceneField::Label },
+	{ TEXT("class"), ESceneField::Class },
+	{ TEXT("path"), ESceneField::Path },
+	{ TEXT("transform"), ESceneField::Transform },
+	{ TEXT("tags"), ESceneField::Tags },
+	{ TEXT("all"), ESceneField::All },
+};
+
+// Cursor format is "<name>|<id>"; '|' is not a legal object name character.
+bool ParseSceneListCursor(const FString& Cursor, FSceneListKey& OutKey)
+{
+	FString Name;
+	FString Id;
+	if (!Cursor.Split(TEXT("|"), &Name, &Id, ESearchCase::CaseSensitive, ESearchDir::FromEnd) || Name.IsEmpty() || !Id.IsNumeric())
+	{
+		return false;
+	}
+	OutKey.Name = FName(*Name);
+	OutKey.Id = static_cast<uint32>(FCString::Strtoui64(*Id, nullptr, 10));
+	return true;
+}
+
+bool ReadStringArrayField(const FJsonObject& Body, const TCHAR* Field, int32 MaxEntries, TArray<FString>& OutValues, FString& OutError)
+{
+	const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+	if (!Body.TryGetArrayField(Field, Values))
+	{
+		return true;
+	}
+	if (Values->Num() > MaxEntries)
+	{
+		OutError = FString::Printf(TEXT("'%s' accepts at most %d entries"), Field, MaxEntries);
+		return false;
+	}
+	for (const TSharedPtr<FJsonValue>& Value : *Values)
+	{
+		FString Entry;
+		if (!Value.IsValid() || !Value->TryGetString(Entry) || Entry.TrimStartAndEnd().IsEmpty())
+		{
+			OutError = FString::Printf(TEXT("'%s' must be an array of non-empty strings"), Field);
+			return false;
+		}
+		OutValues.AddUnique(Entry.TrimStartAndEnd());
+	}
+	return true;
+}
+} // namespace
+
+bool ParseSceneFields(const FString& Csv, ESceneField& OutFields, FString& OutError)
+{
+	TArray<FString> Names;
+	Csv.ParseIntoArray(Names, TEXT(","), true);
+	OutFields = ESceneField::None;
+	for (FString& Name : Names)
+	{
+		Name.TrimStartAndEndInline();
+		const FSceneFieldName* Match = nullptr;
+		for (const FSceneFieldName& Candidate : SceneFieldNames)
+		{
+			if (Name.Equals(Candidate.Name, ESearchCase::IgnoreCase))
+			{
+				Match = &Candidate;
+				break;
+			}
+		}
+		if (!Match)
+		{
+			OutError = FString::Printf(TEXT("Unknown field '%s'. Supported: name, label, class, path, transform, tags, all"), *Name);
+			return false;
+		}
+		OutFields |= Match->Field;
+	}
+
+	if (OutFields == ESceneField::None)
+	{
+		OutError = TEXT("'fields' must name at least one field");
+		return false;
+	}
+	return true;
+}
+
+bool ParseSceneListQuery(const TMap<FString, FString>& Params, int32 DefaultLimit, FSceneListQuery& OutQuery, FString& OutError)
+{
+	OutQuery = FSceneListQuery();
+	OutQuery.Limit = FMath::Clamp(DefaultLimit, 1, SceneListMaxLimit);
+
+	if (const FString* Limit = Params.Find(TEXT("limit")))
+	{
+		if (!Limit->IsNumeric() || FCString::Atoi(**Limit) < 1)
+		{
+			OutError = TEXT("'limit' must be a positive integer");
+			return false;
+		}
+		OutQuery.Limit = FMath::Min(FCString::Atoi(**Limit), SceneListMaxLimit);
+	}
+
+	if (const FString* Cursor = Params.Find(TEXT("cursor")))
+	{
+		if (!Cursor->IsEmpty())
+		{
+			if (!ParseSceneListCursor(*Cursor, OutQuery.Cursor))
+			{
+				OutError = TEXT("Invalid 'cursor'; pass next_cursor from the previous page");
+				return false;
+			}
+			OutQuery.bHasCursor = true;
+		}
+	}
+
+	if (const FString* ClassName = Params.Find(TEXT("class")))
+	{
+		OutQuery.ClassName = NormalizeSceneClassName(*ClassName);
+	}
+
+	if (const FString* Tag = Params.Find(TEXT("tag")))
+	{
+		if (!Tag->IsEmpty())
+		{
+			OutQuery.Tag = FName(**Tag);
+		}
+	}
+
+	if (const FString* Fields = Params.Find(TEXT("fields")))
+	{
+		return ParseSceneFields(*Fields, OutQuery.Fields, OutError);
+	}
+	return true;
+}
+
+FString MakeSceneListCursor(const FSceneListKey& Key)
+{
+	return FString::Printf(TEXT("%s|%u"), *Key.Name.ToString(), Key.Id);
+}
+
+FName NormalizeSceneClassName(const FString& ClassName)
+{
+	FString ShortName = ClassName;
+	int32 DotIndex = INDEX_NONE;
+	if (ShortName.FindLastChar(TEXT('.'), DotIndex))
+	{
+		ShortName.RightChopInline(DotIndex + 1);
+	}
+	ShortName.TrimStartAndEndInline();
+	return ShortName.IsEmpty() ? NAME_None : FName(*ShortName);
+}
+
+bool ParseSceneGetManyRequest(const FJsonObject& Body, FSceneGetManyRequest& OutRequest, FString& OutError)
+{
+	OutRequest = FSceneGetManyRequest();
+	if (!ReadStringArrayField(Body, TEXT("properties"), SceneGetManyMaxProperties, OutRequest.Properties, OutError)
+		|| !ReadStringArrayField(Body, TEXT("names"), SceneListMaxLimit, OutRequest.Names, OutError))
+	{
+		return false;
+	}
+	if (OutRequest.Properties.Num() == 0)
+	{
+		OutError = TEXT("'properties' must list at least one property path");
+		return false;
+	}
+
+	// Reuse the scene/list rules for the filter half of the body.
+	TMap<FString, FString> Params;
+	Params.Add(TEXT("fields"), TEXT("name"));
+	for (const TCHAR* Field : { TEXT("cursor"), TEXT("class"), TEXT("tag"), TEXT("fields") })
+	{
+		FString Value;
+		if (Body.TryGetStringField(Field, Value))
+		{
+			Params.Add(Field, Value);
+		}
+	}
+	double Limit = 0.0;
+	if (Body.TryGetNumberField(TEXT("limit"), Limit))
+	{
+		Params.Add(TEXT("limit"), FString::Printf(TEXT("%.0f"), Limit));
+	}
+	return ParseSceneListQuery(Params, SceneListDefaultLimit, OutRequest.Query, OutError);
+}
+} // namespace NovaBridgeCore
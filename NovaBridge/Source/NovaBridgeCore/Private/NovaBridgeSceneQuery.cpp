@@ -0,0 +1,223 @@
+#include "NovaBridgeSceneQuery.h"
+
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Math/RotationMatrix.h"
+
+namespace NovaBridgeCore
+{
+namespace
+{
+bool ReadQueryTriple(const TSharedPtr<FJsonValue>& Value, const TCHAR* A, const TCHAR* B, const TCHAR* C, FVector& Out)
+{
+	if (!Value.IsValid())
+	{
+		return false;
+	}
+	if (Value->Type == EJson::Array)
+	{
+		const TArray<TSharedPtr<FJsonValue>>& Values = Value->AsArray();
+		return Values.Num() == 3 && Values[0]->TryGetNumber(Out.X) && Values[1]->TryGetNumber(Out.Y) && Values[2]->TryGetNumber(Out.Z);
+	}
+	const TSharedPtr<FJsonObject>* Obj = nullptr;
+	return Value->TryGetObject(Obj) && Obj && (*Obj)->TryGetNumberField(A, Out.X) && (*Obj)->TryGetNumberField(B, Out.Y)
+		&& (*Obj)->TryGetNumberField(C, Out.Z);
+}
+
+bool ReadQueryVector(const FJsonObject& Obj, const TCHAR* Field, FVector& Out)
+{
+	return ReadQueryTriple(Obj.TryGetField(Field), TEXT("x"), TEXT("y"), TEXT("z"), Out);
+}
+
+bool ParseBoxShape(const FJsonObject& Obj, FSceneQueryShape& OutShape, FString& OutError)
+{
+	FVector Min;
+	FVector Max;
+	if (ReadQueryVector(Obj, TEXT("min"), Min) && ReadQueryVector(Obj, TEXT("max"), Max))
+	{
+		OutShape = FSceneQueryShape::MakeBox(FBox(Min.ComponentMin(Max), Min.ComponentMax(Max)));
+		return true;
+	}
+
+	FVector Center;
+	FVector Extent;
+	if (ReadQueryVector(Obj, TEXT("center"), Center) && ReadQueryVector(Obj, TEXT("extent"), Extent))
+	{
+		OutShape = FSceneQueryShape::MakeBox(FBox::BuildAABB(Center, Extent.GetAbs()));
+		return true;
+	}
+
+	OutError = TEXT("box needs min and max, or center and extent");
+	return false;
+}
+
+bool ParseSphereShape(const FJsonObject& Obj, FSceneQueryShape& OutShape, FString& OutError)
+{
+	FVector Center;
+	double Radius = 0.0;
+	if (!ReadQueryVector(Obj, TEXT("center"), Center) || !Obj.TryGetNumberField(TEXT("radius"), Radius) || Radius <= 0.0)
+	{
+		OutError = TEXT("sphere needs center and a positive radius");
+		return false;
+	}
+	OutShape = FSceneQueryShape::MakeSphere(Center, Radius);
+	return true;
+}
+
+bool ParseFrustumShape(const FJsonObject& Obj, FSceneQueryShape& OutShape, FString& OutError)
+{
+	FVector Origin;
+	if (!ReadQueryVector(Obj, TEXT("origin"), Origin))
+	{
+		OutError = TEXT("frustum needs origin");
+		return false;
+	}
+
+	FVector PitchYawRoll = FVector::ZeroVector;
+	const TSharedPtr<FJsonValue> RotationValue = Obj.TryGetField(TEXT("rotation"));
+	if (RotationValue.IsValid() && !ReadQueryTriple(RotationValue, TEXT("pitch"), TEXT("yaw"), TEXT("roll"), PitchYawRoll))
+	{
+		OutError = TEXT("frustum.rotation must be [pitch,yaw,roll] or {pitch,yaw,roll}");
+		return false;
+	}
+
+	double Fov = 90.0;
+	double Aspect = 16.0 / 9.0;
+	double NearPlane = 10.0;
+	double FarPlane = 100000.0;
+	Obj.TryGetNumberField(TEXT("fov"), Fov);
+	Obj.TryGetNumberField(TEXT("aspect"), Aspect);
+	Obj.TryGetNumberField(TEXT("near"), NearPlane);
+	Obj.TryGetNumberField(TEXT("far"), FarPlane);
+	if (Fov <= 0.0 || Fov >= 180.0 || Aspect <= 0.0 || NearPlane <= 0.0 || FarPlane <= NearPlane)
+	{
+		OutError = TEXT("frustum needs 0 < fov < 180, aspect > 0 and 0 < near < far");
+		return false;
+	}
+
+	const FRotator Rotation(PitchYawRoll.X, PitchYawRoll.Y, PitchYawRoll.Z);
+	OutShape = FSceneQueryShape::MakeFrustum(Origin, Rotation, Fov, Aspect, NearPlane, FarPlane);
+	return true;
+}
+} // namespace
+
+FSceneQueryShape FSceneQueryShape::MakeBox(const FBox& Box)
+{
+	FSceneQueryShape Shape;
+	Shape.Kind = ESceneQueryShape::Box;
+	Shape.Bounds = Box;
+	return Shape;
+}
+
+FSceneQueryShape FSceneQueryShape::MakeSphere(const FVector& InCenter, double InRadius)
+{
+	FSceneQueryShape Shape;
+	Shape.Kind = ESceneQueryShape::Sphere;
+	Shape.Center = InCenter;
+	Shape.Radius = InRadius;
+	Shape.Bounds = FBox::BuildAABB(InCenter, FVector(InRadius));
+	return Shape;
+}
+
+FSceneQueryShape FSceneQueryShape::MakeFrustum(const FVector& Origin, const FRotator& Rotation, double FovDegrees, double Aspect, double NearPlane, double FarPlane)
+{
+	FSceneQueryShape Shape;
+	Shape.Kind = ESceneQueryShape::Frustum;
+
+	// Unreal cameras: X forward, Y right, Z up; fov is horizontal.
+	const FRotationMatrix Axes(Rotation);
+	const FVector Forward = Axes.GetScaledAxis(EAxis::X);
+	const FVector Right = Axes.GetScaledAxis(EAxis::Y);
+	const FVector Up = Axes.GetScaledAxis(EAxis::Z);
+	const double TanHalfFov = FMath::Tan(FMath::DegreesToRadians(FovDegrees * 0.5));
+
+	FVector Corners[8];
+	const double Depths[2] = { NearPlane, FarPlane };
+	for (int32 DepthIndex = 0; DepthIndex < 2; ++DepthIndex)
+	{
+		const double HalfWidth = Depths[DepthIndex] * TanHalfFov;
+		const double HalfHeight = HalfWidth / Aspect;
+		const FVector PlaneCenter = Origin + Forward * Depths[DepthIndex];
+		Corners[DepthIndex * 4 + 0] = PlaneCenter - Right * HalfWidth - Up * HalfHeight;
+		Corners[DepthIndex * 4 + 1] = PlaneCenter + Right * HalfWidth - Up * HalfHeight;
+		Corners[DepthIndex * 4 + 2] = PlaneCenter + Right * HalfWidth + Up * HalfHeight;
+		Corners[DepthIndex * 4 + 3] = PlaneCenter - Right * HalfWidth + Up * HalfHeight;
+	}
+	Shape.Bounds = FBox(Corners, UE_ARRAY_COUNT(Corners));
+
+	// Orient every plane away from a point known to be inside, so corner winding never matters.
+	const FVector Inside = Origin + Forward * ((NearPlane + FarPlane) * 0.5);
+	auto AddPlane = [&Shape, &Inside](const FVector& A, const FVector& B, const FVector& C)
+	{
+		FPlane Plane(A, B, C);
+		if (Plane.PlaneDot(Inside) > 0.0)
+		{
+			Plane = Plane.Flip();
+		}
+		Shape.Planes.Add(Plane);
+	};
+	AddPlane(Corners[0], Corners[1], Corners[2]);
+	AddPlane(Corners[4], Corners[5], Corners[6]);
+	for (int32 Edge = 0; Edge < 4; ++Edge)
+	{
+		const int32 Next = (Edge + 1) % 4;
+		AddPlane(Corners[Edge], Corners[Next], Corners[4 + Edge]);
+	}
+	return Shape;
+}
+
+bool FSceneQueryShape::Intersects(const FBox& ActorBounds) const
+{
+	if (!ActorBounds.IsValid || !Bounds.Intersect(ActorBounds))
+	{
+		return false;
+	}
+
+	switch (Kind)
+	{
+	case ESceneQueryShape::Sphere:
+		return ActorBounds.ComputeSquaredDistanceToPoint(Center) <= FMath::Square(Radius);
+	case ESceneQueryShape::Frustum:
+	{
+		const FVector BoxCenter = ActorBounds.GetCenter();
+		const FVector BoxExtent = ActorBounds.GetExtent();
+		for (const FPlane& Plane : Planes)
+		{
+			const double PushOut = FMath::Abs(Plane.X) * BoxExtent.X + FMath::Abs(Plane.Y) * BoxExtent.Y + FMath::Abs(Plane.Z) * BoxExtent.Z;
+			if (Plane.PlaneDot(BoxCenter) > PushOut)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return true;
+	}
+}
+
+bool ParseSceneQueryShape(const FJsonObject& Body, FSceneQueryShape& OutShape, FString& OutError)
+{
+	const TSharedPtr<FJsonObject>* Box = nullptr;
+	const TSharedPtr<FJsonObject>* Sphere = nullptr;
+	const TSharedPtr<FJsonObject>* Frustum = nullptr;
+	const bool bBox = Body.TryGetObjectField(TEXT("box"), Box);
+	const bool bSphere = Body.TryGetObjectField(TEXT("sphere"), Sphere);
+	const bool bFrustum = Body.TryGetObjectField(TEXT("frustum"), Frustum);
+	if (static_cast<int32>(bBox) + static_cast<int32>(bSphere) + static_cast<int32>(bFrustum) != 1)
+	{
+		OutError = TEXT("Provide exactly one of box, sphere or frustum");
+		return false;
+	}
+
+	if (bBox)
+	{
+		return ParseBoxShape(**Box, OutShape, OutError);
+	}
+	if (bSphere)
+	{
+		return ParseSphereShape(**Sphere, OutShape, OutError);
+	}
+	return ParseFrustumShape(**Frustum, OutShape, OutError);
+}
+} // namespace NovaBridgeCore
@@ -0,0 +1,165 @@
+#include "NovaBridgeSceneSnapshot.h"
+
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace NovaBridgeCore
+{
+namespace
+{
+void WriteCompactSnapshotVector(FSnapshotJsonWriter& Writer, const TCHAR* Identifier, double X, double Y, double Z, int32 Precision)
+{
+	Writer.WriteArrayStart(Identifier);
+	Writer.WriteRawJSONValue(FormatCompactNumber(X, Precision));
+	Writer.WriteRawJSONValue(FormatCompactNumber(Y, Precision));
+	Writer.WriteRawJSONValue(FormatCompactNumber(Z, Precision));
+	Writer.WriteArrayEnd();
+}
+
+bool IsCompactVectorAll(const FVector& Value, const TCHAR* Default, int32 Precision)
+{
+	return FormatCompactNumber(Value.X, Precision) == Default && FormatCompactNumber(Value.Y, Precision) == Default
+		&& FormatCompactNumber(Value.Z, Precision) == Default;
+}
+
+void WriteCompactActorSnapshot(FSnapshotJsonWriter& Writer, const FActorSnapshot& Actor, ESceneField Fields, int32 Precision)
+{
+	Writer.WriteObjectStart();
+	if (EnumHasAnyFlags(Fields, ESceneField::Name))
+	{
+		Writer.WriteValue(TEXT("name"), Actor.Name.ToString());
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Label) && !Actor.Label.IsEmpty())
+	{
+		Writer.WriteValue(TEXT("label"), Actor.Label);
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Class))
+	{
+		Writer.WriteValue(TEXT("class"), Actor.ClassName.ToString());
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Path) && !Actor.Path.IsEmpty())
+	{
+		Writer.WriteValue(TEXT("path"), Actor.Path);
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Tags))
+	{
+		Writer.WriteArrayStart(TEXT("tags"));
+		for (const FName& Tag : Actor.Tags)
+		{
+			Writer.WriteValue(Tag.ToString());
+		}
+		Writer.WriteArrayEnd();
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Transform))
+	{
+		Writer.WriteObjectStart(TEXT("transform"));
+		WriteCompactSnapshotVector(Writer, TEXT("location"), Actor.Location.X, Actor.Location.Y, Actor.Location.Z, Precision);
+		const FVector Rotation(Actor.Rotation.Pitch, Actor.Rotation.Yaw, Actor.Rotation.Roll);
+		if (!IsCompactVectorAll(Rotation, TEXT("0"), Precision))
+		{
+			WriteCompactSnapshotVector(Writer, TEXT("rotation"), Rotation.X, Rotation.Y, Rotation.Z, Precision);
+		}
+		if (!IsCompactVectorAll(Actor.Scale, TEXT("1"), Precision))
+		{
+			WriteCompactSnapshotVector(Writer, TEXT("scale"), Actor.Scale.X, Actor.Scale.Y, Actor.Scale.Z, Precision);
+		}
+		Writer.WriteObjectEnd();
+	}
+	Writer.WriteObjectEnd();
+}
+} // namespace
+
+void WriteActorSnapshot(FSnapshotJsonWriter& Writer, const FActorSnapshot& Actor, ESceneField Fields, const FResponseProfile& Profile)
+{
+	if (Profile.bCompact)
+	{
+		WriteCompactActorSnapshot(Writer, Actor, Fields, Profile.Precision);
+		return;
+	}
+
+	Writer.WriteObjectStart();
+	if (EnumHasAnyFlags(Fields, ESceneField::Name))
+	{
+		Writer.WriteValue(TEXT("name"), Actor.Name.ToString());
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Label))
+	{
+		Writer.WriteValue(TEXT("label"), Actor.Label);
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Class))
+	{
+		Writer.WriteValue(TEXT("class"), Actor.ClassName.ToString());
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Path))
+	{
+		Writer.WriteValue(TEXT("path"), Actor.Path);
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Tags))
+	{
+		Writer.WriteArrayStart(TEXT("tags"));
+		for (const FName& Tag : Actor.Tags)
+		{
+			Writer.WriteValue(Tag.ToString());
+		}
+		Writer.WriteArrayEnd();
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Transform))
+	{
+		Writer.WriteObjectStart(TEXT("transform"));
+		Writer.WriteObjectStart(TEXT("location"));
+		Writer.WriteValue(TEXT("x"), Actor.Location.X);
+		Writer.WriteValue(TEXT("y"), Actor.Location.Y);
+		Writer.WriteValue(TEXT("z"), Actor.Location.Z);
+		Writer.WriteObjectEnd();
+		Writer.WriteObjectStart(TEXT("rotation"));
+		Writer.WriteValue(TEXT("pitch"), Actor.Rotation.Pitch);
+		Writer.WriteValue(TEXT("yaw"), Actor.Rotation.Yaw);
+		Writer.WriteValue(TEXT("roll"), Actor.Rotation.Roll);
+		Writer.WriteObjectEnd();
+		Writer.WriteObjectStart(TEXT("scale"));
+		Writer.WriteValue(TEXT("x"), Actor.Scale.X);
+		Writer.WriteValue(TEXT("y"), Actor.Scale.Y);
+		Writer.WriteValue(TEXT("z"), Actor.Scale.Z);
+		Writer.WriteObjectEnd();
+		Writer.WriteObjectEnd();
+	}
+	Writer.WriteObjectEnd();
+}
+
+FString EncodeActorSnapshotsJson(TConstArrayView<FActorSnapshot> Actors, ESceneField Fields, const FResponseProfile& Profile, int32 ChunkSize)
+{
+	return EncodeJsonArrayParallel(Actors, [Fields, &Profile](FSnapshotJsonWriter& Writer, const FActorSnapshot& Actor)
+	{
+		WriteActorSnapshot(Writer, Actor, Fields, Profile);
+	}, ChunkSize);
+}
+
+FString ComposeJsonBody(const TSharedRef<FJsonObject>& Envelope, const TCHAR* ArrayField, const FString& ArrayJson, const FResponseProfile& Profile)
+{
+	FString Body;
+	TSharedRef<FSnapshotJsonWriter> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Body);
+	if (Profile.bCompact)
+	{
+		WriteCompactJson(*Writer, *Envelope, Profile.Precision);
+		Writer->Close();
+	}
+	else
+	{
+		FJsonSerializer::Serialize(Envelope, Writer);
+	}
+
+	// Reopen the closing brace and append the array as the last field.
+	Body.LeftChopInline(1, EAllowShrinking::No);
+	Body.Reserve(Body.Len() + ArrayJson.Len() + FCString::Strlen(ArrayField) + 8);
+	if (Body.Len() > 1)
+	{
+		Body.AppendChar(TEXT(','));
+	}
+	Body.AppendChar(TEXT('"'));
+	Body.Append(ArrayField);
+	Body.Append(TEXT("\":"));
+	Body.Append(ArrayJson);
+	Body.AppendChar(TEXT('}'));
+	return Body;
+}
+} // namespace NovaBridgeCore
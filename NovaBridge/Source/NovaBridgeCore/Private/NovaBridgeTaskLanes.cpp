@@ -0,0 +1,135 @@
+#include "NovaBridgeTaskLanes.h"
+
+namespace NovaBridgeCore
+{
+namespace
+{
+int32 TaskLaneIndex(ETaskLane Lane)
+{
+	const int32 Index = static_cast<int32>(Lane);
+	return Index >= 0 && Index < TaskLaneCount ? Index : 0;
+}
+} // namespace
+
+const TCHAR* TaskLaneToString(ETaskLane Lane)
+{
+	switch (Lane)
+	{
+	case ETaskLane::Interactive:
+		return TEXT("interactive");
+	case ETaskLane::Mutating:
+		return TEXT("mutating");
+	case ETaskLane::Heavy:
+		return TEXT("heavy");
+	default:
+		return TEXT("interactive");
+	}
+}
+
+ETaskLane TaskLaneForRouteClass(ERouteClass Class)
+{
+	switch (Class)
+	{
+	case ERouteClass::Write:
+		return ETaskLane::Mutating;
+	case ERouteClass::Heavy:
+		return ETaskLane::Heavy;
+	default:
+		return ETaskLane::Interactive;
+	}
+}
+
+void FTaskLaneQueue::SetBudgetMs(ETaskLane Lane, double BudgetMs)
+{
+	Lanes[TaskLaneIndex(Lane)].BudgetMs.store(FMath::Max(0.0, BudgetMs), std::memory_order_relaxed);
+}
+
+void FTaskLaneQueue::Enqueue(ETaskLane Lane, TUniqueFunction<void()>&& Task)
+{
+	FQueuedTask Queued;
+	Queued.Run = MoveTemp(Task);
+	EnqueueTask(Lane, MoveTemp(Queued));
+}
+
+void FTaskLaneQueue::EnqueueNextDrain(ETaskLane Lane, TUniqueFunction<void()>&& Task)
+{
+	FQueuedTask Queued;
+	Queued.Run = MoveTemp(Task);
+	Queued.NotBeforeDrain = DrainSerial.load(std::memory_order_relaxed) + 1;
+	EnqueueTask(Lane, MoveTemp(Queued));
+}
+
+void FTaskLaneQueue::EnqueueTask(ETaskLane Lane, FQueuedTask&& Task)
+{
+	FLane& State = Lanes[TaskLaneIndex(Lane)];
+	// Counted before it is visible, so a drain never sees more tasks than Depth.
+	const int32 Depth = State.Depth.fetch_add(1, std::memory_order_relaxed) + 1;
+	State.Tasks.Enqueue(MoveTemp(Task));
+
+	int32 Peak = State.PeakDepth.load(std::memory_order_relaxed);
+	while (Depth > Peak && !State.PeakDepth.compare_exchange_weak(Peak, Depth, std::memory_order_relaxed))
+	{
+	}
+}
+
+int32 FTaskLaneQueue::Drain(TFunctionRef<double()> Clock)
+{
+	const uint64 Serial = DrainSerial.fetch_add(1, std::memory_order_relaxed) + 1;
+	int32 TotalRan = 0;
+	for (FLane& State : Lanes)
+	{
+		int32 Remaining = State.Depth.load(std::memory_order_relaxed);
+		if (Remaining <= 0)
+		{
+			continue;
+		}
+
+		const double BudgetMs = State.BudgetMs.load(std::memory_order_relaxed);
+		const double StartSec = Clock();
+		int32 Ran = 0;
+		while (Remaining-- > 0)
+		{
+			if (Ran > 0 && BudgetMs > 0.0 && (Clock() - StartSec) * 1000.0 >= BudgetMs)
+			{
+				State.Deferred.fetch_add(1, std::memory_order_relaxed);
+				break;
+			}
+			const FQueuedTask* Next = State.Tasks.Peek();
+			if (!Next || Next->NotBeforeDrain > Serial)
+			{
+				break;
+			}
+			FQueuedTask Task;
+			State.Tasks.Dequeue(Task);
+			State.Depth.fetch_sub(1, std::memory_order_relaxed);
+			Task.Run();
+			++Ran;
+		}
+		State.Ran.fetch_add(static_cast<uint64>(Ran), std::memory_order_relaxed);
+		TotalRan += Ran;
+	}
+	return TotalRan;
+}
+
+FTaskLaneStats FTaskLaneQueue::GetStats(ETaskLane Lane) const
+{
+	const FLane& State = Lanes[TaskLaneIndex(Lane)];
+	FTaskLaneStats Stats;
+	Stats.Depth = FMath::Max(0, State.Depth.load(std::memory_order_relaxed));
+	Stats.PeakDepth = State.PeakDepth.load(std::memory_order_relaxed);
+	Stats.Ran = State.Ran.load(std::memory_order_relaxed);
+	Stats.Deferred = State.Deferred.load(std::memory_order_relaxed);
+	Stats.BudgetMs = State.BudgetMs.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+void FTaskLaneQueue::ResetStats()
+{
+	for (FLane& State : Lanes)
+	{
+		State.PeakDepth.store(State.Depth.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		State.Ran.store(0, std::memory_order_relaxed);
+		State.Deferred.store(0, std::memory_order_relaxed);
+	}
+}
+} // namespace NovaBridgeCore
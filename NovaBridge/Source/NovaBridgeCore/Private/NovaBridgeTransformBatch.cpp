@@ -0,0 +1,223 @@
+#include "NovaBridgeTransformBatch.h"
+
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "Transform records are copied straight from little-endian wire bytes");
+
+namespace NovaBridgeCore
+{
+namespace
+{
+constexpr uint8 TransformBatchMagic[4] = { 'N', 'B', 'T', 'X' };
+
+uint32 ReadBatchUInt32(const uint8* Data)
+{
+	uint32 Value = 0;
+	FMemory::Memcpy(&Value, Data, sizeof(Value));
+	return Value;
+}
+
+void AppendBatchUInt32(TArray<uint8>& Bytes, uint32 Value)
+{
+	Bytes.Append(reinterpret_cast<const uint8*>(&Value), sizeof(Value));
+}
+
+bool ReadTransformTriple(const TSharedPtr<FJsonValue>& Value, const TCHAR* A, const TCHAR* B, const TCHAR* C, double& OutA, double& OutB, double& OutC)
+{
+	if (Value->Type == EJson::Array)
+	{
+		const TArray<TSharedPtr<FJsonValue>>& Values = Value->AsArray();
+		return Values.Num() == 3 && Values[0]->TryGetNumber(OutA) && Values[1]->TryGetNumber(OutB) && Values[2]->TryGetNumber(OutC);
+	}
+	const TSharedPtr<FJsonObject>* Obj = nullptr;
+	return Value->TryGetObject(Obj) && Obj && (*Obj)->TryGetNumberField(A, OutA) && (*Obj)->TryGetNumberField(B, OutB)
+		&& (*Obj)->TryGetNumberField(C, OutC);
+}
+
+bool IsUpdateFinite(const FTransformUpdate& Update)
+{
+	return !Update.Location.ContainsNaN() && !Update.Scale.ContainsNaN() && !Update.Rotation.ContainsNaN();
+}
+
+bool ParseJsonUpdate(const FJsonObject& Entry, int32 Index, FTransformUpdate& OutUpdate, FString& OutError)
+{
+	if (!Entry.TryGetStringField(TEXT("name"), OutUpdate.Name) || OutUpdate.Name.IsEmpty())
+	{
+		OutError = FString::Printf(TEXT("updates[%d] is missing 'name'"), Index);
+		return false;
+	}
+
+	struct FComponent
+	{
+		const TCHAR* Field;
+		const TCHAR* Keys[3];
+		ETransformField Flag;
+		double* Out[3];
+	};
+	const FComponent Components[] = {
+		{ TEXT("location"), { TEXT("x"), TEXT("y"), TEXT("z") }, ETransformField::Location, { &OutUpdate.Location.X, &OutUpdate.Location.Y, &OutUpdate.Location.Z } },
+		{ TEXT("rotation"), { TEXT("pitch"), TEXT("yaw"), TEXT("roll") }, ETransformField::Rotation, { &OutUpdate.Rotation.Pitch, &OutUpdate.Rotation.Yaw, &OutUpdate.Rotation.Roll } },
+		{ TEXT("scale"), { TEXT("x"), TEXT("y"), TEXT("z") }, ETransformField::Scale, { &OutUpdate.Scale.X, &OutUpdate.Scale.Y, &OutUpdate.Scale.Z } },
+	};
+	for (const FComponent& Component : Components)
+	{
+		const TSharedPtr<FJsonValue> Value = Entry.TryGetField(Component.Field);
+		if (!Value.IsValid())
+		{
+			continue;
+		}
+		if (!ReadTransformTriple(Value, Component.Keys[0], Component.Keys[1], Component.Keys[2], *Component.Out[0], *Component.Out[1], *Component.Out[2]))
+		{
+			OutError = FString::Printf(TEXT("updates[%d].%s must be [%s,%s,%s] or {%s,%s,%s}"), Index, Component.Field,
+				Component.Keys[0], Component.Keys[1], Component.Keys[2], Component.Keys[0], Component.Keys[1], Component.Keys[2]);
+			return false;
+		}
+		OutUpdate.Fields |= Component.Flag;
+	}
+
+	if (OutUpdate.Fields == ETransformField::None)
+	{
+		OutError = FString::Printf(TEXT("updates[%d] needs location, rotation or scale"), Index);
+		return false;
+	}
+	if (!IsUpdateFinite(OutUpdate))
+	{
+		OutError = FString::Printf(TEXT("updates[%d] contains NaN or infinite values"), Index);
+		return false;
+	}
+	return true;
+}
+} // namespace
+
+bool ParseTransformBatchBinary(const uint8* Data, int64 Size, TArray<FTransformUpdate>& OutUpdates, FString& OutError)
+{
+	if (!Data || Size < TransformBatchHeaderSize || FMemory::Memcmp(Data, TransformBatchMagic, sizeof(TransformBatchMagic)) != 0)
+	{
+		OutError = TEXT("Binary transform batch must start with the 'NBTX' header");
+		return false;
+	}
+
+	const uint32 Version = ReadBatchUInt32(Data + 4);
+	const uint32 Count = ReadBatchUInt32(Data + 12);
+	if (Version != TransformBatchBinaryVersion)
+	{
+		OutError = FString::Printf(TEXT("Unsupported transform batch version %u"), Version);
+		return false;
+	}
+	if (Count == 0 || Count > static_cast<uint32>(MaxTransformBatchUpdates))
+	{
+		OutError = FString::Printf(TEXT("Transform batch needs 1 to %d updates"), MaxTransformBatchUpdates);
+		return false;
+	}
+	if (Size < TransformBatchHeaderSize + static_cast<int64>(Count) * TransformBatchRecordSize)
+	{
+		OutError = FString::Printf(TEXT("Binary transform batch is %lld bytes, too short for %u updates"), Size, Count);
+		return false;
+	}
+
+	OutUpdates.Reset(static_cast<int32>(Count));
+	const uint8* Cursor = Data + TransformBatchHeaderSize;
+	const uint8* End = Data + Size;
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		if (End - Cursor < static_cast<int64>(TransformBatchRecordSize))
+		{
+			OutError = FString::Printf(TEXT("Binary transform batch ends inside update %u"), Index);
+			return false;
+		}
+
+		float Values[9];
+		const uint32 Fields = ReadBatchUInt32(Cursor);
+		FMemory::Memcpy(Values, Cursor + 4, sizeof(Values));
+		const uint32 NameLength = ReadBatchUInt32(Cursor + 40);
+		Cursor += TransformBatchRecordSize;
+		if (NameLength == 0 || NameLength > static_cast<uint32>(MaxTransformBatchNameBytes) || End - Cursor < static_cast<int64>(NameLength))
+		{
+			OutError = FString::Printf(TEXT("Update %u has an invalid name length %u"), Index, NameLength);
+			return false;
+		}
+		if (Fields == 0 || (Fields & ~static_cast<uint32>(ETransformField::All)) != 0)
+		{
+			OutError = FString::Printf(TEXT("Update %u has invalid field mask %u"), Index, Fields);
+			return false;
+		}
+
+		FTransformUpdate& Update = OutUpdates.AddDefaulted_GetRef();
+		Update.Fields = static_cast<ETransformField>(Fields);
+		Update.Location = FVector(Values[0], Values[1], Values[2]);
+		Update.Rotation = FRotator(Values[3], Values[4], Values[5]);
+		Update.Scale = FVector(Values[6], Values[7], Values[8]);
+		const FUTF8ToTCHAR Name(reinterpret_cast<const ANSICHAR*>(Cursor), static_cast<int32>(NameLength));
+		Update.Name = FString(Name.Length(), Name.Get());
+		Cursor += NameLength;
+		if (!IsUpdateFinite(Update))
+		{
+			OutError = FString::Printf(TEXT("Update %u contains NaN or infinite values"), Index);
+			return false;
+		}
+	}
+
+	if (Cursor != End)
+	{
+		OutError = FString::Printf(TEXT("Binary transform batch has %lld trailing bytes"), static_cast<int64>(End - Cursor));
+		return false;
+	}
+	return true;
+}
+
+bool ParseTransformBatchJson(const FJsonObject& Body, TArray<FTransformUpdate>& OutUpdates, FString& OutError)
+{
+	const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+	if (!Body.TryGetArrayField(TEXT("updates"), Entries) || Entries->Num() == 0)
+	{
+		OutError = TEXT("Missing 'updates' array");
+		return false;
+	}
+	if (Entries->Num() > MaxTransformBatchUpdates)
+	{
+		OutError = FString::Printf(TEXT("Transform batch needs 1 to %d updates"), MaxTransformBatchUpdates);
+		return false;
+	}
+
+	OutUpdates.Reset(Entries->Num());
+	for (int32 Index = 0; Index < Entries->Num(); ++Index)
+	{
+		const TSharedPtr<FJsonObject>* Entry = nullptr;
+		if (!(*Entries)[Index].IsValid() || !(*Entries)[Index]->TryGetObject(Entry))
+		{
+			OutError = FString::Printf(TEXT("updates[%d] is not an object"), Index);
+			return false;
+		}
+		if (!ParseJsonUpdate(**Entry, Index, OutUpdates.AddDefaulted_GetRef(), OutError))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+TArray<uint8> EncodeTransformBatchBinary(const TArray<FTransformUpdate>& Updates)
+{
+	TArray<uint8> Bytes;
+	Bytes.Reserve(static_cast<int32>(TransformBatchHeaderSize + Updates.Num() * (TransformBatchRecordSize + 32)));
+	Bytes.Append(TransformBatchMagic, UE_ARRAY_COUNT(TransformBatchMagic));
+	AppendBatchUInt32(Bytes, TransformBatchBinaryVersion);
+	AppendBatchUInt32(Bytes, 0);
+	AppendBatchUInt32(Bytes, static_cast<uint32>(Updates.Num()));
+	for (const FTransformUpdate& Update : Updates)
+	{
+		const FTCHARToUTF8 Name(*Update.Name);
+		const float Values[9] = {
+			static_cast<float>(Update.Location.X), static_cast<float>(Update.Location.Y), static_cast<float>(Update.Location.Z),
+			static_cast<float>(Update.Rotation.Pitch), static_cast<float>(Update.Rotation.Yaw), static_cast<float>(Update.Rotation.Roll),
+			static_cast<float>(Update.Scale.X), static_cast<float>(Update.Scale.Y), static_cast<float>(Update.Scale.Z),
+		};
+		AppendBatchUInt32(Bytes, static_cast<uint32>(Update.Fields));
+		Bytes.Append(reinterpret_cast<const uint8*>(Values), sizeof(Values));
+		AppendBatchUInt32(Bytes, static_cast<uint32>(Name.Length()));
+		Bytes.Append(reinterpret_cast<const uint8*>(Name.Get()), Name.Length());
+	}
+	return Bytes;
+}
+} // namespace NovaBridgeCore
@@ -0,0 +1,133 @@
+#include "NovaBridgeActorLookupIndex.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+using FTestActorIndex = NovaBridgeCore::TActorLookupIndex<int32>;
+
+void FillIndex(FTestActorIndex& Index, int32 ActorCount)
+{
+	Index.Reset();
+	for (int32 ActorId = 0; ActorId < ActorCount; ++ActorId)
+	{
+		// Every fourth actor shares a label so label buckets hold more than one handle.
+		Index.Add(ActorId, FName(*FString::Printf(TEXT("StaticMeshActor_%d"), ActorId)), FString::Printf(TEXT("Prop_%d"), ActorId / 4));
+	}
+}
+
+// Average nanoseconds per lookup, following the real path: the FString -> FName resolution, the name map,
+// then the label map when the name misses. OutFound counts queries that resolved in the last round.
+double MeasureNameLookupNs(const FTestActorIndex& Index, const TArray<FString>& Queries, int32 Rounds, int32& OutFound)
+{
+	int32 Found = 0;
+	const double StartSec = FPlatformTime::Seconds();
+	for (int32 Round = 0; Round < Rounds; ++Round)
+	{
+		Found = 0;
+		for (const FString& Query : Queries)
+		{
+			if (Index.FindByName(FName(*Query, FNAME_Find)) || Index.FindByLabel(Query))
+			{
+				++Found;
+			}
+		}
+	}
+	const double ElapsedSec = FPlatformTime::Seconds() - StartSec;
+	OutFound = Found;
+	const int32 Lookups = Queries.Num() * Rounds;
+	return Lookups > 0 ? (ElapsedSec * 1.0e9) / static_cast<double>(Lookups) : 0.0;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeActorLookupIndexNameAndLabel,
+	"NovaBridge.Core.ActorLookupIndex.NameAndLabel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeActorLookupIndexNameAndLabel::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	FTestActorIndex Index;
+	Index.Add(1, FName(TEXT("Cube_1")), TEXT("Crate"));
+	Index.Add(2, FName(TEXT("Cube_2")), TEXT("Crate"));
+	Index.Add(3, FName(TEXT("Light_1")), FString());
+
+	const FTestActorIndex::FBucket* ByName = Index.FindByName(FName(TEXT("cube_2"), FNAME_Find));
+	TestTrue(TEXT("Name lookup ignores case"), ByName && ByName->Num() == 1 && (*ByName)[0] == 2);
+
+	const FTestActorIndex::FBucket* ByLabel = Index.FindByLabel(TEXT("CRATE"));
+	TestTrue(TEXT("Label lookup returns every actor sharing the label"), ByLabel && ByLabel->Num() == 2);
+
+	Index.Relabel(1, TEXT("Barrel"));
+	ByLabel = Index.FindByLabel(TEXT("Crate"));
+	TestTrue(TEXT("Relabel moves the actor out of its old label set"), ByLabel && ByLabel->Num() == 1 && (*ByLabel)[0] == 2);
+	TestNotNull(TEXT("Relabel adds the actor under its new label"), Index.FindByLabel(TEXT("Barrel")));
+
+	Index.Remove(2);
+	TestNull(TEXT("Removed actor drops out of the name map"), Index.FindByName(FName(TEXT("Cube_2"))));
+	TestNull(TEXT("Empty label sets are pruned"), Index.FindByLabel(TEXT("Crate")));
+	TestEqual(TEXT("Entry count tracks adds and removes"), Index.Num(), 2);
+
+	Index.Add(1, FName(TEXT("Cube_1")), TEXT("Crate"));
+	TestNull(TEXT("Re-adding replaces the old label"), Index.FindByLabel(TEXT("Barrel")));
+	TestEqual(TEXT("Re-adding does not duplicate the entry"), Index.Num(), 2);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeActorLookupIndexFlatLookupCost,
+	"NovaBridge.Core.ActorLookupIndex.FlatLookupCost",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeActorLookupIndexFlatLookupCost::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	const int32 ActorCounts[] = { 1000, 10000, 40000 };
+	const int32 QueryCount = 1024;
+	const int32 Rounds = 16;
+
+	TArray<double> HitNs;
+	TArray<double> MissNs;
+	for (const int32 ActorCount : ActorCounts)
+	{
+		FTestActorIndex Index;
+		FillIndex(Index, ActorCount);
+
+		// Same query count at every size, spread across the whole index. Misses use names that are not in
+		// the index, half of which are not interned FNames at all.
+		TArray<FString> Hits;
+		TArray<FString> Misses;
+		Hits.Reserve(QueryCount);
+		Misses.Reserve(QueryCount);
+		for (int32 QueryIdx = 0; QueryIdx < QueryCount; ++QueryIdx)
+		{
+			const int32 ActorId = static_cast<int32>((static_cast<int64>(QueryIdx) * 7919) % ActorCount);
+			Hits.Add(FString::Printf(TEXT("StaticMeshActor_%d"), ActorId));
+			Misses.Add(QueryIdx % 2 == 0
+				? FString::Printf(TEXT("StaticMeshActor_%d"), ActorCount + ActorId)
+				: FString::Printf(TEXT("NovaBridgeMissingActor_%d"), ActorId));
+		}
+
+		int32 Found = 0;
+		MeasureNameLookupNs(Index, Hits, 1, Found);
+		const double Hit = MeasureNameLookupNs(Index, Hits, Rounds, Found);
+		TestEqual(FString::Printf(TEXT("Every hit query resolves at %d actors"), ActorCount), Found, QueryCount);
+		const double Miss = MeasureNameLookupNs(Index, Misses, Rounds, Found);
+		TestEqual(FString::Printf(TEXT("No miss query resolves at %d actors"), ActorCount), Found, 0);
+
+		HitNs.Add(Hit);
+		MissNs.Add(Miss);
+		AddInfo(FString::Printf(TEXT("%d actors: %.1f ns per hit, %.1f ns per miss"), ActorCount, Hit, Miss));
+	}
+
+	// A linear scan would be ~40x slower at 40k than at 1k; allow generous slack for cache effects and noisy CI hosts.
+	TestTrue(TEXT("Hit cost at 40k actors stays within 4x of 1k actors"), HitNs.Last() <= HitNs[0] * 4.0 + 50.0);
+	TestTrue(TEXT("Miss cost at 40k actors stays within 4x of 1k actors"), MissNs.Last() <= MissNs[0] * 4.0 + 50.0);
+	return true;
+}
+
+#endif
@@ -0,0 +1,100 @@
+#include "NovaBridgeAdmission.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HttpServerResponse.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeAdmissionLimits,
+	"NovaBridge.Core.Admission.Limits",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeAdmissionLimits::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::ERouteClass;
+	NovaBridgeCore::FAdmissionController Controller;
+	Controller.Configure(ERouteClass::Heavy, { 2, 0 });
+	Controller.Configure(ERouteClass::Read, { 0, 500 });
+
+	TestTrue(TEXT("Unconfigured classes admit everything"), Controller.TryAdmit(ERouteClass::Control).bAdmitted);
+	TestTrue(TEXT("The first heavy request is admitted"), Controller.TryAdmit(ERouteClass::Heavy).bAdmitted);
+	const NovaBridgeCore::FAdmissionDecision Second = Controller.TryAdmit(ERouteClass::Heavy);
+	TestTrue(TEXT("The second heavy request is admitted"), Second.bAdmitted);
+	TestEqual(TEXT("Decisions report the depth ahead of them"), Second.InFlight, 1);
+
+	const NovaBridgeCore::FAdmissionDecision Third = Controller.TryAdmit(ERouteClass::Heavy);
+	TestFalse(TEXT("A full class rejects"), Third.bAdmitted);
+	TestTrue(TEXT("Rejections carry a retry hint"), Third.RetryAfterSeconds >= 1);
+	TestEqual(TEXT("Rejections are counted"), Controller.GetStats(ERouteClass::Heavy).Rejected, static_cast<int64>(1));
+
+	Controller.Release(ERouteClass::Heavy, 3.0);
+	TestTrue(TEXT("A released slot can be reused"), Controller.TryAdmit(ERouteClass::Heavy).bAdmitted);
+	TestEqual(TEXT("The first sample seeds the average"), Controller.GetStats(ERouteClass::Heavy).AverageServiceUs, static_cast<uint64>(3000000));
+
+	// 400ms per read: one in flight estimates 400ms, two estimate 800ms, over the 500ms cap.
+	TestTrue(TEXT("Reads are admitted before any sample"), Controller.TryAdmit(ERouteClass::Read).bAdmitted);
+	Controller.Release(ERouteClass::Read, 0.4);
+	TestTrue(TEXT("An idle class fits the wait cap"), Controller.TryAdmit(ERouteClass::Read).bAdmitted);
+	TestTrue(TEXT("One read ahead fits the wait cap"), Controller.TryAdmit(ERouteClass::Read).bAdmitted);
+	const NovaBridgeCore::FAdmissionDecision OverWait = Controller.TryAdmit(ERouteClass::Read);
+	TestFalse(TEXT("A long estimated wait rejects"), OverWait.bAdmitted);
+	TestEqual(TEXT("The estimate is depth times the average"), OverWait.EstimatedWaitMs, 800);
+	TestEqual(TEXT("Retry-After rounds the estimate up"), OverWait.RetryAfterSeconds, 1);
+	TestEqual(TEXT("Peak depth is kept"), Controller.GetStats(ERouteClass::Read).PeakInFlight, 2);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeAdmissionCallbacks,
+	"NovaBridge.Core.Admission.Callbacks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeAdmissionCallbacks::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::ERouteClass;
+	NovaBridgeCore::FAdmissionController Controller;
+
+	int32 Responses = 0;
+	const FHttpResultCallback Sink = [&Responses](TUniquePtr<FHttpServerResponse>&& Response)
+	{
+		(void)Response;
+		++Responses;
+	};
+
+	Controller.TryAdmit(ERouteClass::Write);
+	{
+		const FHttpResultCallback Wrapped = NovaBridgeCore::WrapResultCallbackWithAdmission(Controller, ERouteClass::Write, Sink);
+		const FHttpResultCallback Copy = Wrapped;
+		Copy(FHttpServerResponse::Create(TEXT("{}"), TEXT("application/json")));
+		TestEqual(TEXT("Responding releases the slot"), Controller.GetStats(ERouteClass::Write).InFlight, 0);
+		Wrapped(FHttpServerResponse::Create(TEXT("{}"), TEXT("application/json")));
+		TestEqual(TEXT("A slot is released only once"), Controller.GetStats(ERouteClass::Write).InFlight, 0);
+	}
+	TestEqual(TEXT("Responses still reach the caller"), Responses, 2);
+
+	Controller.TryAdmit(ERouteClass::Write);
+	{
+		const FHttpResultCallback Dropped = NovaBridgeCore::WrapResultCallbackWithAdmission(Controller, ERouteClass::Write, Sink);
+		TestEqual(TEXT("The slot is held while the callback lives"), Controller.GetStats(ERouteClass::Write).InFlight, 1);
+	}
+	TestEqual(TEXT("A callback dropped without a response releases its slot"), Controller.GetStats(ERouteClass::Write).InFlight, 0);
+
+	Controller.Configure(ERouteClass::Write, { 1, 0 });
+	Controller.TryAdmit(ERouteClass::Write);
+	const NovaBridgeCore::FAdmissionDecision Rejected = Controller.TryAdmit(ERouteClass::Write);
+	TArray<FString> RetryAfter;
+	TArray<FString> Depth;
+	NovaBridgeCore::WrapResultCallbackWithAdmissionHeaders(Rejected, [&RetryAfter, &Depth](TUniquePtr<FHttpServerResponse>&& Response)
+	{
+		RetryAfter = Response->Headers.FindRef(TEXT("Retry-After"));
+		Depth = Response->Headers.FindRef(TEXT("X-NovaBridge-Queue-Depth"));
+	})(FHttpServerResponse::Create(TEXT("{}"), TEXT("application/json")));
+	TestEqual(TEXT("Rejections send Retry-After"), RetryAfter.Num(), 1);
+	TestEqual(TEXT("Rejections send the queue depth"), Depth.Num() == 1 ? Depth[0] : FString(), FString(TEXT("1")));
+	return true;
+}
+
+#endif
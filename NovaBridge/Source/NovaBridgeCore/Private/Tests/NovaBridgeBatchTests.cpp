@@ -0,0 +1,108 @@
+#include "NovaBridgeBatch.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+TSharedPtr<FJsonObject> ParseBatchTestJson(const FString& Json)
+{
+	TSharedPtr<FJsonObject> Object;
+	FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Object);
+	return Object;
+}
+
+TArray<uint8> BatchTestUtf8(const FString& Text)
+{
+	const FTCHARToUTF8 Utf8(*Text, Text.Len());
+	return TArray<uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeBatchParse,
+	"NovaBridge.Core.Batch.Parse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeBatchParse::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	TArray<NovaBridgeCore::FBatchSubRequest> Requests;
+	bool bStopOnError = false;
+	FString Error;
+
+	const TSharedPtr<FJsonObject> Body = ParseBatchTestJson(
+		TEXT("{\"stop_on_error\":true,\"requests\":[")
+		TEXT("{\"route\":\"/nova/viewport/camera/get\"},")
+		TEXT("{\"route\":\"/nova/viewport/camera/set\",\"body\":{\"fov\":60}},")
+		TEXT("{\"route\":\"/nova/scene/list\",\"query\":{\"limit\":10,\"class\":\"PointLight\"}},")
+		TEXT("{\"route\":\"/nova/scene/get\",\"method\":\"post\",\"body\":{\"name\":\"Cube\"}}]}"));
+	TestTrue(TEXT("A valid batch parses"), NovaBridgeCore::ParseBatchRequest(*Body, Requests, bStopOnError, Error));
+	TestTrue(TEXT("stop_on_error is read"), bStopOnError);
+	TestEqual(TEXT("Every entry is kept in order"), Requests.Num(), 4);
+	TestTrue(TEXT("No body means GET"), Requests[0].Verb == EHttpServerRequestVerbs::VERB_GET);
+	TestTrue(TEXT("A body means POST"), Requests[1].Verb == EHttpServerRequestVerbs::VERB_POST);
+	TestEqual(TEXT("Bodies are compact UTF-8 JSON"), Requests[1].Body, BatchTestUtf8(TEXT("{\"fov\":60}")));
+	TestEqual(TEXT("Numeric query values become strings"), Requests[2].QueryParams.FindRef(TEXT("limit")), FString(TEXT("10")));
+	TestTrue(TEXT("Methods are case-insensitive"), Requests[3].Verb == EHttpServerRequestVerbs::VERB_POST);
+
+	TestFalse(TEXT("An empty batch is rejected"), NovaBridgeCore::ParseBatchRequest(*ParseBatchTestJson(TEXT("{\"requests\":[]}")), Requests, bStopOnError, Error));
+	TestFalse(TEXT("Routes outside /nova/ are rejected"), NovaBridgeCore::ParseBatchRequest(*ParseBatchTestJson(TEXT("{\"requests\":[{\"route\":\"/other\"}]}")), Requests, bStopOnError, Error));
+	TestFalse(TEXT("Query strings in the route are rejected"), NovaBridgeCore::ParseBatchRequest(*ParseBatchTestJson(TEXT("{\"requests\":[{\"route\":\"/nova/scene/list?limit=1\"}]}")), Requests, bStopOnError, Error));
+	TestFalse(TEXT("Other methods are rejected"), NovaBridgeCore::ParseBatchRequest(*ParseBatchTestJson(TEXT("{\"requests\":[{\"route\":\"/nova/health\",\"method\":\"DELETE\"}]}")), Requests, bStopOnError, Error));
+
+	FString TooMany = TEXT("{\"requests\":[");
+	for (int32 Index = 0; Index <= NovaBridgeCore::BatchMaxRequests; ++Index)
+	{
+		TooMany += Index > 0 ? TEXT(",{\"route\":\"/nova/health\"}") : TEXT("{\"route\":\"/nova/health\"}");
+	}
+	TooMany += TEXT("]}");
+	TestFalse(TEXT("Oversized batches are rejected"), NovaBridgeCore::ParseBatchRequest(*ParseBatchTestJson(TooMany), Requests, bStopOnError, Error));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeBatchCompose,
+	"NovaBridge.Core.Batch.Compose",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeBatchCompose::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	TArray<NovaBridgeCore::FBatchResult> Results;
+	NovaBridgeCore::FBatchResult& Camera = Results.AddDefaulted_GetRef();
+	Camera.Route = TEXT("/nova/viewport/camera/get");
+	Camera.Status = 200;
+	Camera.ContentType = TEXT("application/json");
+	Camera.Body = BatchTestUtf8(TEXT("{\"fov\":90,\"label\":\"caf\u00e9\"}"));
+
+	NovaBridgeCore::FBatchResult& Screenshot = Results.AddDefaulted_GetRef();
+	Screenshot.Route = TEXT("/nova/viewport/screenshot");
+	Screenshot.Status = 200;
+	Screenshot.ContentType = TEXT("image/png");
+	Screenshot.Body = { 0x89, 'P', 'N', 'G' };
+
+	const FString Json = NovaBridgeCore::ComposeBatchResponseJson(Results, 3);
+	const TSharedPtr<FJsonObject> Parsed = ParseBatchTestJson(Json);
+	TestTrue(TEXT("The composed response is valid JSON"), Parsed.IsValid());
+	if (!Parsed.IsValid())
+	{
+		return false;
+	}
+	TestEqual(TEXT("Requested count is reported"), static_cast<int32>(Parsed->GetNumberField(TEXT("requested"))), 3);
+	TestEqual(TEXT("Completed count is reported"), static_cast<int32>(Parsed->GetNumberField(TEXT("completed"))), 2);
+
+	const TArray<TSharedPtr<FJsonValue>>& Entries = Parsed->GetArrayField(TEXT("results"));
+	const TSharedPtr<FJsonObject> CameraBody = Entries[0]->AsObject()->GetObjectField(TEXT("body"));
+	TestEqual(TEXT("JSON bodies are spliced in"), CameraBody->GetStringField(TEXT("label")), FString(TEXT("caf\u00e9")));
+	TestEqual(TEXT("Methods are reported"), Entries[0]->AsObject()->GetStringField(TEXT("method")), FString(TEXT("GET")));
+	TestEqual(TEXT("Binary bodies are base64"), Entries[1]->AsObject()->GetStringField(TEXT("body_base64")), FString(TEXT("iVBORw==")));
+	TestEqual(TEXT("Binary bodies keep their content type"), Entries[1]->AsObject()->GetStringField(TEXT("content_type")), FString(TEXT("image/png")));
+	return true;
+}
+
+#endif
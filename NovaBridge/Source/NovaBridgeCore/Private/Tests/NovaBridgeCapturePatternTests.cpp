@@ -0,0 +1,35 @@
+#include "NovaBridgeCapturePattern.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeCapturePatternSoftware,
+	"NovaBridge.Core.CapturePattern.Software",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeCapturePatternSoftware::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	TArray<FColor> Pixels;
+	NovaBridgeCore::FillSoftwareCapturePattern(64, 48, Pixels);
+	TestEqual(TEXT("One pixel per texel"), Pixels.Num(), 64 * 48);
+	TestTrue(TEXT("The top-left corner is dark"), Pixels[0] == FColor(0, 0, 64, 255));
+	TestTrue(TEXT("Red reaches full at the right edge"), Pixels[63].R == 255 && Pixels[63].G == 0);
+	TestTrue(TEXT("Green reaches full at the bottom edge"), Pixels[47 * 64].G == 255 && Pixels[47 * 64].R == 0);
+	TestEqual(TEXT("The checker flips every 32 pixels"), static_cast<int32>(Pixels[32].B), 192);
+	TestEqual(TEXT("Every pixel is opaque"), static_cast<int32>(Pixels[47 * 64 + 40].A), 255);
+
+	TArray<FColor> Again;
+	NovaBridgeCore::FillSoftwareCapturePattern(64, 48, Again);
+	TestTrue(TEXT("The pattern is deterministic"), Pixels == Again);
+
+	NovaBridgeCore::FillSoftwareCapturePattern(1, 1, Again);
+	TestEqual(TEXT("A 1x1 target does not divide by zero"), Again.Num(), 1);
+	NovaBridgeCore::FillSoftwareCapturePattern(-4, 8, Again);
+	TestEqual(TEXT("Negative sizes give an empty image"), Again.Num(), 0);
+	return true;
+}
+
+#endif
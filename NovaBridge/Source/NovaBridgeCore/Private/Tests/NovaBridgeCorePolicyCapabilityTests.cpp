@@ -193,9 +193,11 @@ bool FNovaBridgeCapabilityRegistryRegistersAndResets::RunTest(const FString& Par
 	TestEqual(TEXT("Registry should contain one capability"), Snapshot.Num(), 1);
 	TestEqual(TEXT("Capability action should match"), Snapshot[0].Action, FString(TEXT("scene.list")));
 
+	const uint64 VersionBeforeReset = Registry.GetVersion();
 	Registry.Reset();
 	Snapshot = Registry.Snapshot();
 	TestEqual(TEXT("Registry reset should clear capabilities"), Snapshot.Num(), 0);
+	TestTrue(TEXT("Registry reset should bump the version"), Registry.GetVersion() > VersionBeforeReset);
 	return true;
 }
 
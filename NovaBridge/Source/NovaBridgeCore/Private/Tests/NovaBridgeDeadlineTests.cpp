@@ -0,0 +1,57 @@
+#include "NovaBridgeDeadline.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HttpServerRequest.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeDeadlineHeader,
+	"NovaBridge.Core.Deadline.Header",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeDeadlineHeader::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::ParseRequestDeadlineMs;
+
+	FHttpServerRequest Request;
+	TestEqual(TEXT("No header means no deadline"), ParseRequestDeadlineMs(Request), 0);
+
+	Request.Headers.Add(TEXT("x-novabridge-deadline"), { TEXT(" 2500 ") });
+	TestEqual(TEXT("Milliseconds are read case-insensitively and trimmed"), ParseRequestDeadlineMs(Request), 2500);
+
+	const TCHAR* const Invalid[] = { TEXT("0"), TEXT("-5"), TEXT("1.5"), TEXT("soon"), TEXT("99999999999") };
+	for (const TCHAR* Value : Invalid)
+	{
+		FHttpServerRequest Bad;
+		Bad.Headers.Add(TEXT("X-NovaBridge-Deadline"), { Value });
+		TestEqual(FString::Printf(TEXT("'%s' is ignored"), Value), ParseRequestDeadlineMs(Bad), 0);
+	}
+
+	FHttpServerRequest OverCap;
+	OverCap.Headers.Add(TEXT("X-NovaBridge-Deadline"), { FString::FromInt(NovaBridgeCore::MaxRequestDeadlineMs + 1) });
+	TestEqual(TEXT("Deadlines over the cap are ignored"), ParseRequestDeadlineMs(OverCap), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeDeadlineToken,
+	"NovaBridge.Core.Deadline.Token",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeDeadlineToken::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	NovaBridgeCore::FCancellationToken Unbounded;
+	TestFalse(TEXT("A token without a deadline stays live"), Unbounded.IsCancelled(1.0e9));
+	Unbounded.Cancel();
+	TestTrue(TEXT("Cancel is sticky"), Unbounded.IsCancelled(0.0));
+
+	NovaBridgeCore::FCancellationToken Timed(100.0);
+	TestFalse(TEXT("Live before the deadline"), Timed.IsCancelled(99.9));
+	TestTrue(TEXT("Cancelled at the deadline"), Timed.IsCancelled(100.0));
+	return true;
+}
+
+#endif
@@ -0,0 +1,91 @@
+#include "NovaBridgeEntityTag.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeEntityTagVariants,
+	"NovaBridge.Core.EntityTag.Variants",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeEntityTagVariants::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::HashRequestVariant;
+	using NovaBridgeCore::MakeRevisionETag;
+
+	FHttpServerRequest Request;
+	Request.QueryParams.Add(TEXT("limit"), TEXT("100"));
+	Request.QueryParams.Add(TEXT("class"), TEXT("StaticMeshActor"));
+	const uint32 Base = HashRequestVariant(Request, TEXT("admin"));
+
+	FHttpServerRequest Reordered;
+	Reordered.QueryParams.Add(TEXT("class"), TEXT("StaticMeshActor"));
+	Reordered.QueryParams.Add(TEXT("limit"), TEXT("100"));
+	TestEqual(TEXT("Query parameter order does not matter"), HashRequestVariant(Reordered, TEXT("admin")), Base);
+	TestNotEqual(TEXT("Roles are separate variants"), HashRequestVariant(Request, TEXT("read_only")), Base);
+
+	Reordered.QueryParams.Add(TEXT("cursor"), TEXT("abc"));
+	TestNotEqual(TEXT("Another page is another variant"), HashRequestVariant(Reordered, TEXT("admin")), Base);
+
+	FHttpServerRequest Compact;
+	Compact.QueryParams = Request.QueryParams;
+	Compact.Headers.Add(TEXT("Accept"), { TEXT("application/json; profile=compact") });
+	TestNotEqual(TEXT("The compact profile is another variant"), HashRequestVariant(Compact, TEXT("admin")), Base);
+
+	const FString Tag = MakeRevisionETag(7, Base);
+	TestTrue(TEXT("Tags are quoted"), Tag.StartsWith(TEXT("\"")) && Tag.EndsWith(TEXT("\"")));
+	TestEqual(TEXT("Tags are stable within a process"), MakeRevisionETag(7, Base), Tag);
+	TestNotEqual(TEXT("A new revision is a new tag"), MakeRevisionETag(8, Base), Tag);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeEntityTagIfNoneMatch,
+	"NovaBridge.Core.EntityTag.IfNoneMatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeEntityTagIfNoneMatch::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::MatchesIfNoneMatch;
+	const FString Tag = NovaBridgeCore::MakeRevisionETag(42, 1234);
+
+	FHttpServerRequest Request;
+	TestFalse(TEXT("No header never matches"), MatchesIfNoneMatch(Request, Tag));
+
+	Request.Headers.Add(TEXT("if-none-match"), { FString::Printf(TEXT("\"stale\", W/%s"), *Tag) });
+	TestTrue(TEXT("Weak forms and lists match"), MatchesIfNoneMatch(Request, Tag));
+	TestFalse(TEXT("Other tags do not match"), MatchesIfNoneMatch(Request, NovaBridgeCore::MakeRevisionETag(43, 1234)));
+
+	FHttpServerRequest Split;
+	Split.Headers.Add(TEXT("If-None-Match"), { TEXT("\"stale\""), Tag });
+	TestTrue(TEXT("Pre-split header values match"), MatchesIfNoneMatch(Split, Tag));
+
+	FHttpServerRequest Wildcard;
+	Wildcard.Headers.Add(TEXT("If-None-Match"), { TEXT("*") });
+	TestTrue(TEXT("The wildcard matches"), MatchesIfNoneMatch(Wildcard, Tag));
+
+	const TUniquePtr<FHttpServerResponse> NotModified = NovaBridgeCore::MakeNotModifiedResponse(Tag);
+	TestEqual(TEXT("Not-modified responses are 304"), static_cast<int32>(NotModified->Code), 304);
+	TestEqual(TEXT("Not-modified responses have no body"), NotModified->Body.Num(), 0);
+
+	TArray<FString> Tagged;
+	const FHttpResultCallback Wrapped = NovaBridgeCore::WrapResultCallbackWithETag(Tag, [&Tagged](TUniquePtr<FHttpServerResponse>&& Response)
+	{
+		const TArray<FString>* Values = Response->Headers.Find(TEXT("ETag"));
+		Tagged.Add(Values && Values->Num() > 0 ? (*Values)[0] : FString());
+	});
+	Wrapped(FHttpServerResponse::Create(TEXT("{}"), TEXT("application/json")));
+	TUniquePtr<FHttpServerResponse> Error = FHttpServerResponse::Create(TEXT("{}"), TEXT("application/json"));
+	Error->Code = EHttpServerResponseCodes::BadRequest;
+	Wrapped(MoveTemp(Error));
+	TestEqual(TEXT("Successful responses are tagged"), Tagged[0], Tag);
+	TestTrue(TEXT("Errors are not tagged"), Tagged[1].IsEmpty());
+	return true;
+}
+
+#endif
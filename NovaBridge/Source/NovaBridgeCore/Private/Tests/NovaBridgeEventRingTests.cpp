@@ -0,0 +1,130 @@
+#include "NovaBridgeEventRing.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+FString PayloadText(const NovaBridgeCore::FEventRecord& Event)
+{
+	if (!Event.Payload.IsValid())
+	{
+		return FString();
+	}
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const UTF8CHAR*>(Event.Payload->Utf8.GetData()), Event.Payload->Utf8.Num());
+	return FString(Converted.Length(), Converted.Get());
+}
+
+uint64 PushTestEvent(NovaBridgeCore::FEventRing& Ring, const FString& Type)
+{
+	return Ring.Push(Type, [](uint64 Seq)
+	{
+		return FString::Printf(TEXT("{\"seq\":%llu}"), Seq);
+	});
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeEventRingReplay,
+	"NovaBridge.Core.EventRing.Replay",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeEventRingReplay::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	NovaBridgeCore::FEventRing Ring(4);
+	TestEqual(TEXT("First sequence number is 1"), PushTestEvent(Ring, TEXT("spawn")), static_cast<uint64>(1));
+	PushTestEvent(Ring, TEXT("delete"));
+	PushTestEvent(Ring, TEXT("audit"));
+
+	TArray<NovaBridgeCore::FEventRecord> Events;
+	TestTrue(TEXT("Replay from a retained cursor has no gap"), Ring.CopySince(1, Events));
+	TestEqual(TEXT("Replay returns only newer events"), Events.Num(), 2);
+	TestEqual(TEXT("Replay starts after the cursor"), Events[0].Seq, static_cast<uint64>(2));
+	TestEqual(TEXT("Payload builder sees the assigned sequence"), PayloadText(Events[0]), FString(TEXT("{\"seq\":2}")));
+	TestEqual(TEXT("Types are kept with payloads"), Events[1].Payload->Type, FString(TEXT("audit")));
+
+	Events.Reset();
+	TestTrue(TEXT("Cursor at the head is caught up"), Ring.CopySince(3, Events));
+	TestEqual(TEXT("Cursor at the head replays nothing"), Events.Num(), 0);
+	TestFalse(TEXT("Cursor from the future reports a gap"), Ring.CopySince(99, Events));
+	TestTrue(TEXT("A cursor of 0 replays a ring that has not wrapped"), Ring.CanReplayFrom(0));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeEventRingOverflow,
+	"NovaBridge.Core.EventRing.Overflow",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeEventRingOverflow::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	NovaBridgeCore::FEventRing Ring(4);
+	for (int32 Index = 0; Index < 10; ++Index)
+	{
+		PushTestEvent(Ring, TEXT("spawn"));
+	}
+
+	NovaBridgeCore::FEventRingStats Stats = Ring.GetStats();
+	TestEqual(TEXT("Head tracks the newest event"), Stats.HeadSeq, static_cast<uint64>(10));
+	TestEqual(TEXT("Tail tracks the oldest retained event"), Stats.TailSeq, static_cast<uint64>(7));
+	TestEqual(TEXT("Overwritten events count as dropped"), Stats.Dropped, static_cast<uint64>(6));
+	TestEqual(TEXT("Count is capped at capacity"), Stats.Count, 4);
+
+	TArray<NovaBridgeCore::FEventRecord> Events;
+	TestFalse(TEXT("Cursor behind the tail reports a gap"), Ring.CopySince(2, Events));
+	TestTrue(TEXT("Cursor just before the tail can still replay"), Ring.CanReplayFrom(6));
+	TestEqual(TEXT("Gap replay still returns everything retained"), Events.Num(), 4);
+	TestEqual(TEXT("Gap replay starts at the tail"), Events[0].Seq, static_cast<uint64>(7));
+
+	TArray<FString> Types;
+	Ring.CopyTypesSince(8, Types);
+	TestEqual(TEXT("Type snapshot honours the cursor"), Types.Num(), 2);
+
+	Ring.Reset();
+	Stats = Ring.GetStats();
+	TestEqual(TEXT("Reset empties the ring"), Stats.Count, 0);
+	TestEqual(TEXT("Reset keeps the head sequence"), Stats.HeadSeq, static_cast<uint64>(10));
+	TestEqual(TEXT("Sequence numbers are not reused after Reset"), PushTestEvent(Ring, TEXT("spawn")), static_cast<uint64>(11));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeEventRingSharedPayload,
+	"NovaBridge.Core.EventRing.SharedPayload",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeEventRingSharedPayload::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	NovaBridgeCore::FEventRing Ring(8);
+	Ring.Push(TEXT("audit"), [](uint64 Seq)
+	{
+		(void)Seq;
+		return FString(TEXT("{\"message\":\"caf\u00e9\"}"));
+	});
+
+	TArray<NovaBridgeCore::FEventRecord> FirstRead;
+	TArray<NovaBridgeCore::FEventRecord> SecondRead;
+	Ring.CopySince(0, FirstRead);
+	Ring.CopySince(0, SecondRead);
+	TestTrue(TEXT("Readers share one payload buffer"), FirstRead[0].Payload == SecondRead[0].Payload);
+	TestEqual(TEXT("Payload is encoded as UTF-8"), FirstRead[0].Payload->Utf8.Num(), 19);
+
+	const NovaBridgeCore::FEventRingStats OneEvent = Ring.GetStats();
+	TestEqual(TEXT("Payload bytes count the UTF-8 buffer"), OneEvent.PayloadBytes, static_cast<uint64>(19));
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		PushTestEvent(Ring, TEXT("spawn"));
+	}
+	Ring.RecordFanoutSends(64);
+
+	const NovaBridgeCore::FEventRingStats FourEvents = Ring.GetStats();
+	TestEqual(TEXT("Every push is counted"), FourEvents.EncodedEvents, static_cast<uint64>(4));
+	TestEqual(TEXT("Fan-out sends are tracked separately"), FourEvents.FanoutSends, static_cast<uint64>(64));
+	return true;
+}
+
+#endif
@@ -0,0 +1,150 @@
+#include "NovaBridgeMeshBuffers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Base64.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#include <limits>
+
+namespace
+{
+NovaBridgeCore::FMeshBuffers MakeGridMesh(int32 Side)
+{
+	NovaBridgeCore::FMeshBuffers Mesh;
+	for (int32 Y = 0; Y < Side; ++Y)
+	{
+		for (int32 X = 0; X < Side; ++X)
+		{
+			Mesh.Positions.Add(FVector3f(X * 10.0f, Y * 10.0f, 0.0f));
+			Mesh.Normals.Add(FVector3f(0.0f, 0.0f, 1.0f));
+			Mesh.UVs.Add(FVector2f(X / float(Side - 1), Y / float(Side - 1)));
+		}
+	}
+	for (int32 Y = 0; Y + 1 < Side; ++Y)
+	{
+		for (int32 X = 0; X + 1 < Side; ++X)
+		{
+			const uint32 I = static_cast<uint32>(Y * Side + X);
+			Mesh.Indices.Append({ I, I + Side, I + 1, I + 1, I + Side, I + Side + 1 });
+		}
+	}
+	return Mesh;
+}
+
+FString MakeLegacyJson(const NovaBridgeCore::FMeshBuffers& Mesh)
+{
+	FString Json = TEXT("{\"name\":\"Grid\",\"vertices\":[");
+	for (int32 Index = 0; Index < Mesh.NumVertices(); ++Index)
+	{
+		const FVector3f& P = Mesh.Positions[Index];
+		const FVector3f& N = Mesh.Normals[Index];
+		const FVector2f& UV = Mesh.UVs[Index];
+		Json += FString::Printf(TEXT("%s{\"x\":%g,\"y\":%g,\"z\":%g,\"u\":%g,\"v\":%g,\"nx\":%g,\"ny\":%g,\"nz\":%g}"),
+			Index > 0 ? TEXT(",") : TEXT(""), P.X, P.Y, P.Z, UV.X, UV.Y, N.X, N.Y, N.Z);
+	}
+	Json += TEXT("],\"triangles\":[");
+	for (int32 Tri = 0; Tri < Mesh.NumTriangles(); ++Tri)
+	{
+		Json += FString::Printf(TEXT("%s{\"i0\":%u,\"i1\":%u,\"i2\":%u}"),
+			Tri > 0 ? TEXT(",") : TEXT(""), Mesh.Indices[Tri * 3], Mesh.Indices[Tri * 3 + 1], Mesh.Indices[Tri * 3 + 2]);
+	}
+	Json += TEXT("]}");
+	return Json;
+}
+
+TSharedPtr<FJsonObject> ParseJsonString(const FString& Json)
+{
+	TSharedPtr<FJsonObject> Object;
+	FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Object);
+	return Object;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeMeshBuffersFormats,
+	"NovaBridge.Core.MeshBuffers.Formats",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeMeshBuffersFormats::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	const NovaBridgeCore::FMeshBuffers Grid = MakeGridMesh(4);
+	FString Error;
+
+	const TArray<uint8> Binary = NovaBridgeCore::EncodeMeshBinary(Grid);
+	NovaBridgeCore::FMeshBuffers FromBinary;
+	TestTrue(TEXT("Binary body parses"), NovaBridgeCore::ParseMeshBinary(Binary.GetData(), Binary.Num(), FromBinary, Error));
+	TestTrue(TEXT("Binary streams round-trip"), FromBinary.Positions == Grid.Positions && FromBinary.Normals == Grid.Normals
+		&& FromBinary.UVs == Grid.UVs && FromBinary.Indices == Grid.Indices);
+	TestFalse(TEXT("Truncated binary bodies are rejected"), NovaBridgeCore::ParseMeshBinary(Binary.GetData(), Binary.Num() - 4, FromBinary, Error));
+
+	TSharedPtr<FJsonObject> Streams = MakeShared<FJsonObject>();
+	Streams->SetStringField(TEXT("positions"), FBase64::Encode(reinterpret_cast<const uint8*>(Grid.Positions.GetData()), static_cast<uint32>(Grid.Positions.Num() * sizeof(FVector3f))));
+	Streams->SetStringField(TEXT("indices"), FBase64::Encode(reinterpret_cast<const uint8*>(Grid.Indices.GetData()), static_cast<uint32>(Grid.Indices.Num() * sizeof(uint32))));
+	NovaBridgeCore::FMeshBuffers FromStreams;
+	TestTrue(TEXT("Base64 streams parse"), NovaBridgeCore::ParseMeshJson(*Streams, FromStreams, Error));
+	TestTrue(TEXT("Base64 streams round-trip"), FromStreams.Positions == Grid.Positions && FromStreams.Indices == Grid.Indices && FromStreams.UVs.Num() == 0);
+
+	TSharedPtr<FJsonObject> Legacy = ParseJsonString(MakeLegacyJson(Grid));
+	NovaBridgeCore::FMeshBuffers FromLegacy;
+	TestTrue(TEXT("Legacy vertex arrays parse"), Legacy.IsValid() && NovaBridgeCore::ParseMeshJson(*Legacy, FromLegacy, Error));
+	TestTrue(TEXT("Legacy arrays produce the same streams"), FromLegacy.Positions == Grid.Positions && FromLegacy.Indices == Grid.Indices);
+	TestTrue(TEXT("A well-formed mesh validates"), NovaBridgeCore::ValidateMeshBuffers(FromLegacy, Error));
+
+	NovaBridgeCore::FMeshBuffers Broken = Grid;
+	Broken.Indices.Last() = static_cast<uint32>(Grid.NumVertices());
+	TestFalse(TEXT("Out-of-range indices are rejected"), NovaBridgeCore::ValidateMeshBuffers(Broken, Error));
+	Broken = Grid;
+	Broken.Indices.Pop();
+	TestFalse(TEXT("Partial triangles are rejected"), NovaBridgeCore::ValidateMeshBuffers(Broken, Error));
+	Broken = Grid;
+	Broken.Positions[1].Y = std::numeric_limits<float>::quiet_NaN();
+	TestFalse(TEXT("Non-finite positions are rejected"), NovaBridgeCore::ValidateMeshBuffers(Broken, Error));
+	Broken = Grid;
+	Broken.UVs.Pop();
+	TestFalse(TEXT("Short UV streams are rejected"), NovaBridgeCore::ValidateMeshBuffers(Broken, Error));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeMeshBuffersIngestBenchmark,
+	"NovaBridge.Core.MeshBuffers.IngestBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeMeshBuffersIngestBenchmark::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	// 256x256 grid: 65536 vertices, 130050 triangles, with normals and UVs.
+	const NovaBridgeCore::FMeshBuffers Grid = MakeGridMesh(256);
+	const FString LegacyJson = MakeLegacyJson(Grid);
+	const TArray<uint8> Binary = NovaBridgeCore::EncodeMeshBinary(Grid);
+	FString Error;
+
+	// Both paths include everything the server does before touching the engine: parse and validate.
+	const double JsonStart = FPlatformTime::Seconds();
+	TSharedPtr<FJsonObject> Body = ParseJsonString(LegacyJson);
+	NovaBridgeCore::FMeshBuffers FromJson;
+	const bool bJsonOk = Body.IsValid() && NovaBridgeCore::ParseMeshJson(*Body, FromJson, Error) && NovaBridgeCore::ValidateMeshBuffers(FromJson, Error);
+	const double JsonSec = FPlatformTime::Seconds() - JsonStart;
+
+	const double BinaryStart = FPlatformTime::Seconds();
+	NovaBridgeCore::FMeshBuffers FromBinary;
+	const bool bBinaryOk = NovaBridgeCore::ParseMeshBinary(Binary.GetData(), Binary.Num(), FromBinary, Error) && NovaBridgeCore::ValidateMeshBuffers(FromBinary, Error);
+	const double BinarySec = FPlatformTime::Seconds() - BinaryStart;
+
+	TestTrue(TEXT("JSON ingest succeeds"), bJsonOk);
+	TestTrue(TEXT("Binary ingest succeeds"), bBinaryOk);
+	AddInfo(FString::Printf(TEXT("JSON: %d bytes in %.2f ms (%.1f Mtri/s)"),
+		LegacyJson.Len(), JsonSec * 1000.0, Grid.NumTriangles() / FMath::Max(JsonSec, 1e-9) / 1e6));
+	AddInfo(FString::Printf(TEXT("Binary: %d bytes in %.2f ms (%.1f Mtri/s)"),
+		Binary.Num(), BinarySec * 1000.0, Grid.NumTriangles() / FMath::Max(BinarySec, 1e-9) / 1e6));
+	TestTrue(TEXT("Binary bodies are smaller than JSON"), Binary.Num() < LegacyJson.Len());
+	TestTrue(TEXT("Binary ingest is faster than JSON"), BinarySec < JsonSec);
+	return true;
+}
+
+#endif
@@ -0,0 +1,87 @@
+#include "NovaBridgeMetrics.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeMetricsHistogramBucketBounds,
+	"NovaBridge.Core.Metrics.HistogramBucketBounds",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeMetricsHistogramBucketBounds::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::FLatencyHistogram;
+
+	TestEqual(TEXT("Small values map to exact buckets"), FLatencyHistogram::BucketIndexForValue(5), 5);
+	TestEqual(TEXT("Upper bound of an exact bucket is the value"), FLatencyHistogram::BucketUpperBound(5), static_cast<uint64>(5));
+
+	const uint64 Samples[] = { 8, 17, 1000, 123456, 987654321 };
+	for (const uint64 Sample : Samples)
+	{
+		const uint64 UpperBound = FLatencyHistogram::BucketUpperBound(FLatencyHistogram::BucketIndexForValue(Sample));
+		TestTrue(FString::Printf(TEXT("Upper bound covers %llu"), Sample), UpperBound >= Sample);
+		TestTrue(FString::Printf(TEXT("Upper bound stays within 12.5%% of %llu"), Sample), UpperBound <= Sample + Sample / 8);
+	}
+
+	const int32 LastIndex = FLatencyHistogram::BucketIndexForValue(MAX_uint64);
+	TestEqual(TEXT("Oversized values clamp to the last bucket"), LastIndex, FLatencyHistogram::BucketCount - 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeMetricsHistogramQuantiles,
+	"NovaBridge.Core.Metrics.HistogramQuantiles",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeMetricsHistogramQuantiles::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	NovaBridgeCore::FLatencyHistogram Histogram;
+	for (uint64 Value = 1; Value <= 1000; ++Value)
+	{
+		Histogram.Record(Value);
+	}
+
+	TestEqual(TEXT("Count tracks every sample"), Histogram.GetCount(), static_cast<uint64>(1000));
+	TestEqual(TEXT("Max tracks the largest sample"), Histogram.GetMax(), static_cast<uint64>(1000));
+
+	const uint64 P50 = Histogram.ValueAtQuantile(0.5);
+	const uint64 P99 = Histogram.ValueAtQuantile(0.99);
+	TestTrue(TEXT("p50 lands near 500"), P50 >= 500 && P50 <= 563);
+	TestTrue(TEXT("p99 lands near 990"), P99 >= 990 && P99 <= 1000);
+
+	Histogram.Reset();
+	TestEqual(TEXT("Reset clears samples"), Histogram.ValueAtQuantile(0.99), static_cast<uint64>(0));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeMetricsRegistryResetKeepsRoutes,
+	"NovaBridge.Core.Metrics.RegistryResetKeepsRoutes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeMetricsRegistryResetKeepsRoutes::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	NovaBridgeCore::FRouteMetricsRegistry Registry;
+	NovaBridgeCore::FRouteMetrics* Route = Registry.RegisterRoute(TEXT("/nova/health"));
+	Route->HandlerUs.Record(250);
+	Route->RecordStatus(503);
+	Route->Cancelled.fetch_add(1);
+
+	// Request timings keep this pointer across the reset, so it must stay the live record.
+	Registry.Reset();
+	TestTrue(TEXT("Reset keeps the registered record"), Registry.RegisterRoute(TEXT("/nova/health")) == Route);
+	TestEqual(TEXT("Reset zeroes histograms"), Route->HandlerUs.GetCount(), static_cast<uint64>(0));
+	TestEqual(TEXT("Reset zeroes status counters"), Route->Responses5xx.load(), static_cast<uint64>(0));
+	TestEqual(TEXT("Reset zeroes drop counters"), Route->Cancelled.load(), static_cast<uint64>(0));
+
+	Route->RecordStatus(200);
+	TestTrue(TEXT("Records made after the reset are exported"), Registry.BuildPrometheusText(TEXT("novabridge")).Contains(TEXT("/nova/health")));
+	TestEqual(TEXT("The record keeps counting after the reset"), Route->Responses2xx.load(), static_cast<uint64>(1));
+	return true;
+}
+
+#endif
@@ -0,0 +1,152 @@
+#include "NovaBridgeModelImport.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+TArray<uint8> ToBytes(const FString& Text)
+{
+	const FTCHARToUTF8 Utf8(*Text);
+	return TArray<uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+}
+
+FString MakeObjGrid(int32 Side)
+{
+	FString Obj = TEXT("# grid\r\no grid\r\n");
+	for (int32 Y = 0; Y < Side; ++Y)
+	{
+		for (int32 X = 0; X < Side; ++X)
+		{
+			Obj += FString::Printf(TEXT("v %d.5 %d.25 -1e-1\r\nvt 0.%d 0.%d\r\n"), X, Y, X % 10, Y % 10);
+		}
+	}
+	Obj += TEXT("vn 0 0 1\r\n");
+	for (int32 Y = 0; Y + 1 < Side; ++Y)
+	{
+		for (int32 X = 0; X + 1 < Side; ++X)
+		{
+			const int32 I = Y * Side + X + 1;
+			Obj += FString::Printf(TEXT("f %d/%d/1 %d/%d/1 %d/%d/1 %d/%d/1\r\n"), I, I, I + 1, I + 1, I + Side + 1, I + Side + 1, I + Side, I + Side);
+		}
+	}
+	return Obj;
+}
+
+void AppendUInt32(TArray<uint8>& Bytes, uint32 Value)
+{
+	Bytes.Append(reinterpret_cast<const uint8*>(&Value), sizeof(Value));
+}
+
+template <typename ElementType>
+void AppendValues(TArray<uint8>& Bytes, std::initializer_list<ElementType> Values)
+{
+	for (const ElementType& Value : Values)
+	{
+		Bytes.Append(reinterpret_cast<const uint8*>(&Value), sizeof(Value));
+	}
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeModelImportObj,
+	"NovaBridge.Core.ModelImport.Obj",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeModelImportObj::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	const TArray<uint8> Quad = ToBytes(TEXT("v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nvt 0 0\nvt 1 1\nvn 0 1 0\n# relative refs\nf -4/1/1 -3/2/-1 -2 -1//1\n"));
+	NovaBridgeCore::FMeshBuffers Mesh;
+	NovaBridgeCore::FModelImportStats Stats;
+	FString Error;
+	TestTrue(TEXT("OBJ with relative indices parses"), NovaBridgeCore::ParseObjMesh(Quad.GetData(), Quad.Num(), 100.0f, Mesh, Stats, Error));
+	TestEqual(TEXT("Quads fan into two triangles"), Mesh.NumTriangles(), 2);
+	TestEqual(TEXT("Every triangle corner gets a vertex"), Mesh.NumVertices(), 6);
+	TestEqual(TEXT("Positions are scaled and mirrored on Y"), Mesh.Positions[2], FVector3f(100.0f, -100.0f, 0.0f));
+	TestEqual(TEXT("UVs are flipped on V"), Mesh.UVs[1], FVector2f(1.0f, 0.0f));
+	TestEqual(TEXT("Normals are mirrored on Y"), Mesh.Normals[0], FVector3f(0.0f, -1.0f, 0.0f));
+	TestEqual(TEXT("Corners without a normal default to +Z"), Mesh.Normals[2], FVector3f(0.0f, 0.0f, 1.0f));
+	TestTrue(TEXT("Parsed OBJ validates"), NovaBridgeCore::ValidateMeshBuffers(Mesh, Error));
+
+	const TArray<uint8> Empty = ToBytes(TEXT("# nothing here\n"));
+	TestFalse(TEXT("OBJ without faces is rejected"), NovaBridgeCore::ParseObjMesh(Empty.GetData(), Empty.Num(), 1.0f, Mesh, Stats, Error));
+
+	// Tiny chunks split lines across many workers; the result must match a single-chunk parse exactly.
+	const TArray<uint8> Grid = ToBytes(MakeObjGrid(64));
+	NovaBridgeCore::FMeshBuffers Serial;
+	NovaBridgeCore::FModelImportStats SerialStats;
+	const double SerialStart = FPlatformTime::Seconds();
+	TestTrue(TEXT("Grid parses as one chunk"), NovaBridgeCore::ParseObjMesh(Grid.GetData(), Grid.Num(), 1.0f, Serial, SerialStats, Error, MAX_int64));
+	const double SerialSec = FPlatformTime::Seconds() - SerialStart;
+
+	NovaBridgeCore::FMeshBuffers Chunked;
+	NovaBridgeCore::FModelImportStats ChunkedStats;
+	const double ChunkedStart = FPlatformTime::Seconds();
+	TestTrue(TEXT("Grid parses in chunks"), NovaBridgeCore::ParseObjMesh(Grid.GetData(), Grid.Num(), 1.0f, Chunked, ChunkedStats, Error, 4096));
+	const double ChunkedSec = FPlatformTime::Seconds() - ChunkedStart;
+
+	TestEqual(TEXT("Single-chunk parse uses one chunk"), SerialStats.ParseChunks, 1);
+	TestTrue(TEXT("Small chunk size splits the file"), ChunkedStats.ParseChunks > 1);
+	TestEqual(TEXT("Chunked parse counts every face"), ChunkedStats.SourceFaces, 63 * 63);
+	TestTrue(TEXT("Chunked parse matches the single-chunk parse"), Chunked.Positions == Serial.Positions && Chunked.UVs == Serial.UVs
+		&& Chunked.Normals == Serial.Normals && Chunked.Indices == Serial.Indices);
+	TestEqual(TEXT("Exponent floats parse"), Serial.Positions[0].Z, -0.1f);
+	AddInfo(FString::Printf(TEXT("OBJ %d bytes: 1 chunk %.2f ms, %d chunks %.2f ms"),
+		Grid.Num(), SerialSec * 1000.0, ChunkedStats.ParseChunks, ChunkedSec * 1000.0));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeModelImportGlb,
+	"NovaBridge.Core.ModelImport.Glb",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeModelImportGlb::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	// One triangle: three float3 positions (36 bytes) then three uint16 indices padded to 8 bytes.
+	TArray<uint8> Bin;
+	AppendValues<float>(Bin, { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f });
+	AppendValues<uint16>(Bin, { 0, 1, 2, 0 });
+
+	FString Json = TEXT("{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"byteLength\":44}],")
+		TEXT("\"bufferViews\":[{\"buffer\":0,\"byteOffset\":0,\"byteLength\":36},{\"buffer\":0,\"byteOffset\":36,\"byteLength\":6}],")
+		TEXT("\"accessors\":[{\"bufferView\":0,\"componentType\":5126,\"count\":3,\"type\":\"VEC3\"},")
+		TEXT("{\"bufferView\":1,\"componentType\":5123,\"count\":3,\"type\":\"SCALAR\"}],")
+		TEXT("\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":0},\"indices\":1}]}]}");
+	while (Json.Len() % 4 != 0)
+	{
+		Json += TEXT(" ");
+	}
+	const TArray<uint8> JsonBytes = ToBytes(Json);
+
+	TArray<uint8> Glb;
+	AppendUInt32(Glb, 0x46546C67);
+	AppendUInt32(Glb, 2);
+	AppendUInt32(Glb, static_cast<uint32>(12 + 8 + JsonBytes.Num() + 8 + Bin.Num()));
+	AppendUInt32(Glb, static_cast<uint32>(JsonBytes.Num()));
+	AppendUInt32(Glb, 0x4E4F534A);
+	Glb.Append(JsonBytes);
+	AppendUInt32(Glb, static_cast<uint32>(Bin.Num()));
+	AppendUInt32(Glb, 0x004E4942);
+	Glb.Append(Bin);
+
+	NovaBridgeCore::FMeshBuffers Mesh;
+	NovaBridgeCore::FModelImportStats Stats;
+	FString Error;
+	TestTrue(TEXT("GLB parses"), NovaBridgeCore::ParseGlbMesh(Glb.GetData(), Glb.Num(), 100.0f, Mesh, Stats, Error));
+	TestEqual(TEXT("GLB yields one triangle"), Mesh.NumTriangles(), 1);
+	TestEqual(TEXT("Y-up positions become Z-up and are scaled"), Mesh.Positions[2], FVector3f(0.0f, 0.0f, 100.0f));
+	TestTrue(TEXT("Winding is reversed for the handedness swap"), Mesh.Indices == TArray<uint32>({ 0, 2, 1 }));
+	TestTrue(TEXT("Parsed GLB validates"), NovaBridgeCore::ValidateMeshBuffers(Mesh, Error));
+
+	TArray<uint8> Truncated = Glb;
+	Truncated.SetNum(Glb.Num() - 8);
+	TestFalse(TEXT("Truncated GLB is rejected"), NovaBridgeCore::ParseGlbMesh(Truncated.GetData(), Truncated.Num(), 100.0f, Mesh, Stats, Error));
+	return true;
+}
+
+#endif
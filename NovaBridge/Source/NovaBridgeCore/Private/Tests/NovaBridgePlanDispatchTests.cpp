@@ -0,0 +1,73 @@
+#include "NovaBridgePlanDispatch.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+#include <limits>
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgePlanSliceRunnerBudget,
+	"NovaBridge.Core.PlanDispatch.SliceRunnerBudget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgePlanSliceRunnerBudget::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+
+	// Every step advances a fake clock by 3 ms, so an 8 ms budget fits three steps per slice.
+	double FakeNowSec = 0.0;
+	auto Clock = [&FakeNowSec]() { return FakeNowSec; };
+	TArray<int32> Ran;
+	auto RunStep = [&FakeNowSec, &Ran](int32 StepIndex)
+	{
+		Ran.Add(StepIndex);
+		FakeNowSec += 0.003;
+	};
+
+	NovaBridgeCore::FPlanSliceRunner Runner(10, 8.0);
+	Runner.RunSlice(RunStep, Clock);
+	TestEqual(TEXT("A slice stops once the budget is spent"), Runner.GetNextStep(), 3);
+	TestFalse(TEXT("Plan is not finished after the first slice"), Runner.IsFinished());
+	while (!Runner.IsFinished())
+	{
+		Runner.RunSlice(RunStep, Clock);
+	}
+	TestEqual(TEXT("Ten steps at three per slice take four slices"), Runner.GetSliceCount(), 4);
+	TestTrue(TEXT("Steps run once each, in order"), Ran == TArray<int32>({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+	TestTrue(TEXT("Longest slice overshoots the budget by at most one step"), Runner.GetLongestSliceMs() <= 8.0 + 3.0 + 0.001);
+
+	// A step that alone exceeds the budget still makes progress.
+	NovaBridgeCore::FPlanSliceRunner Slow(2, 1.0);
+	Slow.RunSlice(RunStep, Clock);
+	TestEqual(TEXT("Every slice runs at least one step"), Slow.GetNextStep(), 1);
+
+	NovaBridgeCore::FPlanSliceRunner Unbounded(5, 0.0);
+	Unbounded.RunSlice(RunStep, Clock);
+	TestTrue(TEXT("A zero budget runs the whole plan in one slice"), Unbounded.IsFinished());
+
+	// Cancelling from inside a step stops the slice after that step.
+	NovaBridgeCore::FPlanSliceRunner Cancelled(6, 0.0);
+	Cancelled.RunSlice([&Cancelled](int32 StepIndex)
+	{
+		if (StepIndex == 1)
+		{
+			Cancelled.Cancel();
+		}
+	}, Clock);
+	TestEqual(TEXT("Steps after a cancel do not run"), Cancelled.GetNextStep(), 2);
+	TestTrue(TEXT("A cancelled plan is finished"), Cancelled.IsFinished() && Cancelled.IsCancelled());
+	Cancelled.RunSlice(RunStep, Clock);
+	TestEqual(TEXT("Later slices of a cancelled plan do nothing"), Cancelled.GetSliceCount(), 1);
+
+	// Budgets from a request body can tune slicing but never switch it off.
+	using NovaBridgeCore::ClampRequestedPlanFrameBudgetMs;
+	TestEqual(TEXT("A requested budget inside the range is kept"), ClampRequestedPlanFrameBudgetMs(4.0, 33.0), 4.0);
+	TestEqual(TEXT("A requested zero budget is raised to the minimum"), ClampRequestedPlanFrameBudgetMs(0.0, 33.0), 1.0);
+	TestEqual(TEXT("A negative budget is raised to the minimum"), ClampRequestedPlanFrameBudgetMs(-5.0, 33.0), 1.0);
+	TestEqual(TEXT("A huge budget is capped"), ClampRequestedPlanFrameBudgetMs(1.0e9, 33.0), 33.0);
+	TestEqual(TEXT("A non-finite budget is capped"), ClampRequestedPlanFrameBudgetMs(std::numeric_limits<double>::infinity(), 33.0), 33.0);
+	return true;
+}
+
+#endif
@@ -80,6 +80,26 @@ bool FNovaBridgePlanSchemaRejectsUnknownTopLevelField::RunTest(const FString& Pa
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgePlanSchemaFrameBudget,
+	"NovaBridge.Core.PlanSchema.FrameBudget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgePlanSchemaFrameBudget::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	TSharedPtr<FJsonObject> Plan = MakePlan(TEXT("spawn"));
+	Plan->SetNumberField(TEXT("frame_budget_ms"), 4.0);
+
+	NovaBridgeCore::FPlanSchemaError Error;
+	TestTrue(TEXT("Editor plans accept a frame budget"), NovaBridgeCore::ValidateExecutePlanSchema(Plan, NovaBridgeCore::ENovaBridgePlanMode::Editor, 16, Error));
+	TestFalse(TEXT("Runtime plans do not accept a frame budget"), NovaBridgeCore::ValidateExecutePlanSchema(Plan, NovaBridgeCore::ENovaBridgePlanMode::Runtime, 16, Error));
+
+	Plan->SetNumberField(TEXT("frame_budget_ms"), -1.0);
+	TestFalse(TEXT("Negative frame budgets are rejected"), NovaBridgeCore::ValidateExecutePlanSchema(Plan, NovaBridgeCore::ENovaBridgePlanMode::Editor, 16, Error));
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 	FNovaBridgePlanSchemaAcceptsRuntimeScreenshotAction,
 	"NovaBridge.Core.PlanSchema.AcceptsRuntimeScreenshotAction",
@@ -131,4 +151,36 @@ bool FNovaBridgePlanSchemaRejectsInvalidSpawnTransform::RunTest(const FString& P
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgePlanSchemaNearTarget,
+	"NovaBridge.Core.PlanSchema.NearTarget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgePlanSchemaNearTarget::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	TArray<TSharedPtr<FJsonValue>> Point;
+	Point.Add(MakeShared<FJsonValueNumber>(100.0));
+	Point.Add(MakeShared<FJsonValueNumber>(0.0));
+	Point.Add(MakeShared<FJsonValueNumber>(50.0));
+
+	TSharedPtr<FJsonObject> DeleteParams = MakeShared<FJsonObject>();
+	DeleteParams->SetArrayField(TEXT("near"), Point);
+	DeleteParams->SetNumberField(TEXT("radius"), 250.0);
+	DeleteParams->SetStringField(TEXT("class"), TEXT("PointLight"));
+
+	NovaBridgeCore::FPlanSchemaError Error;
+	TestTrue(TEXT("delete accepts a near target"), NovaBridgeCore::ValidateExecutePlanSchema(MakePlan(TEXT("delete"), DeleteParams), NovaBridgeCore::ENovaBridgePlanMode::Editor, 16, Error));
+
+	DeleteParams->SetNumberField(TEXT("radius"), 0.0);
+	TestFalse(TEXT("Non-positive radius is rejected"), NovaBridgeCore::ValidateExecutePlanSchema(MakePlan(TEXT("delete"), DeleteParams), NovaBridgeCore::ENovaBridgePlanMode::Editor, 16, Error));
+	TestTrue(TEXT("Error names the radius field"), Error.Message.Contains(TEXT("delete.params.radius")));
+
+	TSharedPtr<FJsonObject> SetParams = MakeShared<FJsonObject>();
+	SetParams->SetStringField(TEXT("near"), TEXT("over there"));
+	SetParams->SetObjectField(TEXT("props"), MakeShared<FJsonObject>());
+	TestFalse(TEXT("set rejects a malformed near point"), NovaBridgeCore::ValidateExecutePlanSchema(MakePlan(TEXT("set"), SetParams), NovaBridgeCore::ENovaBridgePlanMode::Editor, 16, Error));
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
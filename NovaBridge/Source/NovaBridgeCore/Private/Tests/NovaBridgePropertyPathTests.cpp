@@ -0,0 +1,175 @@
+#include "NovaBridgePropertyPath.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+using NovaBridgeCore::FComponentIdentity;
+
+struct FTestClass
+{
+	int32 Id = 0;
+};
+
+struct FTestResolvedPath
+{
+	int32 Component = INDEX_NONE;
+	int32 Property = INDEX_NONE;
+};
+
+using FTestPathCache = NovaBridgeCore::TPropertyPathCache<FTestClass, FTestResolvedPath>;
+
+// Roughly the component list of a placed point light with editor-only helpers.
+TArray<FComponentIdentity> MakeLightComponents()
+{
+	return {
+		{ TEXT("DefaultSceneRoot"), TEXT("SceneComponent") },
+		{ TEXT("ArrowComponent0"), TEXT("ArrowComponent") },
+		{ TEXT("Sprite"), TEXT("BillboardComponent") },
+		{ TEXT("DrawFrustum"), TEXT("DrawFrustumComponent") },
+		{ TEXT("LightComponent0"), TEXT("PointLightComponent") },
+		{ TEXT("TextRender"), TEXT("TextRenderComponent") },
+	};
+}
+
+TArray<FString> MakePropertyNames(int32 Count)
+{
+	TArray<FString> Names;
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Names.Add(FString::Printf(TEXT("bSomeReflectedFlag%d"), Index));
+	}
+	Names.Add(TEXT("Intensity"));
+	return Names;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgePropertyPathSelector,
+	"NovaBridge.Core.PropertyPath.Selector",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgePropertyPathSelector::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::FindComponentForSelector;
+	const TArray<FComponentIdentity> Components = MakeLightComponents();
+
+	TestEqual(TEXT("Exact component names match"), FindComponentForSelector(TEXT("Sprite"), Components), 2);
+	TestEqual(TEXT("Exact class names match"), FindComponentForSelector(TEXT("PointLightComponent"), Components), 4);
+	TestEqual(TEXT("Name substrings match"), FindComponentForSelector(TEXT("LightComponent"), Components), 4);
+	TestEqual(TEXT("Normalized class stems match"), FindComponentForSelector(TEXT("point_light"), Components), 4);
+	TestEqual(TEXT("Numeric suffixes are ignored"), FindComponentForSelector(TEXT("TextRender7"), Components), 5);
+	TestEqual(TEXT("Unknown selectors find nothing"), FindComponentForSelector(TEXT("Skeletal"), Components), INDEX_NONE);
+	TestEqual(TEXT("Punctuation-only selectors find nothing"), FindComponentForSelector(TEXT("__"), Components), INDEX_NONE);
+	TestEqual(TEXT("Keys drop case, punctuation and trailing digits"), NovaBridgeCore::NormalizeComponentKey(TEXT("Light_Component01")), FString(TEXT("lightcomponent")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgePropertyPathCache,
+	"NovaBridge.Core.PropertyPath.Cache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgePropertyPathCache::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	const FTestClass PointLight { 1 };
+	const FTestClass SpotLight { 2 };
+	FTestPathCache Cache(4);
+
+	TestTrue(TEXT("A cold cache misses"), Cache.Find(&PointLight, TEXT("PointLight.Intensity")) == nullptr);
+	Cache.Add(&PointLight, TEXT("PointLight.Intensity"), FTestResolvedPath { 4, 7 });
+	const FTestResolvedPath* Hit = Cache.Find(&PointLight, TEXT("pointlight.intensity"));
+	TestTrue(TEXT("Paths compare case-insensitively"), Hit && Hit->Component == 4 && Hit->Property == 7);
+	TestTrue(TEXT("Entries are per class"), Cache.Find(&SpotLight, TEXT("PointLight.Intensity")) == nullptr);
+	TestEqual(TEXT("Hits are counted"), Cache.GetHits(), static_cast<uint64>(1));
+	TestEqual(TEXT("Misses are counted"), Cache.GetMisses(), static_cast<uint64>(2));
+
+	Cache.Reset();
+	TestEqual(TEXT("Reset drops every entry"), Cache.Num(), 0);
+	TestEqual(TEXT("Reset is counted"), Cache.GetInvalidations(), static_cast<uint64>(1));
+	Cache.Reset();
+	TestEqual(TEXT("Resetting an empty cache is not counted"), Cache.GetInvalidations(), static_cast<uint64>(1));
+
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		Cache.Add(&PointLight, FString::Printf(TEXT("Path%d"), Index), FTestResolvedPath { Index, Index });
+	}
+	Cache.Add(&PointLight, TEXT("Path0"), FTestResolvedPath { 9, 9 });
+	TestEqual(TEXT("Overwriting at capacity keeps the cache"), Cache.Num(), 4);
+	Cache.Add(&PointLight, TEXT("Path4"), FTestResolvedPath { 4, 4 });
+	TestEqual(TEXT("A new path past capacity starts over"), Cache.Num(), 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgePropertyPathSyntheticResolve,
+	"NovaBridge.Core.PropertyPath.SyntheticResolve",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgePropertyPathSyntheticResolve::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	// Exercises TPropertyPathCache in front of a synthetic resolver: the selector match plus a
+	// case-insensitive scan of ~150 names. It does not touch reflection, so the timings describe this
+	// stand-in only and say nothing about SetActorPropertyValue or ApplyCachedPropertyPath.
+	const TArray<FComponentIdentity> Components = MakeLightComponents();
+	const TArray<FString> Properties = MakePropertyNames(150);
+	const FString Path = TEXT("point_light.intensity");
+	const FTestClass LightClass { 1 };
+	constexpr int32 Sets = 500;
+
+	auto Resolve = [&Components, &Properties, &Path]()
+	{
+		FString Selector;
+		FString PropName;
+		Path.Split(TEXT("."), &Selector, &PropName);
+		TArray<FComponentIdentity, TInlineAllocator<16>> Identities(Components);
+		FTestResolvedPath Resolved;
+		Resolved.Component = NovaBridgeCore::FindComponentForSelector(Selector, Identities);
+		Resolved.Property = Properties.IndexOfByPredicate([&PropName](const FString& Name) { return Name.Equals(PropName, ESearchCase::IgnoreCase); });
+		return Resolved;
+	};
+
+	const double UncachedStart = FPlatformTime::Seconds();
+	int32 UncachedFound = 0;
+	for (int32 Set = 0; Set < Sets; ++Set)
+	{
+		UncachedFound += Resolve().Property != INDEX_NONE ? 1 : 0;
+	}
+	const double UncachedSec = FPlatformTime::Seconds() - UncachedStart;
+
+	FTestPathCache Cache;
+	const double CachedStart = FPlatformTime::Seconds();
+	int32 CachedFound = 0;
+	for (int32 Set = 0; Set < Sets; ++Set)
+	{
+		const FTestResolvedPath* Entry = Cache.Find(&LightClass, Path);
+		FTestResolvedPath Resolved;
+		if (Entry)
+		{
+			Resolved = *Entry;
+		}
+		else
+		{
+			Resolved = Resolve();
+			Cache.Add(&LightClass, Path, Resolved);
+		}
+		CachedFound += Resolved.Property != INDEX_NONE ? 1 : 0;
+	}
+	const double CachedSec = FPlatformTime::Seconds() - CachedStart;
+
+	TestEqual(TEXT("Uncached resolution finds the property every time"), UncachedFound, Sets);
+	TestEqual(TEXT("Cached resolution finds the property every time"), CachedFound, Sets);
+	TestEqual(TEXT("Only the first set misses"), Cache.GetMisses(), static_cast<uint64>(1));
+	AddInfo(FString::Printf(TEXT("Synthetic resolver: %.0f ns/set uncached, %.0f ns/set cached over %d sets"),
+		UncachedSec * 1e9 / Sets, CachedSec * 1e9 / Sets, Sets));
+	TestTrue(TEXT("Cached resolution is faster"), CachedSec < UncachedSec);
+	return true;
+}
+
+#endif
@@ -0,0 +1,141 @@
+#include "NovaBridgeRateLimiter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Async/ParallelFor.h"
+#include "Misc/AutomationTest.h"
+
+#include <atomic>
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeRateLimiterBurstAndRefill,
+	"NovaBridge.Core.RateLimiter.BurstAndRefill",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeRateLimiterBurstAndRefill::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	NovaBridgeCore::FTokenBucketRateLimiter Limiter;
+	const int32 RouteId = Limiter.RegisterRoute(TEXT("/nova/scene/spawn"));
+	TestEqual(TEXT("Registering a route twice returns the same id"), Limiter.RegisterRoute(TEXT("/nova/scene/spawn")), RouteId);
+	TestNotEqual(TEXT("Distinct routes get distinct ids"), Limiter.RegisterRoute(TEXT("/nova/scene/delete")), RouteId);
+
+	const int32 Admin = NovaBridgeCore::FTokenBucketRateLimiter::RoleSlotForName(TEXT("admin"));
+	const int32 Automation = NovaBridgeCore::FTokenBucketRateLimiter::RoleSlotForName(TEXT("automation"));
+	const double StartSec = 1000.0;
+
+	// 60/minute bursts to 15, then refills the other 46 of the minute, about one token every 1.3 seconds.
+	TestEqual(TEXT("Burst is a quarter of the limit"), NovaBridgeCore::FTokenBucketRateLimiter::BurstForLimit(60), 15);
+	TestEqual(TEXT("Refill makes up the rest of the minute"), NovaBridgeCore::FTokenBucketRateLimiter::RefillPerMinuteForLimit(60), 46);
+	NovaBridgeCore::FRateLimitDecision Decision = Limiter.Consume(RouteId, Admin, 60, StartSec);
+	TestTrue(TEXT("A fresh bucket starts full"), Decision.bAllowed);
+	TestEqual(TEXT("Remaining counts down from the burst"), Decision.Remaining, 14);
+	TestEqual(TEXT("Reset reports time until the bucket is full"), Decision.ResetSeconds, 2);
+	for (int32 Index = 0; Index < 14; ++Index)
+	{
+		Limiter.Consume(RouteId, Admin, 60, StartSec);
+	}
+	Decision = Limiter.Consume(RouteId, Admin, 60, StartSec);
+	TestFalse(TEXT("Requests past the burst are denied"), Decision.bAllowed);
+	TestEqual(TEXT("Denied requests are told when to retry"), Decision.RetryAfterSeconds, 2);
+	TestTrue(TEXT("Role slots keep separate buckets"), Limiter.Consume(RouteId, Automation, 60, StartSec).bAllowed);
+	TestFalse(TEXT("No token is back after one second"), Limiter.Consume(RouteId, Admin, 60, StartSec + 1.0).bAllowed);
+	TestTrue(TEXT("A token is back after two seconds"), Limiter.Consume(RouteId, Admin, 60, StartSec + 2.0).bAllowed);
+	TestFalse(TEXT("Zero limits always deny"), Limiter.Consume(RouteId, Admin, 0, StartSec).bAllowed);
+
+	Limiter.Reset();
+	TestTrue(TEXT("Reset refills every bucket"), Limiter.Consume(RouteId, Admin, 60, StartSec + 1.0).bAllowed);
+
+	// Polling every 10 ms must not lose refill: 20/minute bursts to 5 and regains 16 a minute, 8 in 30.5 s.
+	Limiter.Reset();
+	for (int32 Index = 0; Index < 5; ++Index)
+	{
+		Limiter.Consume(RouteId, Admin, 20, StartSec);
+	}
+	int32 Allowed = 0;
+	for (int32 Tick = 1; Tick <= 3050; ++Tick)
+	{
+		Allowed += Limiter.Consume(RouteId, Admin, 20, StartSec + Tick * 0.01).bAllowed ? 1 : 0;
+	}
+	TestEqual(TEXT("Frequent polling still refills at the configured rate"), Allowed, 8);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeRateLimiterNoWindowEdgeBurst,
+	"NovaBridge.Core.RateLimiter.NoWindowEdgeBurst",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeRateLimiterNoWindowEdgeBurst::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	NovaBridgeCore::FTokenBucketRateLimiter Limiter;
+	const int32 RouteId = Limiter.RegisterRoute(TEXT("/nova/executePlan"));
+	const int32 Limits[] = { 1, 7, 120, 4000 };
+	const double Intervals[] = { 0.05, 0.001 };
+
+	// Hammer for three minutes and check every 60 second window; a fixed window lets up to twice the limit
+	// through around each boundary, and a bucket whose burst sits on top of a full minute of refill lets
+	// limit plus burst through.
+	for (const int32 Limit : Limits)
+	{
+		for (const double Interval : Intervals)
+		{
+			Limiter.Reset();
+			TArray<double> AllowedAt;
+			const int32 Calls = static_cast<int32>(180.0 / Interval);
+			for (int32 Tick = 0; Tick < Calls; ++Tick)
+			{
+				const double NowSec = 500.0 + Tick * Interval;
+				if (Limiter.Consume(RouteId, 0, Limit, NowSec).bAllowed)
+				{
+					AllowedAt.Add(NowSec);
+				}
+			}
+
+			int32 WorstWindow = 0;
+			int32 WindowStart = 0;
+			for (int32 Index = 0; Index < AllowedAt.Num(); ++Index)
+			{
+				while (AllowedAt[Index] - AllowedAt[WindowStart] >= 60.0)
+				{
+					++WindowStart;
+				}
+				WorstWindow = FMath::Max(WorstWindow, Index - WindowStart + 1);
+			}
+			AddInfo(FString::Printf(TEXT("Worst 60s window admitted %d of %d/minute at one call per %.3f s"), WorstWindow, Limit, Interval));
+			TestTrue(FString::Printf(TEXT("No 60 second window exceeds %d/minute"), Limit), WorstWindow <= Limit);
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeRateLimiterConcurrentConsume,
+	"NovaBridge.Core.RateLimiter.ConcurrentConsume",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeRateLimiterConcurrentConsume::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	NovaBridgeCore::FTokenBucketRateLimiter Limiter;
+	const int32 RouteId = Limiter.RegisterRoute(TEXT("/nova/health"));
+	std::atomic<int32> Allowed { 0 };
+
+	// 4000/minute bursts to 1000; with the clock frozen exactly that many of 8000 racing calls get through.
+	ParallelFor(8, [&Limiter, RouteId, &Allowed](int32 Worker)
+	{
+		(void)Worker;
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			if (Limiter.Consume(RouteId, 0, 4000, 42.0).bAllowed)
+			{
+				Allowed.fetch_add(1);
+			}
+		}
+	});
+	TestEqual(TEXT("Concurrent consumers never overspend the bucket"), Allowed.load(), 1000);
+	return true;
+}
+
+#endif
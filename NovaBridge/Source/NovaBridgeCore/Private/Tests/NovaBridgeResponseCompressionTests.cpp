@@ -0,0 +1,113 @@
+#include "NovaBridgeResponseCompression.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/PlatformTime.h"
+#include "HttpServerResponse.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Compression.h"
+
+namespace
+{
+using NovaBridgeCore::EContentEncoding;
+
+// A scene/list page worth of JSON: repetitive keys and class names, varied numbers.
+TArray<uint8> MakeListingBody(int32 Actors)
+{
+	FString Json = TEXT("{\"actors\":[");
+	for (int32 Index = 0; Index < Actors; ++Index)
+	{
+		Json += FString::Printf(TEXT("%s{\"name\":\"StaticMeshActor_%d\",\"class\":\"StaticMeshActor\",\"transform\":{\"location\":{\"x\":%.3f,\"y\":%.3f,\"z\":0}}}"),
+			Index > 0 ? TEXT(",") : TEXT(""), Index, Index * 13.37, Index * -7.25);
+	}
+	Json += TEXT("]}");
+	const FTCHARToUTF8 Utf8(*Json, Json.Len());
+	return TArray<uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+}
+
+bool RoundTrips(EContentEncoding Encoding, const TArray<uint8>& Body, int32& OutCompressedBytes)
+{
+	TArray<uint8> Compressed;
+	if (!NovaBridgeCore::CompressResponseBody(Encoding, Body, Compressed))
+	{
+		return false;
+	}
+	OutCompressedBytes = Compressed.Num();
+	TArray<uint8> Restored;
+	Restored.SetNumUninitialized(Body.Num());
+	const FName Format = Encoding == EContentEncoding::Gzip ? NAME_Gzip : NAME_Zlib;
+	return FCompression::UncompressMemory(Format, Restored.GetData(), Restored.Num(), Compressed.GetData(), Compressed.Num()) && Restored == Body;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeResponseCompressionNegotiate,
+	"NovaBridge.Core.ResponseCompression.Negotiate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeResponseCompressionNegotiate::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::NegotiateContentEncoding;
+	TestTrue(TEXT("No header means identity"), NegotiateContentEncoding(TEXT("")) == EContentEncoding::Identity);
+	TestTrue(TEXT("Gzip is preferred"), NegotiateContentEncoding(TEXT("gzip, deflate, br")) == EContentEncoding::Gzip);
+	TestTrue(TEXT("Deflate alone is used"), NegotiateContentEncoding(TEXT("deflate")) == EContentEncoding::Deflate);
+	TestTrue(TEXT("Higher weights win"), NegotiateContentEncoding(TEXT("gzip;q=0.5, deflate;q=0.8")) == EContentEncoding::Deflate);
+	TestTrue(TEXT("q=0 excludes a coding"), NegotiateContentEncoding(TEXT("gzip;q=0, deflate;q=0")) == EContentEncoding::Identity);
+	TestTrue(TEXT("The wildcard covers unlisted codings"), NegotiateContentEncoding(TEXT("*")) == EContentEncoding::Gzip);
+	TestTrue(TEXT("Unsupported codings are ignored"), NegotiateContentEncoding(TEXT("br, zstd")) == EContentEncoding::Identity);
+
+	bool bPassedThrough = false;
+	bool bVaries = false;
+	const FHttpResultCallback Wrapped = NovaBridgeCore::WrapResultCallbackWithCompression(EContentEncoding::Gzip, 1024, nullptr,
+		[&bPassedThrough, &bVaries](TUniquePtr<FHttpServerResponse>&& Response)
+		{
+			bPassedThrough = Response.IsValid() && !Response->Headers.Contains(TEXT("Content-Encoding"));
+			const TArray<FString>* Vary = Response.IsValid() ? Response->Headers.Find(TEXT("Vary")) : nullptr;
+			bVaries = Vary && Vary->Num() == 1 && (*Vary)[0] == TEXT("Accept-Encoding");
+		});
+	Wrapped(FHttpServerResponse::Create(TEXT("{\"status\":\"ok\"}"), TEXT("application/json")));
+	TestTrue(TEXT("Bodies under the threshold complete synchronously and uncompressed"), bPassedThrough);
+	TestTrue(TEXT("Uncompressed bodies still vary on Accept-Encoding"), bVaries);
+
+	bPassedThrough = false;
+	bVaries = false;
+	const FHttpResultCallback WrappedIdentity = NovaBridgeCore::WrapResultCallbackWithCompression(EContentEncoding::Identity, 1024, nullptr,
+		[&bPassedThrough, &bVaries](TUniquePtr<FHttpServerResponse>&& Response)
+		{
+			bPassedThrough = Response.IsValid() && !Response->Headers.Contains(TEXT("Content-Encoding"));
+			const TArray<FString>* Vary = Response.IsValid() ? Response->Headers.Find(TEXT("Vary")) : nullptr;
+			bVaries = Vary && Vary->Num() == 1 && (*Vary)[0] == TEXT("Accept-Encoding");
+		});
+	WrappedIdentity(FHttpServerResponse::Create(FString::ChrN(4096, TEXT('a')), TEXT("text/plain")));
+	TestTrue(TEXT("Identity clients get large bodies uncompressed"), bPassedThrough);
+	TestTrue(TEXT("Identity responses vary on Accept-Encoding"), bVaries);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeResponseCompressionRatio,
+	"NovaBridge.Core.ResponseCompression.Ratio",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeResponseCompressionRatio::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	const TArray<uint8> Body = MakeListingBody(5000);
+	for (EContentEncoding Encoding : { EContentEncoding::Gzip, EContentEncoding::Deflate })
+	{
+		int32 CompressedBytes = 0;
+		const double StartSec = FPlatformTime::Seconds();
+		const bool bRoundTrips = RoundTrips(Encoding, Body, CompressedBytes);
+		const double ElapsedSec = FPlatformTime::Seconds() - StartSec;
+
+		TestTrue(FString::Printf(TEXT("%s round-trips"), NovaBridgeCore::GetContentEncodingName(Encoding)), bRoundTrips);
+		AddInfo(FString::Printf(TEXT("%s: %d -> %d bytes (ratio %.3f) in %.2f ms including decompression"),
+			NovaBridgeCore::GetContentEncodingName(Encoding), Body.Num(), CompressedBytes,
+			static_cast<double>(CompressedBytes) / Body.Num(), ElapsedSec * 1000.0));
+		TestTrue(TEXT("A scene listing compresses at least 4x"), CompressedBytes * 4 < Body.Num());
+	}
+	return true;
+}
+
+#endif
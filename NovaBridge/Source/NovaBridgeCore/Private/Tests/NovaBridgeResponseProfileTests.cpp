@@ -0,0 +1,150 @@
+#include "NovaBridgeResponseProfile.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "NovaBridgeSceneSnapshot.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HttpServerRequest.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+using NovaBridgeCore::ESceneField;
+using NovaBridgeCore::FActorSnapshot;
+using NovaBridgeCore::FResponseProfile;
+
+TSharedRef<FJsonObject> MakeVectorObject(const TCHAR* A, double X, const TCHAR* B, double Y, const TCHAR* C, double Z)
+{
+	TSharedRef<FJsonObject> Vector = MakeShared<FJsonObject>();
+	Vector->SetNumberField(A, X);
+	Vector->SetNumberField(B, Y);
+	Vector->SetNumberField(C, Z);
+	return Vector;
+}
+
+// The object ActorToJson builds for Actor with the default fields.
+TSharedRef<FJsonObject> MakeActorObject(const FActorSnapshot& Actor)
+{
+	TSharedRef<FJsonObject> Obj = MakeShared<FJsonObject>();
+	Obj->SetStringField(TEXT("name"), Actor.Name.ToString());
+	Obj->SetStringField(TEXT("label"), Actor.Label);
+	Obj->SetStringField(TEXT("class"), Actor.ClassName.ToString());
+	Obj->SetStringField(TEXT("path"), Actor.Path);
+	TSharedRef<FJsonObject> Transform = MakeShared<FJsonObject>();
+	Transform->SetObjectField(TEXT("location"), MakeVectorObject(TEXT("x"), Actor.Location.X, TEXT("y"), Actor.Location.Y, TEXT("z"), Actor.Location.Z));
+	Transform->SetObjectField(TEXT("rotation"), MakeVectorObject(TEXT("pitch"), Actor.Rotation.Pitch, TEXT("yaw"), Actor.Rotation.Yaw, TEXT("roll"), Actor.Rotation.Roll));
+	Transform->SetObjectField(TEXT("scale"), MakeVectorObject(TEXT("x"), Actor.Scale.X, TEXT("y"), Actor.Scale.Y, TEXT("z"), Actor.Scale.Z));
+	Obj->SetObjectField(TEXT("transform"), Transform);
+	return Obj;
+}
+
+FString WriteCompact(const FJsonObject& Object, int32 Precision)
+{
+	FString Out;
+	TSharedRef<NovaBridgeCore::FSnapshotJsonWriter> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Out);
+	NovaBridgeCore::WriteCompactJson(*Writer, Object, Precision);
+	Writer->Close();
+	return Out;
+}
+
+FString WriteFull(const TSharedRef<FJsonObject>& Object)
+{
+	FString Out;
+	FJsonSerializer::Serialize(Object, TJsonWriterFactory<>::Create(&Out));
+	return Out;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeResponseProfileFormat,
+	"NovaBridge.Core.ResponseProfile.Format",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeResponseProfileFormat::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::FormatCompactNumber;
+	TestEqual(TEXT("Values round to the precision"), FormatCompactNumber(12.34567, 3), FString(TEXT("12.346")));
+	TestEqual(TEXT("Trailing zeros are trimmed"), FormatCompactNumber(12.5, 3), FString(TEXT("12.5")));
+	TestEqual(TEXT("Integral values have no decimal point"), FormatCompactNumber(-300.0, 3), FString(TEXT("-300")));
+	TestEqual(TEXT("Small fractions keep leading zeros"), FormatCompactNumber(-0.0042, 3), FString(TEXT("-0.004")));
+	TestEqual(TEXT("Values that round to zero lose their sign"), FormatCompactNumber(-0.0001, 3), FString(TEXT("0")));
+	TestEqual(TEXT("Precision zero rounds to integers"), FormatCompactNumber(2.5, 0), FString(TEXT("3")));
+	TestEqual(TEXT("Non-finite values become null"), FormatCompactNumber(FMath::Sqrt(-1.0), 3), FString(TEXT("null")));
+
+	FHttpServerRequest Request;
+	TestFalse(TEXT("Full is the default"), NovaBridgeCore::ParseResponseProfile(Request).bCompact);
+	Request.QueryParams.Add(TEXT("profile"), TEXT("compact"));
+	Request.QueryParams.Add(TEXT("precision"), TEXT("12"));
+	FResponseProfile Profile = NovaBridgeCore::ParseResponseProfile(Request);
+	TestTrue(TEXT("The query string selects compact"), Profile.bCompact);
+	TestEqual(TEXT("Precision is clamped"), Profile.Precision, NovaBridgeCore::CompactMaxPrecision);
+
+	FHttpServerRequest AcceptRequest;
+	AcceptRequest.Headers.Add(TEXT("accept"), { TEXT("application/json; profile=compact; precision=1") });
+	Profile = NovaBridgeCore::ParseResponseProfile(AcceptRequest);
+	TestTrue(TEXT("The Accept header selects compact"), Profile.bCompact);
+	TestEqual(TEXT("The Accept header sets precision"), Profile.Precision, 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeResponseProfileCompact,
+	"NovaBridge.Core.ResponseProfile.Compact",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeResponseProfileCompact::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	FActorSnapshot Actor;
+	Actor.Name = FName(TEXT("Cube"), 3);
+	Actor.ClassName = FName(TEXT("StaticMeshActor"));
+	Actor.Path = TEXT("/Game/Maps/Main.Main:PersistentLevel.Cube_2");
+	Actor.Location = FVector(100.123456, -0.00001, 50.0);
+
+	const TSharedRef<FJsonObject> Object = MakeActorObject(Actor);
+	const FString Compact = WriteCompact(*Object, 2);
+	TestEqual(TEXT("Vectors become arrays and defaults are dropped"), Compact,
+		FString(TEXT("{\"name\":\"Cube_2\",\"class\":\"StaticMeshActor\",\"path\":\"/Game/Maps/Main.Main:PersistentLevel.Cube_2\",\"transform\":{\"location\":[100.12,0,50]}}")));
+
+	FString Snapshot;
+	TSharedRef<NovaBridgeCore::FSnapshotJsonWriter> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Snapshot);
+	NovaBridgeCore::WriteActorSnapshot(*Writer, Actor, ESceneField::Default, FResponseProfile { true, 2 });
+	Writer->Close();
+	TestEqual(TEXT("Snapshot listings match the compacted DOM"), Snapshot, Compact);
+
+	Actor.Rotation = FRotator(0.0, 90.0, 0.0);
+	Actor.Scale = FVector(2.0);
+	const FString Rotated = WriteCompact(*MakeActorObject(Actor), 2);
+	TestTrue(TEXT("Non-default rotations are kept"), Rotated.Contains(TEXT("\"rotation\":[0,90,0]")));
+	TestTrue(TEXT("Non-default scales are kept"), Rotated.Contains(TEXT("\"scale\":[2,2,2]")));
+
+	TSharedRef<FJsonObject> Camera = MakeShared<FJsonObject>();
+	Camera->SetObjectField(TEXT("location"), MakeVectorObject(TEXT("x"), 1.0, TEXT("y"), 2.0, TEXT("z"), 3.0));
+	Camera->SetNumberField(TEXT("fov"), 90.0);
+	Camera->SetField(TEXT("target"), MakeShared<FJsonValueNull>());
+	Camera->SetBoolField(TEXT("ok"), false);
+	TestEqual(TEXT("Nulls are dropped; booleans are kept"), WriteCompact(*Camera, 3), FString(TEXT("{\"location\":[1,2,3],\"fov\":90,\"ok\":false}")));
+
+	// Size of a 1000-actor listing body in each profile.
+	TArray<TSharedPtr<FJsonValue>> Actors;
+	for (int32 Index = 0; Index < 1000; ++Index)
+	{
+		Actor.Name = FName(TEXT("Rock"), Index + 1);
+		Actor.Location = FVector(Index * 13.37, Index * -7.1234567, 0.5);
+		Actor.Rotation = FRotator(0.0, Index % 360, 0.0);
+		Actor.Scale = FVector::OneVector;
+		Actors.Add(MakeShared<FJsonValueObject>(MakeActorObject(Actor)));
+	}
+	TSharedRef<FJsonObject> Listing = MakeShared<FJsonObject>();
+	Listing->SetArrayField(TEXT("actors"), Actors);
+	const int32 FullLen = WriteFull(Listing).Len();
+	const int32 CompactLen = WriteCompact(*Listing, NovaBridgeCore::CompactDefaultPrecision).Len();
+	AddInfo(FString::Printf(TEXT("1000 actors: full %d chars, compact %d chars (%.1fx)"), FullLen, CompactLen, static_cast<double>(FullLen) / FMath::Max(1, CompactLen)));
+	TestTrue(TEXT("Compact listings are less than half the size"), CompactLen * 2 < FullLen);
+	return true;
+}
+
+#endif
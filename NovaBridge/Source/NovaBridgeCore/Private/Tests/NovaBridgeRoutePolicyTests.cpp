@@ -0,0 +1,95 @@
+#include "NovaBridgeRoutePolicy.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeRoutePolicyTable,
+	"NovaBridge.Core.RoutePolicy.Table",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeRoutePolicyTable::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::FTokenBucketRateLimiter;
+	const int32 Admin = FTokenBucketRateLimiter::RoleSlotForName(TEXT("admin"));
+	const int32 ReadOnly = FTokenBucketRateLimiter::RoleSlotForName(TEXT("read_only"));
+	const int32 Unknown = FTokenBucketRateLimiter::RoleSlotForName(TEXT("guest"));
+	TestEqual(TEXT("Role slots map back to role names"), FString(NovaBridgeCore::FRoutePolicyTable::RoleNameForSlot(ReadOnly)), FString(TEXT("read_only")));
+
+	NovaBridgeCore::FRoutePolicy Policy;
+	Policy.Path = TEXT("/nova/scene/get");
+	Policy.ReadRoleMask = static_cast<uint8>((1u << Admin) | (1u << ReadOnly));
+	Policy.WriteRoleMask = static_cast<uint8>(1u << Admin);
+	Policy.RateLimitPerMinute[Admin] = 240;
+
+	NovaBridgeCore::FRoutePolicyTable Table;
+	const NovaBridgeCore::FRoutePolicy* Record = Table.Add(Policy);
+	TestTrue(TEXT("Read-only role may GET"), Record->Allows(ReadOnly, EHttpServerRequestVerbs::VERB_GET));
+	TestFalse(TEXT("Read-only role may not POST"), Record->Allows(ReadOnly, EHttpServerRequestVerbs::VERB_POST));
+	TestFalse(TEXT("Unknown roles are never allowed"), Record->Allows(Unknown, EHttpServerRequestVerbs::VERB_GET));
+	TestEqual(TEXT("Rate limits are per role slot"), Record->RateLimitFor(Admin), 240);
+	TestEqual(TEXT("Out-of-range slots have no rate budget"), Record->RateLimitFor(-1), 0);
+
+	Policy.RateLimitPerMinute[Admin] = 30;
+	const NovaBridgeCore::FRoutePolicy* Rebound = Table.Add(Policy);
+	TestTrue(TEXT("Re-adding a path makes a new record"), Rebound != Record);
+	TestEqual(TEXT("Holders of the old record keep reading it unchanged"), Record->RateLimitFor(Admin), 240);
+	TestEqual(TEXT("The new record has the new limits"), Rebound->RateLimitFor(Admin), 30);
+	TestTrue(TEXT("Lookup by path finds the current record"), Table.Find(TEXT("/nova/scene/get")) == Rebound);
+	TestEqual(TEXT("The table lists one record per path"), Table.GetAll().Num(), 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeRoutePolicyPostReads,
+	"NovaBridge.Core.RoutePolicy.PostReads",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeRoutePolicyPostReads::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::FTokenBucketRateLimiter;
+	const int32 Admin = FTokenBucketRateLimiter::RoleSlotForName(TEXT("admin"));
+	const int32 ReadOnly = FTokenBucketRateLimiter::RoleSlotForName(TEXT("read_only"));
+
+	// Compiled the way the editor compiles a POST read: read_only is in both masks.
+	NovaBridgeCore::FRoutePolicy Query;
+	Query.Path = TEXT("/nova/scene/query");
+	Query.bReadOnly = true;
+	Query.ReadRoleMask = static_cast<uint8>((1u << Admin) | (1u << ReadOnly));
+	Query.WriteRoleMask = static_cast<uint8>((1u << Admin) | (1u << ReadOnly));
+	TestTrue(TEXT("read_only may POST a read-only query"), Query.Allows(ReadOnly, EHttpServerRequestVerbs::VERB_POST));
+	TestTrue(TEXT("admin may still POST it"), Query.Allows(Admin, EHttpServerRequestVerbs::VERB_POST));
+
+	NovaBridgeCore::FRoutePolicy GetMany = Query;
+	GetMany.Path = TEXT("/nova/scene/get-many");
+	TestTrue(TEXT("read_only may POST scene/get-many"), GetMany.Allows(ReadOnly, EHttpServerRequestVerbs::VERB_POST));
+
+	NovaBridgeCore::FRoutePolicyTable Table;
+	Table.Add(Query);
+	Table.Add(GetMany);
+	TArray<TSharedPtr<FJsonValue>> Routes = NovaBridgeCore::MakeRoutePolicyJson(Table.GetAll(), ReadOnly);
+	for (const TSharedPtr<FJsonValue>& Route : Routes)
+	{
+		const TSharedPtr<FJsonObject> RouteObj = Route->AsObject();
+		TestTrue(FString::Printf(TEXT("caps reports %s as callable by read_only"), *RouteObj->GetStringField(TEXT("path"))), RouteObj->GetBoolField(TEXT("write")));
+	}
+	TestEqual(TEXT("Both POST reads are listed"), Routes.Num(), 2);
+
+	// Any other read-only route (runtime ones included) keeps read_only out of the write mask, and being
+	// read-only does not widen that.
+	NovaBridgeCore::FRoutePolicy List;
+	List.Path = TEXT("/nova/scene/list");
+	List.bReadOnly = true;
+	List.ReadRoleMask = static_cast<uint8>((1u << Admin) | (1u << ReadOnly));
+	List.WriteRoleMask = static_cast<uint8>(1u << Admin);
+	TestTrue(TEXT("read_only may GET a read-only route"), List.Allows(ReadOnly, EHttpServerRequestVerbs::VERB_GET));
+	TestFalse(TEXT("read_only may not POST a read-only route"), List.Allows(ReadOnly, EHttpServerRequestVerbs::VERB_POST));
+	TestFalse(TEXT("read_only may not DELETE a read-only route"), List.Allows(ReadOnly, EHttpServerRequestVerbs::VERB_DELETE));
+	return true;
+}
+
+#endif
@@ -0,0 +1,93 @@
+#include "NovaBridgeSceneChangeLog.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+using FTestChangeLog = NovaBridgeCore::TSceneChangeLog<int32>;
+using FTestChange = NovaBridgeCore::TSceneChange<int32>;
+
+const FTestChange* FindChange(const TArray<FTestChange>& Changes, uint32 Id)
+{
+	return Changes.FindByPredicate([Id](const FTestChange& Change) { return Change.Id == Id; });
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeSceneChangeLogDelta,
+	"NovaBridge.Core.SceneChangeLog.Delta",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeSceneChangeLogDelta::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::ESceneChangeKind;
+	FTestChangeLog Log(64);
+	Log.Record(ESceneChangeKind::Added, 1, TEXT("Cube"), 1);
+	Log.Record(ESceneChangeKind::Added, 2, TEXT("Light"), 2);
+	const uint64 Synced = Log.GetRevision();
+
+	TArray<FTestChange> Changes;
+	TestTrue(TEXT("An up-to-date cursor replays"), Log.CollectSince(Synced, Changes));
+	TestEqual(TEXT("Nothing changed since the cursor"), Changes.Num(), 0);
+
+	for (int32 Tick = 0; Tick < 100; ++Tick)
+	{
+		Log.Record(ESceneChangeKind::Modified, 1, TEXT("Cube"), 1);
+	}
+	Log.Record(ESceneChangeKind::Added, 3, TEXT("Temp"), 3);
+	Log.Record(ESceneChangeKind::Modified, 3, TEXT("Temp"), 3);
+	Log.Record(ESceneChangeKind::Removed, 3, TEXT("Temp"), 3);
+	Log.Record(ESceneChangeKind::Removed, 2, TEXT("Light"), 2);
+	Log.Record(ESceneChangeKind::Added, 4, TEXT("Sphere"), 4);
+	Log.Record(ESceneChangeKind::Modified, 4, TEXT("Sphere"), 4);
+
+	TestTrue(TEXT("Delta replays"), Log.CollectSince(Synced, Changes));
+	TestEqual(TEXT("One entry per surviving actor"), Changes.Num(), 3);
+	const FTestChange* Moved = FindChange(Changes, 1);
+	TestTrue(TEXT("A dragged actor is reported once as modified"), Moved && Moved->Kind == ESceneChangeKind::Modified);
+	const FTestChange* Removed = FindChange(Changes, 2);
+	TestTrue(TEXT("A deleted actor is reported as removed"), Removed && Removed->Kind == ESceneChangeKind::Removed);
+	const FTestChange* Added = FindChange(Changes, 4);
+	TestTrue(TEXT("A new then edited actor is still reported as added"), Added && Added->Kind == ESceneChangeKind::Added);
+	TestTrue(TEXT("Net changes carry the latest revision"), Added && Added->Revision == Log.GetRevision());
+	TestTrue(TEXT("Actors added and removed inside the window are omitted"), FindChange(Changes, 3) == nullptr);
+
+	Changes.Reset();
+	TestFalse(TEXT("A cursor from the future needs a resync"), Log.CollectSince(Log.GetRevision() + 1, Changes));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeSceneChangeLogRollover,
+	"NovaBridge.Core.SceneChangeLog.Rollover",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeSceneChangeLogRollover::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::ESceneChangeKind;
+	FTestChangeLog Log(8);
+	for (uint32 Id = 1; Id <= 20; ++Id)
+	{
+		Log.Record(ESceneChangeKind::Added, Id, TEXT("Actor"), static_cast<int32>(Id));
+	}
+
+	TArray<FTestChange> Changes;
+	TestFalse(TEXT("A cursor behind the wrapped ring needs a resync"), Log.CollectSince(4, Changes));
+	TestEqual(TEXT("Floor is the newest dropped revision"), Log.GetFloorRevision(), static_cast<uint64>(12));
+	TestTrue(TEXT("A cursor at the floor still replays"), Log.CollectSince(Log.GetFloorRevision(), Changes));
+	TestEqual(TEXT("Every retained change is returned"), Changes.Num(), 8);
+
+	const uint64 BeforeReset = Log.GetRevision();
+	Log.Reset();
+	Changes.Reset();
+	TestTrue(TEXT("Reset moves the revision forward"), Log.GetRevision() > BeforeReset);
+	TestFalse(TEXT("Cursors from before a reset need a resync"), Log.CollectSince(BeforeReset, Changes));
+	TestTrue(TEXT("The post-reset revision replays"), Log.CollectSince(Log.GetRevision(), Changes));
+	return true;
+}
+
+#endif
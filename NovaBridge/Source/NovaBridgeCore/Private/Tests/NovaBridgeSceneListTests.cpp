@@ -0,0 +1,151 @@
+#include "NovaBridgeSceneList.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+bool ParseGetManyJson(const FString& Json, NovaBridgeCore::FSceneGetManyRequest& OutRequest, FString& OutError)
+{
+	TSharedPtr<FJsonObject> Body;
+	return FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Body) && Body.IsValid()
+		&& NovaBridgeCore::ParseSceneGetManyRequest(*Body, OutRequest, OutError);
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeSceneListPaging,
+	"NovaBridge.Core.SceneList.Paging",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeSceneListPaging::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	// 250 actors in scrambled scan order, with two same-named actors split by id.
+	TArray<NovaBridgeCore::FSceneListKey> Scene;
+	for (int32 Index = 0; Index < 250; ++Index)
+	{
+		const int32 Scrambled = (Index * 97) % 250;
+		Scene.Add({ FName(*FString::Printf(TEXT("Actor_%03d"), Scrambled / 2)), static_cast<uint32>(Scrambled) });
+	}
+	TArray<NovaBridgeCore::FSceneListKey> Expected = Scene;
+	Expected.Sort();
+
+	TMap<FString, FString> Params;
+	Params.Add(TEXT("limit"), TEXT("40"));
+	TArray<NovaBridgeCore::FSceneListKey> Walked;
+	int32 Pages = 0;
+	bool bHasMore = true;
+	FString Error;
+	while (bHasMore && Pages < 20)
+	{
+		NovaBridgeCore::FSceneListQuery Query;
+		TestTrue(TEXT("Page query parses"), NovaBridgeCore::ParseSceneListQuery(Params, 1000, Query, Error));
+		NovaBridgeCore::TScenePageCollector<int32> Collector(Query);
+		for (int32 Index = 0; Index < Scene.Num(); ++Index)
+		{
+			Collector.Offer(Scene[Index], Index);
+		}
+		const TArray<TPair<NovaBridgeCore::FSceneListKey, int32>> Page = Collector.Finish(bHasMore);
+		for (const TPair<NovaBridgeCore::FSceneListKey, int32>& Entry : Page)
+		{
+			Walked.Add(Entry.Key);
+		}
+		if (Page.Num() > 0)
+		{
+			Params.Add(TEXT("cursor"), NovaBridgeCore::MakeSceneListCursor(Page.Last().Key));
+		}
+		++Pages;
+	}
+
+	TestEqual(TEXT("Seven pages of 40 cover 250 actors"), Pages, 7);
+	TestEqual(TEXT("Every actor is listed exactly once"), Walked.Num(), Expected.Num());
+	bool bOrdered = Walked.Num() == Expected.Num();
+	for (int32 Index = 0; bOrdered && Index < Walked.Num(); ++Index)
+	{
+		bOrdered = Walked[Index].Name == Expected[Index].Name && Walked[Index].Id == Expected[Index].Id;
+	}
+	TestTrue(TEXT("Pages follow the stable name/id order"), bOrdered);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeSceneListQueryParams,
+	"NovaBridge.Core.SceneList.QueryParams",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeSceneListQueryParams::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	FString Error;
+	NovaBridgeCore::FSceneListQuery Query;
+	TMap<FString, FString> Params;
+	TestTrue(TEXT("Empty params use defaults"), NovaBridgeCore::ParseSceneListQuery(Params, 500, Query, Error));
+	TestEqual(TEXT("Default limit applies"), Query.Limit, 500);
+	TestTrue(TEXT("Default fields match the legacy payload"), Query.Fields == NovaBridgeCore::ESceneField::Default);
+
+	Params.Add(TEXT("limit"), TEXT("999999"));
+	Params.Add(TEXT("class"), TEXT("/Script/Engine.StaticMeshActor"));
+	Params.Add(TEXT("tag"), TEXT("Hero"));
+	Params.Add(TEXT("fields"), TEXT("name, transform"));
+	TestTrue(TEXT("Full params parse"), NovaBridgeCore::ParseSceneListQuery(Params, 500, Query, Error));
+	TestEqual(TEXT("Limit is clamped"), Query.Limit, NovaBridgeCore::SceneListMaxLimit);
+	TestTrue(TEXT("Class paths reduce to the short name"), Query.ClassName == FName(TEXT("StaticMeshActor")));
+	TestTrue(TEXT("Tag is kept"), Query.Tag == FName(TEXT("Hero")));
+	TestTrue(TEXT("Fields are projected"), Query.Fields == (NovaBridgeCore::ESceneField::Name | NovaBridgeCore::ESceneField::Transform));
+
+	Params.Add(TEXT("fields"), TEXT("name,colour"));
+	TestFalse(TEXT("Unknown fields are rejected"), NovaBridgeCore::ParseSceneListQuery(Params, 500, Query, Error));
+	Params.Add(TEXT("fields"), TEXT("all"));
+	Params.Add(TEXT("cursor"), TEXT("no-separator"));
+	TestFalse(TEXT("Malformed cursors are rejected"), NovaBridgeCore::ParseSceneListQuery(Params, 500, Query, Error));
+	Params.Add(TEXT("cursor"), TEXT(""));
+	Params.Add(TEXT("limit"), TEXT("0"));
+	TestFalse(TEXT("Non-positive limits are rejected"), NovaBridgeCore::ParseSceneListQuery(Params, 500, Query, Error));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeSceneListGetManyRequest,
+	"NovaBridge.Core.SceneList.GetManyRequest",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeSceneListGetManyRequest::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::ESceneField;
+	NovaBridgeCore::FSceneGetManyRequest Request;
+	FString Error;
+
+	TestTrue(TEXT("Named actors parse"), ParseGetManyJson(
+		TEXT("{\"names\":[\"Lamp_1\",\"Lamp_2\",\"Lamp_1\"],\"properties\":[\"bHidden\",\" LightComponent.Intensity \",\"bhidden\"]}"), Request, Error));
+	TestEqual(TEXT("Duplicate names are dropped"), Request.Names.Num(), 2);
+	TestTrue(TEXT("Paths are trimmed and de-duplicated in order"),
+		Request.Properties == TArray<FString>({ TEXT("bHidden"), TEXT("LightComponent.Intensity") }));
+	TestTrue(TEXT("Only the name is projected by default"), Request.Query.Fields == ESceneField::Name);
+
+	TestTrue(TEXT("Filters parse with scene/list rules"), ParseGetManyJson(
+		TEXT("{\"class\":\"/Script/Engine.PointLight\",\"tag\":\"Dashboard\",\"limit\":25,\"fields\":\"name,class\",\"properties\":[\"bHidden\"]}"), Request, Error));
+	TestEqual(TEXT("Class paths are shortened"), Request.Query.ClassName, FName(TEXT("PointLight")));
+	TestEqual(TEXT("Limit is read from a number"), Request.Query.Limit, 25);
+	TestTrue(TEXT("Fields widen the projection"), Request.Query.Fields == (ESceneField::Name | ESceneField::Class));
+
+	TestFalse(TEXT("A property list is required"), ParseGetManyJson(TEXT("{\"names\":[\"Lamp_1\"]}"), Request, Error));
+	TestFalse(TEXT("Non-string paths are rejected"), ParseGetManyJson(TEXT("{\"properties\":[1]}"), Request, Error));
+	TestFalse(TEXT("Non-positive limits are rejected"), ParseGetManyJson(TEXT("{\"properties\":[\"bHidden\"],\"limit\":0}"), Request, Error));
+
+	FString TooMany = TEXT("{\"properties\":[");
+	for (int32 Index = 0; Index <= NovaBridgeCore::SceneGetManyMaxProperties; ++Index)
+	{
+		TooMany += FString::Printf(TEXT("%s\"P%d\""), Index > 0 ? TEXT(",") : TEXT(""), Index);
+	}
+	TooMany += TEXT("]}");
+	TestFalse(TEXT("Property lists are capped"), ParseGetManyJson(TooMany, Request, Error));
+	return true;
+}
+
+#endif
@@ -0,0 +1,157 @@
+#include "NovaBridgeSceneQuery.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+// 20x20x5 grid of 50cm cubes spaced 1m apart, centred on the origin in X/Y.
+TArray<FBox> MakeSceneGrid()
+{
+	TArray<FBox> Boxes;
+	for (int32 Z = 0; Z < 5; ++Z)
+	{
+		for (int32 Y = 0; Y < 20; ++Y)
+		{
+			for (int32 X = 0; X < 20; ++X)
+			{
+				Boxes.Add(FBox::BuildAABB(FVector((X - 10) * 100.0, (Y - 10) * 100.0, Z * 100.0), FVector(25.0)));
+			}
+		}
+	}
+	return Boxes;
+}
+
+TArray<int32> QueryIds(const NovaBridgeCore::TSceneSpatialIndex<int32>& Index, const NovaBridgeCore::FSceneQueryShape& Shape)
+{
+	TArray<int32> Ids;
+	Index.Query(Shape, [&Ids](uint32 Id, const int32& Handle, const FBox& Bounds)
+	{
+		(void)Id;
+		(void)Bounds;
+		Ids.Add(Handle);
+	});
+	Ids.Sort();
+	return Ids;
+}
+
+TArray<int32> BruteForceIds(const TArray<FBox>& Boxes, const NovaBridgeCore::FSceneQueryShape& Shape)
+{
+	TArray<int32> Ids;
+	for (int32 Index = 0; Index < Boxes.Num(); ++Index)
+	{
+		if (Shape.Intersects(Boxes[Index]))
+		{
+			Ids.Add(Index);
+		}
+	}
+	return Ids;
+}
+
+bool ParseShapeJson(const FString& Json, NovaBridgeCore::FSceneQueryShape& OutShape, FString& OutError)
+{
+	TSharedPtr<FJsonObject> Body;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	return FJsonSerializer::Deserialize(Reader, Body) && Body.IsValid() && NovaBridgeCore::ParseSceneQueryShape(*Body, OutShape, OutError);
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeSceneQueryIndex,
+	"NovaBridge.Core.SceneQuery.Index",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeSceneQueryIndex::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::FSceneQueryShape;
+	const TArray<FBox> Boxes = MakeSceneGrid();
+	NovaBridgeCore::TSceneSpatialIndex<int32> Index;
+	for (int32 Id = 0; Id < Boxes.Num(); ++Id)
+	{
+		Index.Update(static_cast<uint32>(Id), Id, Boxes[Id]);
+	}
+	TestEqual(TEXT("Every actor is indexed"), Index.Num(), Boxes.Num());
+
+	const FSceneQueryShape Box = FSceneQueryShape::MakeBox(FBox(FVector(-150.0, -150.0, -10.0), FVector(150.0, 150.0, 10.0)));
+	TestEqual(TEXT("Box query returns the 3x3 ground patch"), QueryIds(Index, Box).Num(), 9);
+	TestTrue(TEXT("Box query matches brute force"), QueryIds(Index, Box) == BruteForceIds(Boxes, Box));
+
+	const FSceneQueryShape Sphere = FSceneQueryShape::MakeSphere(FVector(0.0, 0.0, 200.0), 120.0);
+	TestTrue(TEXT("Sphere query matches brute force"), QueryIds(Index, Sphere) == BruteForceIds(Boxes, Sphere));
+	TestTrue(TEXT("Sphere query excludes box corners"), QueryIds(Index, Sphere).Num() < QueryIds(Index, FSceneQueryShape::MakeBox(Sphere.Bounds)).Num());
+
+	// Looking down +X from behind the grid: only actors inside the 30 degree cone are visible.
+	const FSceneQueryShape Frustum = FSceneQueryShape::MakeFrustum(FVector(-1500.0, 0.0, 200.0), FRotator::ZeroRotator, 30.0, 1.0, 10.0, 3000.0);
+	const TArray<int32> Visible = QueryIds(Index, Frustum);
+	TestTrue(TEXT("Frustum query finds actors"), Visible.Num() > 0 && Visible.Num() < Boxes.Num());
+	TestTrue(TEXT("Frustum query matches brute force"), Visible == BruteForceIds(Boxes, Frustum));
+	TestFalse(TEXT("Actors behind the camera are culled"), Frustum.Intersects(FBox::BuildAABB(FVector(-1700.0, 0.0, 200.0), FVector(25.0))));
+
+	// Move one actor into the box and delete another from it.
+	Index.Update(399, 399, FBox::BuildAABB(FVector(0.0, 0.0, 0.0), FVector(10.0)));
+	const TArray<int32> Before = QueryIds(Index, Box);
+	Index.Remove(static_cast<uint32>(Before[0]));
+	const TArray<int32> After = QueryIds(Index, Box);
+	TestTrue(TEXT("Moved actors are found at their new bounds"), After.Contains(399));
+	TestFalse(TEXT("Removed actors are gone"), After.Contains(Before[0]));
+	TestEqual(TEXT("Removal updates the count"), Index.Num(), Boxes.Num() - 1);
+
+	int32 Nearest = INDEX_NONE;
+	TestTrue(TEXT("Nearest lookup finds a close actor"), Index.FindNearest(FVector(310.0, 0.0, 0.0), 200.0, [](const int32& Handle) { return Handle != 399; }, Nearest));
+	TestEqual(TEXT("Nearest lookup picks the closest bounds"), Nearest, 10 * 20 + 13);
+	TestFalse(TEXT("Nothing is found beyond the radius"), Index.FindNearest(FVector(5000.0, 5000.0, 0.0), 100.0, [](const int32&) { return true; }, Nearest));
+
+	// Rough cost of answering a small region against the index versus scanning every actor.
+	const double IndexStart = FPlatformTime::Seconds();
+	int32 IndexHits = 0;
+	for (int32 Iteration = 0; Iteration < 1000; ++Iteration)
+	{
+		IndexHits += QueryIds(Index, Sphere).Num();
+	}
+	const double IndexSec = FPlatformTime::Seconds() - IndexStart;
+	const double ScanStart = FPlatformTime::Seconds();
+	int32 ScanHits = 0;
+	for (int32 Iteration = 0; Iteration < 1000; ++Iteration)
+	{
+		ScanHits += BruteForceIds(Boxes, Sphere).Num();
+	}
+	const double ScanSec = FPlatformTime::Seconds() - ScanStart;
+	AddInfo(FString::Printf(TEXT("1000 sphere queries over %d actors: index %.2f ms (%d hits), scan %.2f ms (%d hits)"),
+		Boxes.Num(), IndexSec * 1000.0, IndexHits, ScanSec * 1000.0, ScanHits));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeSceneQueryShapes,
+	"NovaBridge.Core.SceneQuery.Shapes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeSceneQueryShapes::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	NovaBridgeCore::FSceneQueryShape Shape;
+	FString Error;
+	TestTrue(TEXT("Box from min/max parses"), ParseShapeJson(TEXT("{\"box\":{\"min\":[10,0,0],\"max\":{\"x\":0,\"y\":5,\"z\":5}}}"), Shape, Error));
+	TestTrue(TEXT("Box corners are normalized"), Shape.Bounds.Min == FVector(0.0, 0.0, 0.0) && Shape.Bounds.Max == FVector(10.0, 5.0, 5.0));
+	TestTrue(TEXT("Box from center/extent parses"), ParseShapeJson(TEXT("{\"box\":{\"center\":[0,0,0],\"extent\":[1,2,3]}}"), Shape, Error));
+	TestTrue(TEXT("Sphere parses"), ParseShapeJson(TEXT("{\"sphere\":{\"center\":[0,0,0],\"radius\":50}}"), Shape, Error));
+	TestTrue(TEXT("Sphere kind is set"), Shape.Kind == NovaBridgeCore::ESceneQueryShape::Sphere);
+	TestTrue(TEXT("Frustum parses with defaults"), ParseShapeJson(TEXT("{\"frustum\":{\"origin\":[0,0,0],\"rotation\":{\"pitch\":0,\"yaw\":90,\"roll\":0}}}"), Shape, Error));
+	TestEqual(TEXT("Frustum has six planes"), Shape.Planes.Num(), 6);
+	TestTrue(TEXT("Yawed frustum looks down +Y"), Shape.Intersects(FBox::BuildAABB(FVector(0.0, 500.0, 0.0), FVector(10.0)))
+		&& !Shape.Intersects(FBox::BuildAABB(FVector(500.0, 0.0, 0.0), FVector(10.0))));
+
+	TestFalse(TEXT("Two shapes are rejected"), ParseShapeJson(TEXT("{\"box\":{\"min\":[0,0,0],\"max\":[1,1,1]},\"sphere\":{\"center\":[0,0,0],\"radius\":1}}"), Shape, Error));
+	TestFalse(TEXT("No shape is rejected"), ParseShapeJson(TEXT("{}"), Shape, Error));
+	TestFalse(TEXT("Zero radius is rejected"), ParseShapeJson(TEXT("{\"sphere\":{\"center\":[0,0,0],\"radius\":0}}"), Shape, Error));
+	TestFalse(TEXT("Inverted clip planes are rejected"), ParseShapeJson(TEXT("{\"frustum\":{\"origin\":[0,0,0],\"near\":100,\"far\":10}}"), Shape, Error));
+	return true;
+}
+
+#endif
@@ -0,0 +1,157 @@
+#include "NovaBridgeSceneSnapshot.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+using NovaBridgeCore::ESceneField;
+using NovaBridgeCore::FActorSnapshot;
+
+TArray<FActorSnapshot> MakeSnapshots(int32 Count)
+{
+	TArray<FActorSnapshot> Actors;
+	Actors.SetNum(Count);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		FActorSnapshot& Actor = Actors[Index];
+		Actor.Name = FName(TEXT("StaticMeshActor"), Index + 1);
+		Actor.Label = FString::Printf(TEXT("Rock %d"), Index);
+		Actor.ClassName = FName(TEXT("StaticMeshActor"));
+		Actor.Path = FString::Printf(TEXT("/Game/Maps/Main.Main:PersistentLevel.%s"), *Actor.Name.ToString());
+		Actor.Tags = { FName(TEXT("Scatter")) };
+		Actor.Location = FVector(Index * 100.0, -Index * 50.0, 12.5);
+		Actor.Rotation = FRotator(0.0, Index % 360, 0.0);
+		Actor.Scale = FVector(1.0 + (Index % 3));
+	}
+	return Actors;
+}
+
+// The DOM path the listings used before: one FJsonObject per actor, serialized with the default writer.
+FString EncodeWithDom(const TArray<FActorSnapshot>& Actors)
+{
+	TArray<TSharedPtr<FJsonValue>> ActorArray;
+	for (const FActorSnapshot& Actor : Actors)
+	{
+		TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+		Obj->SetStringField(TEXT("name"), Actor.Name.ToString());
+		Obj->SetStringField(TEXT("label"), Actor.Label);
+		Obj->SetStringField(TEXT("class"), Actor.ClassName.ToString());
+		Obj->SetStringField(TEXT("path"), Actor.Path);
+		TSharedPtr<FJsonObject> Transform = MakeShared<FJsonObject>();
+		TSharedPtr<FJsonObject> Loc = MakeShared<FJsonObject>();
+		Loc->SetNumberField(TEXT("x"), Actor.Location.X);
+		Loc->SetNumberField(TEXT("y"), Actor.Location.Y);
+		Loc->SetNumberField(TEXT("z"), Actor.Location.Z);
+		Transform->SetObjectField(TEXT("location"), Loc);
+		TSharedPtr<FJsonObject> Rot = MakeShared<FJsonObject>();
+		Rot->SetNumberField(TEXT("pitch"), Actor.Rotation.Pitch);
+		Rot->SetNumberField(TEXT("yaw"), Actor.Rotation.Yaw);
+		Rot->SetNumberField(TEXT("roll"), Actor.Rotation.Roll);
+		Transform->SetObjectField(TEXT("rotation"), Rot);
+		TSharedPtr<FJsonObject> Scale = MakeShared<FJsonObject>();
+		Scale->SetNumberField(TEXT("x"), Actor.Scale.X);
+		Scale->SetNumberField(TEXT("y"), Actor.Scale.Y);
+		Scale->SetNumberField(TEXT("z"), Actor.Scale.Z);
+		Transform->SetObjectField(TEXT("scale"), Scale);
+		Obj->SetObjectField(TEXT("transform"), Transform);
+		ActorArray.Add(MakeShared<FJsonValueObject>(Obj));
+	}
+
+	TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetArrayField(TEXT("actors"), ActorArray);
+	Result->SetNumberField(TEXT("count"), ActorArray.Num());
+	FString Out;
+	FJsonSerializer::Serialize(Result, TJsonWriterFactory<>::Create(&Out));
+	return Out;
+}
+
+TSharedPtr<FJsonObject> ParseObject(const FString& Json)
+{
+	TSharedPtr<FJsonObject> Object;
+	FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Object);
+	return Object;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeSceneSnapshotEncode,
+	"NovaBridge.Core.SceneSnapshot.Encode",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeSceneSnapshotEncode::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	TArray<FActorSnapshot> Actors = MakeSnapshots(10);
+	Actors[4].Label = TEXT("Say \"hi\"\\\n\u00C4");
+
+	const FString Whole = NovaBridgeCore::EncodeActorSnapshotsJson(Actors, ESceneField::All, 1000);
+	TestEqual(TEXT("Chunked encoding matches a single chunk"), NovaBridgeCore::EncodeActorSnapshotsJson(Actors, ESceneField::All, 3), Whole);
+	TestEqual(TEXT("One-item chunks match a single chunk"), NovaBridgeCore::EncodeActorSnapshotsJson(Actors, ESceneField::All, 1), Whole);
+	TestEqual(TEXT("No actors encode as an empty array"), NovaBridgeCore::EncodeActorSnapshotsJson(TArray<FActorSnapshot>(), ESceneField::All), FString(TEXT("[]")));
+
+	TSharedRef<FJsonObject> Envelope = MakeShared<FJsonObject>();
+	Envelope->SetNumberField(TEXT("count"), Actors.Num());
+	const TSharedPtr<FJsonObject> Body = ParseObject(NovaBridgeCore::ComposeJsonBody(Envelope, TEXT("actors"), Whole));
+	const TArray<TSharedPtr<FJsonValue>>* Parsed = nullptr;
+	if (!TestTrue(TEXT("Composed body parses"), Body.IsValid() && Body->TryGetArrayField(TEXT("actors"), Parsed) && Parsed->Num() == Actors.Num()))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Envelope fields are kept"), static_cast<int32>(Body->GetNumberField(TEXT("count"))), Actors.Num());
+
+	const TSharedPtr<FJsonObject> Tricky = (*Parsed)[4]->AsObject();
+	TestEqual(TEXT("Strings are escaped and round-trip"), Tricky->GetStringField(TEXT("label")), Actors[4].Label);
+	TestEqual(TEXT("Names are written as strings"), Tricky->GetStringField(TEXT("name")), Actors[4].Name.ToString());
+	TestEqual(TEXT("Tags are written"), Tricky->GetArrayField(TEXT("tags")).Num(), 1);
+	const TSharedPtr<FJsonObject> Location = Tricky->GetObjectField(TEXT("transform"))->GetObjectField(TEXT("location"));
+	TestEqual(TEXT("Transforms are written"), Location->GetNumberField(TEXT("x")), Actors[4].Location.X);
+
+	const TSharedPtr<FJsonObject> NameOnly = ParseObject(NovaBridgeCore::ComposeJsonBody(MakeShared<FJsonObject>(), TEXT("actors"),
+		NovaBridgeCore::EncodeActorSnapshotsJson(Actors, ESceneField::Name)));
+	TestTrue(TEXT("An empty envelope composes"), NameOnly.IsValid() && NameOnly->Values.Num() == 1);
+	TestEqual(TEXT("Fields are projected"), NameOnly.IsValid() ? NameOnly->GetArrayField(TEXT("actors"))[0]->AsObject()->Values.Num() : 0, 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeSceneSnapshotBenchmark,
+	"NovaBridge.Core.SceneSnapshot.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeSceneSnapshotBenchmark::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	// A 50k-actor listing. Before, the game thread built and serialized the DOM; now it only copies the
+	// snapshot (the array copy stands in for reading actors) and the parallel encode runs on a worker.
+	const TArray<FActorSnapshot> Actors = MakeSnapshots(50000);
+
+	const double DomStart = FPlatformTime::Seconds();
+	const FString Dom = EncodeWithDom(Actors);
+	const double DomSec = FPlatformTime::Seconds() - DomStart;
+
+	const double CopyStart = FPlatformTime::Seconds();
+	const TArray<FActorSnapshot> Copy = Actors;
+	const double CopySec = FPlatformTime::Seconds() - CopyStart;
+
+	const double EncodeStart = FPlatformTime::Seconds();
+	TSharedRef<FJsonObject> Envelope = MakeShared<FJsonObject>();
+	Envelope->SetNumberField(TEXT("count"), Copy.Num());
+	const FString Encoded = NovaBridgeCore::ComposeJsonBody(Envelope, TEXT("actors"), NovaBridgeCore::EncodeActorSnapshotsJson(Copy, ESceneField::Default));
+	const double EncodeSec = FPlatformTime::Seconds() - EncodeStart;
+
+	AddInfo(FString::Printf(TEXT("DOM on game thread: %.1f ms, %d chars"), DomSec * 1000.0, Dom.Len()));
+	AddInfo(FString::Printf(TEXT("Snapshot copy: %.1f ms; parallel encode off-thread: %.1f ms, %d chars"),
+		CopySec * 1000.0, EncodeSec * 1000.0, Encoded.Len()));
+	TestTrue(TEXT("Condensed output is smaller than the pretty DOM output"), Encoded.Len() < Dom.Len());
+	TestTrue(TEXT("The game-thread copy is cheaper than building the DOM"), CopySec < DomSec);
+	return true;
+}
+
+#endif
@@ -0,0 +1,117 @@
+#include "NovaBridgeTaskLanes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeTaskLanesOrder,
+	"NovaBridge.Core.TaskLanes.Order",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeTaskLanesOrder::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::ETaskLane;
+	NovaBridgeCore::FTaskLaneQueue Lanes;
+	double Now = 0.0;
+	auto Clock = [&Now]() { return Now; };
+
+	FString Order;
+	Lanes.Enqueue(ETaskLane::Heavy, [&Order]() { Order += TEXT("H"); });
+	Lanes.Enqueue(ETaskLane::Mutating, [&Order]() { Order += TEXT("M"); });
+	Lanes.Enqueue(ETaskLane::Interactive, [&Order]() { Order += TEXT("I"); });
+	Lanes.Enqueue(ETaskLane::Interactive, [&Order, &Lanes]()
+	{
+		Order += TEXT("i");
+		Lanes.Enqueue(ETaskLane::Interactive, [&Order]() { Order += TEXT("n"); });
+	});
+	TestEqual(TEXT("Depth counts queued tasks"), Lanes.GetStats(ETaskLane::Interactive).Depth, 2);
+
+	TestEqual(TEXT("One drain runs every queued lane"), Lanes.Drain(Clock), 4);
+	TestEqual(TEXT("Lanes run by priority, FIFO within a lane"), Order, FString(TEXT("IiMH")));
+	TestEqual(TEXT("Tasks queued during a drain wait for the next one"), Lanes.GetStats(ETaskLane::Interactive).Depth, 1);
+	Lanes.Drain(Clock);
+	TestEqual(TEXT("The next drain runs them"), Order, FString(TEXT("IiMHn")));
+
+	TestTrue(TEXT("Control routes share the interactive lane"), NovaBridgeCore::TaskLaneForRouteClass(NovaBridgeCore::ERouteClass::Control) == ETaskLane::Interactive);
+	TestTrue(TEXT("Writes map to the mutating lane"), NovaBridgeCore::TaskLaneForRouteClass(NovaBridgeCore::ERouteClass::Write) == ETaskLane::Mutating);
+	TestTrue(TEXT("Heavy routes map to the heavy lane"), NovaBridgeCore::TaskLaneForRouteClass(NovaBridgeCore::ERouteClass::Heavy) == ETaskLane::Heavy);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeTaskLanesBudget,
+	"NovaBridge.Core.TaskLanes.Budget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeTaskLanesBudget::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::ETaskLane;
+	NovaBridgeCore::FTaskLaneQueue Lanes;
+	Lanes.SetBudgetMs(ETaskLane::Heavy, 4.0);
+	double Now = 0.0;
+	auto Clock = [&Now]() { return Now; };
+
+	// Each heavy task takes 10ms, over the whole budget; each read takes 1ms.
+	int32 HeavyRan = 0;
+	int32 ReadsRan = 0;
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		Lanes.Enqueue(ETaskLane::Heavy, [&Now, &HeavyRan]() { Now += 0.010; ++HeavyRan; });
+		Lanes.Enqueue(ETaskLane::Interactive, [&Now, &ReadsRan]() { Now += 0.001; ++ReadsRan; });
+	}
+
+	Lanes.Drain(Clock);
+	TestEqual(TEXT("An unbudgeted lane runs everything queued"), ReadsRan, 3);
+	TestEqual(TEXT("A budgeted lane still runs one task"), HeavyRan, 1);
+	TestEqual(TEXT("Hitting the budget is counted"), Lanes.GetStats(ETaskLane::Heavy).Deferred, static_cast<uint64>(1));
+
+	Lanes.Drain(Clock);
+	Lanes.Drain(Clock);
+	TestEqual(TEXT("Deferred tasks run on later drains"), HeavyRan, 3);
+	TestEqual(TEXT("Runs are counted per lane"), Lanes.GetStats(ETaskLane::Heavy).Ran, static_cast<uint64>(3));
+	TestEqual(TEXT("Peak depth is kept"), Lanes.GetStats(ETaskLane::Heavy).PeakDepth, 3);
+	TestEqual(TEXT("The lane is empty"), Lanes.GetStats(ETaskLane::Heavy).Depth, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeTaskLanesNextDrain,
+	"NovaBridge.Core.TaskLanes.NextDrain",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeTaskLanesNextDrain::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	using NovaBridgeCore::ETaskLane;
+	NovaBridgeCore::FTaskLaneQueue Lanes;
+	double Now = 0.0;
+	auto Clock = [&Now]() { return Now; };
+
+	// A heavy lane that has not had its turn yet would otherwise pick the continuation up in the same drain.
+	FString Order;
+	Lanes.Enqueue(ETaskLane::Interactive, [&Order, &Lanes]()
+	{
+		Order += TEXT("I");
+		Lanes.EnqueueNextDrain(ETaskLane::Heavy, [&Order]() { Order += TEXT("c"); });
+		Lanes.Enqueue(ETaskLane::Heavy, [&Order]() { Order += TEXT("h"); });
+	});
+	TestEqual(TEXT("Only the interactive task runs"), Lanes.Drain(Clock), 1);
+	TestEqual(TEXT("A continuation never runs in the drain that queued it"), Order, FString(TEXT("I")));
+	TestEqual(TEXT("Tasks behind it keep their place"), Lanes.GetStats(ETaskLane::Heavy).Depth, 2);
+	TestEqual(TEXT("Waiting for the next drain is not a budget deferral"), Lanes.GetStats(ETaskLane::Heavy).Deferred, static_cast<uint64>(0));
+
+	Lanes.Drain(Clock);
+	TestEqual(TEXT("The next drain runs it, in FIFO order"), Order, FString(TEXT("Ich")));
+
+	// Queued between drains, it waits for the next one only.
+	Lanes.EnqueueNextDrain(ETaskLane::Mutating, [&Order]() { Order += TEXT("m"); });
+	Lanes.Drain(Clock);
+	TestEqual(TEXT("Between drains the next drain runs it"), Order, FString(TEXT("Ichm")));
+	TestEqual(TEXT("Continuations are counted as lane runs"), Lanes.GetStats(ETaskLane::Mutating).Ran, static_cast<uint64>(1));
+	return true;
+}
+
+#endif
@@ -0,0 +1,155 @@
+#include "NovaBridgeTransformBatch.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#include <limits>
+
+namespace
+{
+using NovaBridgeCore::ETransformField;
+using NovaBridgeCore::FTransformUpdate;
+
+// Props on a ring, the shape an external simulation would stream every frame.
+TArray<FTransformUpdate> MakeRingUpdates(int32 Count)
+{
+	TArray<FTransformUpdate> Updates;
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		FTransformUpdate& Update = Updates.AddDefaulted_GetRef();
+		Update.Name = FString::Printf(TEXT("Prop_%d"), Index);
+		Update.Fields = Index % 4 == 0 ? ETransformField::All : ETransformField::Location | ETransformField::Rotation;
+		const float Angle = 2.0f * PI * Index / Count;
+		Update.Location = FVector(FMath::Cos(Angle) * 1000.0f, FMath::Sin(Angle) * 1000.0f, 50.0f);
+		Update.Rotation = FRotator(0.0f, FMath::RadiansToDegrees(Angle), 0.0f);
+		Update.Scale = FVector(1.5f);
+	}
+	return Updates;
+}
+
+FString MakeUpdatesJson(const TArray<FTransformUpdate>& Updates)
+{
+	FString Json = TEXT("{\"updates\":[");
+	for (int32 Index = 0; Index < Updates.Num(); ++Index)
+	{
+		const FTransformUpdate& Update = Updates[Index];
+		Json += FString::Printf(TEXT("%s{\"name\":\"%s\",\"location\":[%.9g,%.9g,%.9g],\"rotation\":{\"pitch\":%.9g,\"yaw\":%.9g,\"roll\":%.9g}"),
+			Index > 0 ? TEXT(",") : TEXT(""), *Update.Name, Update.Location.X, Update.Location.Y, Update.Location.Z,
+			Update.Rotation.Pitch, Update.Rotation.Yaw, Update.Rotation.Roll);
+		if (EnumHasAnyFlags(Update.Fields, ETransformField::Scale))
+		{
+			Json += FString::Printf(TEXT(",\"scale\":[%.9g,%.9g,%.9g]"), Update.Scale.X, Update.Scale.Y, Update.Scale.Z);
+		}
+		Json += TEXT("}");
+	}
+	Json += TEXT("]}");
+	return Json;
+}
+
+bool ParseUpdatesJson(const FString& Json, TArray<FTransformUpdate>& OutUpdates, FString& OutError)
+{
+	TSharedPtr<FJsonObject> Body;
+	return FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Body) && Body.IsValid()
+		&& NovaBridgeCore::ParseTransformBatchJson(*Body, OutUpdates, OutError);
+}
+
+bool SameUpdates(const TArray<FTransformUpdate>& A, const TArray<FTransformUpdate>& B)
+{
+	if (A.Num() != B.Num())
+	{
+		return false;
+	}
+	for (int32 Index = 0; Index < A.Num(); ++Index)
+	{
+		const bool bScale = EnumHasAnyFlags(A[Index].Fields, ETransformField::Scale);
+		if (A[Index].Name != B[Index].Name || A[Index].Fields != B[Index].Fields
+			|| !A[Index].Location.Equals(B[Index].Location, 1e-3) || !A[Index].Rotation.Equals(B[Index].Rotation, 1e-3)
+			|| (bScale && !A[Index].Scale.Equals(B[Index].Scale, 1e-3)))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeTransformBatchFormats,
+	"NovaBridge.Core.TransformBatch.Formats",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeTransformBatchFormats::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	TArray<FTransformUpdate> Updates = MakeRingUpdates(16);
+	Updates[3].Name = TEXT("T\u00FCr_\u00C4");
+	FString Error;
+
+	const TArray<uint8> Binary = NovaBridgeCore::EncodeTransformBatchBinary(Updates);
+	TArray<FTransformUpdate> FromBinary;
+	TestTrue(TEXT("Binary batch parses"), NovaBridgeCore::ParseTransformBatchBinary(Binary.GetData(), Binary.Num(), FromBinary, Error));
+	TestTrue(TEXT("Binary batch round-trips, including UTF-8 names"), SameUpdates(Updates, FromBinary));
+	TestFalse(TEXT("Truncated binary batches are rejected"), NovaBridgeCore::ParseTransformBatchBinary(Binary.GetData(), Binary.Num() - 1, FromBinary, Error));
+
+	TArray<uint8> Trailing = Binary;
+	Trailing.Add(0);
+	TestFalse(TEXT("Trailing bytes are rejected"), NovaBridgeCore::ParseTransformBatchBinary(Trailing.GetData(), Trailing.Num(), FromBinary, Error));
+
+	TArray<FTransformUpdate> Bad = Updates;
+	Bad[5].Location.Y = std::numeric_limits<double>::quiet_NaN();
+	const TArray<uint8> NonFinite = NovaBridgeCore::EncodeTransformBatchBinary(Bad);
+	TestFalse(TEXT("Non-finite values are rejected"), NovaBridgeCore::ParseTransformBatchBinary(NonFinite.GetData(), NonFinite.Num(), FromBinary, Error));
+
+	TArray<FTransformUpdate> FromJson;
+	TestTrue(TEXT("JSON batch parses"), ParseUpdatesJson(MakeUpdatesJson(Updates), FromJson, Error));
+	TestTrue(TEXT("JSON batch matches the binary batch"), SameUpdates(Updates, FromJson));
+	TestTrue(TEXT("Omitted components are not applied"), FromJson[1].Fields == (ETransformField::Location | ETransformField::Rotation));
+
+	TestFalse(TEXT("Empty batches are rejected"), ParseUpdatesJson(TEXT("{\"updates\":[]}"), FromJson, Error));
+	TestFalse(TEXT("Updates without a name are rejected"), ParseUpdatesJson(TEXT("{\"updates\":[{\"location\":[0,0,0]}]}"), FromJson, Error));
+	TestFalse(TEXT("Updates without components are rejected"), ParseUpdatesJson(TEXT("{\"updates\":[{\"name\":\"Cube\"}]}"), FromJson, Error));
+	TestFalse(TEXT("Malformed vectors are rejected"), ParseUpdatesJson(TEXT("{\"updates\":[{\"name\":\"Cube\",\"scale\":[1,2]}]}"), FromJson, Error));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNovaBridgeTransformBatchParseBenchmark,
+	"NovaBridge.Core.TransformBatch.ParseBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FNovaBridgeTransformBatchParseBenchmark::RunTest(const FString& Parameters)
+{
+	(void)Parameters;
+	// One frame of a 2000-prop simulation. Applying it is engine work measured by the route itself
+	// (updates_per_sec in the response); this covers everything before the game thread.
+	const TArray<FTransformUpdate> Updates = MakeRingUpdates(2000);
+	const FString Json = MakeUpdatesJson(Updates);
+	const TArray<uint8> Binary = NovaBridgeCore::EncodeTransformBatchBinary(Updates);
+	FString Error;
+
+	const double JsonStart = FPlatformTime::Seconds();
+	TArray<FTransformUpdate> FromJson;
+	const bool bJsonOk = ParseUpdatesJson(Json, FromJson, Error);
+	const double JsonSec = FPlatformTime::Seconds() - JsonStart;
+
+	const double BinaryStart = FPlatformTime::Seconds();
+	TArray<FTransformUpdate> FromBinary;
+	const bool bBinaryOk = NovaBridgeCore::ParseTransformBatchBinary(Binary.GetData(), Binary.Num(), FromBinary, Error);
+	const double BinarySec = FPlatformTime::Seconds() - BinaryStart;
+
+	TestTrue(TEXT("JSON batch parses"), bJsonOk);
+	TestTrue(TEXT("Binary batch parses"), bBinaryOk);
+	AddInfo(FString::Printf(TEXT("JSON: %d updates, %d bytes in %.2f ms (%.0f updates/s)"),
+		Updates.Num(), Json.Len(), JsonSec * 1000.0, Updates.Num() / FMath::Max(JsonSec, 1e-9)));
+	AddInfo(FString::Printf(TEXT("Binary: %d updates, %d bytes in %.2f ms (%.0f updates/s)"),
+		Updates.Num(), Binary.Num(), BinarySec * 1000.0, Updates.Num() / FMath::Max(BinarySec, 1e-9)));
+	TestTrue(TEXT("Binary batches are smaller than JSON"), Binary.Num() < Json.Len());
+	return true;
+}
+
+#endif
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace NovaBridgeCore
+{
+// Name -> handles and label -> handles lookup backing the editor and runtime actor indexes.
+// Keys compare case-insensitively, matching the FString/FName equality the old linear scans used.
+// Not thread-safe; owners keep it on the game thread.
+template <typename HandleType>
+class TActorLookupIndex
+{
+public:
+	using FBucket = TArray<HandleType, TInlineAllocator<1>>;
+
+	void Reset()
+	{
+		ByName.Reset();
+		ByLabel.Reset();
+		Entries.Reset();
+	}
+
+	int32 Num() const
+	{
+		return Entries.Num();
+	}
+
+	void Add(const HandleType& Handle, const FName& Name, const FString& Label)
+	{
+		Remove(Handle);
+		Entries.Add(Handle, FEntry { Name, Label });
+		ByName.FindOrAdd(Name).AddUnique(Handle);
+		if (!Label.IsEmpty())
+		{
+			ByLabel.FindOrAdd(Label).AddUnique(Handle);
+		}
+	}
+
+	void Remove(const HandleType& Handle)
+	{
+		FEntry Entry;
+		if (!Entries.RemoveAndCopyValue(Handle, Entry))
+		{
+			return;
+		}
+		RemoveFromBucket(ByName, Entry.Name, Handle);
+		if (!Entry.Label.IsEmpty())
+		{
+			RemoveFromBucket(ByLabel, Entry.Label, Handle);
+		}
+	}
+
+	void Relabel(const HandleType& Handle, const FString& NewLabel)
+	{
+		FEntry* Entry = Entries.Find(Handle);
+		if (!Entry || Entry->Label.Equals(NewLabel, ESearchCase::CaseSensitive))
+		{
+			return;
+		}
+		if (!Entry->Label.IsEmpty())
+		{
+			RemoveFromBucket(ByLabel, Entry->Label, Handle);
+		}
+		Entry->Label = NewLabel;
+		if (!NewLabel.IsEmpty())
+		{
+			ByLabel.FindOrAdd(NewLabel).AddUnique(Handle);
+		}
+	}
+
+	const FBucket* FindByName(const FName& Name) const
+	{
+		return Name.IsNone() ? nullptr : ByName.Find(Name);
+	}
+
+	const FBucket* FindByLabel(const FString& Label) const
+	{
+		return Label.IsEmpty() ? nullptr : ByLabel.Find(Label);
+	}
+
+private:
+	struct FEntry
+	{
+		FName Name;
+		FString Label;
+	};
+
+	template <typename KeyType>
+	static void RemoveFromBucket(TMap<KeyType, FBucket>& Map, const KeyType& Key, const HandleType& Handle)
+	{
+		if (FBucket* Bucket = Map.Find(Key))
+		{
+			Bucket->RemoveSingle(Handle);
+			if (Bucket->Num() == 0)
+			{
+				Map.Remove(Key);
+			}
+		}
+	}
+
+	TMap<FName, FBucket> ByName;
+	TMap<FString, FBucket> ByLabel;
+	TMap<HandleType, FEntry> Entries;
+};
+} // namespace NovaBridgeCore
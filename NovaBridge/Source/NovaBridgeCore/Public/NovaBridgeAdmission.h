@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HttpResultCallback.h"
+
+#include <atomic>
+
+namespace NovaBridgeCore
+{
+// Every route belongs to one admission class, fixed at bind time.
+enum class ERouteClass : uint8
+{
+	// Health, caps, metrics and other introspection; counted but never rejected.
+	Control,
+	// Read-only routes that do a short game-thread pass.
+	Read,
+	// Routes that change the editor state.
+	Write,
+	// Captures, renders, builds, imports and plans: long game-thread or GPU work.
+	Heavy,
+};
+
+constexpr int32 RouteClassCount = 4;
+constexpr int32 DefaultAdmissionMaxInFlight = 64;
+constexpr int32 DefaultAdmissionMaxHeavyInFlight = 4;
+constexpr int32 DefaultAdmissionMaxWaitMs = 5000;
+
+NOVABRIDGECORE_API const TCHAR* RouteClassToString(ERouteClass Class);
+
+// A limit of 0 turns that check off.
+struct FAdmissionLimits
+{
+	int32 MaxInFlight = 0;
+	int32 MaxEstimatedWaitMs = 0;
+};
+
+struct FAdmissionDecision
+{
+	bool bAdmitted = true;
+	ERouteClass Class = ERouteClass::Control;
+	// Requests of the class already admitted and not yet answered.
+	int32 InFlight = 0;
+	int32 EstimatedWaitMs = 0;
+	// Set when rejected: the estimated wait rounded up to whole seconds, at least 1.
+	int32 RetryAfterSeconds = 0;
+};
+
+struct FAdmissionStats
+{
+	int32 InFlight = 0;
+	int32 PeakInFlight = 0;
+	int64 Admitted = 0;
+	int64 Rejected = 0;
+	int32 EstimatedWaitMs = 0;
+	uint64 AverageServiceUs = 0;
+	FAdmissionLimits Limits;
+};
+
+// Counts requests per class from admission until their response is sent, and keeps a moving average of
+// how long one request holds its slot. The wait estimate for a new request is the in-flight count times
+// that average. Admission and release are lock-free.
+class NOVABRIDGECORE_API FAdmissionController
+{
+public:
+	void Configure(ERouteClass Class, const FAdmissionLimits& Limits);
+	FAdmissionDecision TryAdmit(ERouteClass Class);
+	void Release(ERouteClass Class, double HeldSec);
+	FAdmissionStats GetStats(ERouteClass Class) const;
+
+	// Clears counters and averages; limits and in-flight counts are kept.
+	void ResetStats();
+
+private:
+	struct FClassState
+	{
+		std::atomic<int32> MaxInFlight { 0 };
+		std::atomic<int32> MaxEstimatedWaitMs { 0 };
+		std::atomic<int32> InFlight { 0 };
+		std::atomic<int32> PeakInFlight { 0 };
+		std::atomic<int64> Admitted { 0 };
+		std::atomic<int64> Rejected { 0 };
+		std::atomic<uint64> AverageServiceUs { 0 };
+	};
+
+	FClassState Classes[RouteClassCount];
+};
+
+// Releases the slot TryAdmit took when a response goes through the returned callback, or when the last
+// copy of the callback is destroyed without one.
+NOVABRIDGECORE_API FHttpResultCallback WrapResultCallbackWithAdmission(FAdmissionController& Controller, ERouteClass Class, const FHttpResultCallback& OnComplete);
+
+// Adds Retry-After (when rejected) and X-NovaBridge-Queue-Depth to every response sent through the returned callback.
+NOVABRIDGECORE_API FHttpResultCallback WrapResultCallbackWithAdmissionHeaders(const FAdmissionDecision& Decision, const FHttpResultCallback& OnComplete);
+} // namespace NovaBridgeCore
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HttpServerRequest.h"
+
+class FJsonObject;
+
+namespace NovaBridgeCore
+{
+constexpr int32 BatchMaxRequests = 50;
+
+struct FBatchSubRequest
+{
+	FString Route;
+	EHttpServerRequestVerbs Verb = EHttpServerRequestVerbs::VERB_GET;
+	TMap<FString, FString> QueryParams;
+	// UTF-8 JSON, empty when the entry has no body.
+	TArray<uint8> Body;
+};
+
+struct FBatchResult
+{
+	FString Route;
+	EHttpServerRequestVerbs Verb = EHttpServerRequestVerbs::VERB_GET;
+	int32 Status = 0;
+	FString ContentType;
+	TArray<uint8> Body;
+};
+
+// {"requests":[{"route":"/nova/...","method":"GET|POST","query":{...},"body":{...}}],"stop_on_error":false}
+// Method defaults to POST when a body is given and GET otherwise; query values must be strings or numbers.
+NOVABRIDGECORE_API bool ParseBatchRequest(const FJsonObject& Body, TArray<FBatchSubRequest>& OutRequests, bool& bOutStopOnError, FString& OutError);
+
+// {"status":"ok","requested":N,"completed":M,"results":[{"route","method","status","body"}...]}. JSON bodies are
+// spliced in as-is; anything else is base64 in "body_base64" alongside its "content_type".
+NOVABRIDGECORE_API FString ComposeBatchResponseJson(TConstArrayView<FBatchResult> Results, int32 Requested);
+} // namespace NovaBridgeCore
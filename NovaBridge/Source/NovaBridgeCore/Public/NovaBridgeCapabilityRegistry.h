@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
 
+#include <atomic>
+
 namespace NovaBridgeCore
 {
 struct NOVABRIDGECORE_API FCapabilityRecord
@@ -20,10 +22,13 @@ public:
 	void Reset();
 	void RegisterCapability(const FCapabilityRecord& Capability);
 	TArray<FCapabilityRecord> Snapshot() const;
+	// Bumped by every Reset and RegisterCapability; safe to read from any thread.
+	uint64 GetVersion() const;
 
 private:
 	mutable FCriticalSection Mutex;
 	TArray<FCapabilityRecord> Capabilities;
+	std::atomic<uint64> Version { 0 };
 };
 
 NOVABRIDGECORE_API TSharedPtr<FJsonObject> CapabilityToJson(const FCapabilityRecord& Capability);
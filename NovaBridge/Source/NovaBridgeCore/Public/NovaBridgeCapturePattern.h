@@ -0,0 +1,10 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace NovaBridgeCore
+{
+// Deterministic gradient delivered instead of a capture when rendering is unavailable (-nullrhi), so callers
+// can still validate sizes and encoding. Red follows X, green follows Y, blue is a 32-pixel checker.
+NOVABRIDGECORE_API void FillSoftwareCapturePattern(int32 Width, int32 Height, TArray<FColor>& OutPixels);
+} // namespace NovaBridgeCore
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+struct FHttpServerRequest;
+
+namespace NovaBridgeCore
+{
+constexpr int32 MaxRequestDeadlineMs = 60 * 60 * 1000;
+// Applied to read routes and screenshots that do not send X-NovaBridge-Deadline.
+constexpr int32 DefaultReadDeadlineMs = 30 * 1000;
+
+// X-NovaBridge-Deadline: whole milliseconds the client will wait, counted from when the server reads the
+// request. Returns 0 (no deadline) when the header is absent, not a positive integer, or is over the cap.
+NOVABRIDGECORE_API int32 ParseRequestDeadlineMs(const FHttpServerRequest& Request);
+
+// Shared by a request and the work it starts. Queued work is dropped and long operations stop between
+// steps once the token is cancelled or its deadline has passed. Safe to check from any thread.
+class NOVABRIDGECORE_API FCancellationToken
+{
+public:
+	// DeadlineSec is on the FPlatformTime::Seconds() clock; 0 means no deadline.
+	explicit FCancellationToken(double InDeadlineSec = 0.0)
+		: DeadlineSec(InDeadlineSec)
+	{
+	}
+
+	void Cancel() { bCancelled.store(true, std::memory_order_relaxed); }
+	bool IsCancelled(double NowSec) const
+	{
+		return bCancelled.load(std::memory_order_relaxed) || (DeadlineSec > 0.0 && NowSec >= DeadlineSec);
+	}
+	bool IsCancelled() const;
+	double GetDeadlineSec() const { return DeadlineSec; }
+
+private:
+	double DeadlineSec = 0.0;
+	std::atomic<bool> bCancelled { false };
+};
+
+using FCancellationTokenPtr = TSharedPtr<FCancellationToken, ESPMode::ThreadSafe>;
+} // namespace NovaBridgeCore
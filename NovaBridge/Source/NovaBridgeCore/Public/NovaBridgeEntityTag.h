@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HttpResultCallback.h"
+
+struct FHttpServerRequest;
+
+namespace NovaBridgeCore
+{
+// Everything besides the revision that changes a cacheable response's bytes: path, query string, role,
+// and the Accept / Accept-Encoding headers that pick the compact profile and content coding.
+NOVABRIDGECORE_API uint32 HashRequestVariant(const FHttpServerRequest& Request, const FString& Role);
+
+// Strong validator for a response built at Revision. Tags carry a per-process epoch so counters that
+// restart with the editor never revalidate a body from a previous session.
+NOVABRIDGECORE_API FString MakeRevisionETag(uint64 Revision, uint32 VariantHash);
+
+// If-None-Match check (weak comparison, as RFC 9110 specifies for it): true for "*" or any listed tag.
+NOVABRIDGECORE_API bool MatchesIfNoneMatch(const FHttpServerRequest& Request, const FString& ETag);
+
+NOVABRIDGECORE_API TUniquePtr<FHttpServerResponse> MakeNotModifiedResponse(const FString& ETag);
+
+// Adds the ETag header to 2xx responses sent through the returned callback; errors go out untagged.
+NOVABRIDGECORE_API FHttpResultCallback WrapResultCallbackWithETag(const FString& ETag, const FHttpResultCallback& OnComplete);
+} // namespace NovaBridgeCore
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+namespace NovaBridgeCore
+{
+// Immutable once published; every client send shares the same UTF-8 bytes.
+struct FEventPayload
+{
+	FString Type;
+	TArray<uint8> Utf8;
+};
+
+using FEventPayloadPtr = TSharedPtr<const FEventPayload, ESPMode::ThreadSafe>;
+
+struct FEventRecord
+{
+	uint64 Seq = 0;
+	FEventPayloadPtr Payload;
+};
+
+struct FEventRingStats
+{
+	// HeadSeq is the last sequence number handed out (0 before the first push); TailSeq is the oldest
+	// retained event, or 0 while the ring is empty.
+	uint64 HeadSeq = 0;
+	uint64 TailSeq = 0;
+	uint64 Dropped = 0;
+	int32 Count = 0;
+	int32 Capacity = 0;
+
+	// Events encoded, their UTF-8 bytes and the socket sends made from them. Each event is encoded once no
+	// matter how many clients receive it.
+	uint64 EncodedEvents = 0;
+	uint64 PayloadBytes = 0;
+	uint64 FanoutSends = 0;
+};
+
+// Fixed-capacity event ring. Sequence numbers start at 1 and are never reused, even across Reset(); once
+// full, each push overwrites the oldest event and counts it as dropped. All methods are thread-safe.
+class NOVABRIDGECORE_API FEventRing
+{
+public:
+	explicit FEventRing(int32 InCapacity);
+
+	// BuildPayload runs under the ring lock so payloads can embed their own sequence number in order.
+	// The JSON is transcoded to UTF-8 exactly once, here.
+	uint64 Push(const FString& Type, TFunctionRef<FString(uint64 Seq)> BuildPayload);
+	void RecordFanoutSends(uint64 Sends);
+
+	// Appends events with Seq > AfterSeq, oldest first. Returns false when events after AfterSeq were
+	// already overwritten, i.e. the caller cannot replay without a gap.
+	bool CopySince(uint64 AfterSeq, TArray<FEventRecord>& OutEvents) const;
+	bool CanReplayFrom(uint64 AfterSeq) const;
+	void CopyTypesSince(uint64 AfterSeq, TArray<FString>& OutTypes) const;
+
+	FEventRingStats GetStats() const;
+	void Reset();
+
+private:
+	uint64 TailSeqLocked() const;
+
+	mutable FCriticalSection Mutex;
+	TArray<FEventRecord> Slots;
+	uint64 NextSeq = 1;
+	uint64 Dropped = 0;
+	int32 Count = 0;
+	uint64 EncodedEvents = 0;
+	uint64 PayloadBytes = 0;
+	std::atomic<uint64> FanoutSends { 0 };
+};
+} // namespace NovaBridgeCore
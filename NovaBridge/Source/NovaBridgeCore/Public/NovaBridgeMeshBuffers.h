@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+namespace NovaBridgeCore
+{
+// Packed mesh streams shared by every /nova/mesh/create body format. Normals and UVs are either empty or
+// hold one entry per position; Indices holds three entries per triangle.
+struct FMeshBuffers
+{
+	TArray<FVector3f> Positions;
+	TArray<FVector3f> Normals;
+	TArray<FVector2f> UVs;
+	TArray<uint32> Indices;
+
+	int32 NumVertices() const { return Positions.Num(); }
+	int32 NumTriangles() const { return Indices.Num() / 3; }
+};
+
+// Binary body layout, all little-endian:
+//   char[4] "NBMS", uint32 version, uint32 flags, uint32 vertex_count, uint32 index_count,
+//   float32[3 * vertex_count] positions, float32[3 * vertex_count] normals (flag 1),
+//   float32[2 * vertex_count] uvs (flag 2), uint32[index_count] indices.
+constexpr uint32 MeshBinaryVersion = 1;
+constexpr uint32 MeshBinaryHeaderSize = 20;
+constexpr uint32 MeshBinaryFlagNormals = 1u << 0;
+constexpr uint32 MeshBinaryFlagUVs = 1u << 1;
+constexpr int32 MaxMeshVertices = 16 * 1024 * 1024;
+constexpr int32 MaxMeshIndices = 3 * MaxMeshVertices;
+
+NOVABRIDGECORE_API bool ParseMeshBinary(const uint8* Data, int64 Size, FMeshBuffers& OutMesh, FString& OutError);
+
+// Accepts either base64 streams ("positions", "normals", "uvs", "indices" as strings holding the binary
+// stream bytes) or the legacy "vertices"/"triangles" object arrays.
+NOVABRIDGECORE_API bool ParseMeshJson(const FJsonObject& Body, FMeshBuffers& OutMesh, FString& OutError);
+
+// Stream lengths agree, every index is in range and every float is finite.
+NOVABRIDGECORE_API bool ValidateMeshBuffers(const FMeshBuffers& Mesh, FString& OutError);
+
+NOVABRIDGECORE_API TArray<uint8> EncodeMeshBinary(const FMeshBuffers& Mesh);
+} // namespace NovaBridgeCore
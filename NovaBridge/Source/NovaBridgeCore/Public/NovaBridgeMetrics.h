@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+namespace NovaBridgeCore
+{
+// Log-linear (HDR-style) histogram: 8 sub-buckets per power of two, ~12.5% worst-case relative error.
+// Record() is lock-free and safe to call from any thread.
+class NOVABRIDGECORE_API FLatencyHistogram
+{
+public:
+	static constexpr int32 SubBucketBits = 3;
+	static constexpr int32 SubBucketCount = 1 << SubBucketBits;
+	static constexpr int32 MaxValueBits = 40;
+	static constexpr int32 BucketCount = (MaxValueBits - SubBucketBits + 1) * SubBucketCount;
+
+	FLatencyHistogram();
+
+	void Record(uint64 Value);
+	void Reset();
+
+	uint64 GetCount() const;
+	uint64 GetSum() const;
+	uint64 GetMax() const;
+	uint64 ValueAtQuantile(double Quantile) const;
+
+	static int32 BucketIndexForValue(uint64 Value);
+	static uint64 BucketUpperBound(int32 BucketIndex);
+
+private:
+	std::atomic<uint64> Buckets[BucketCount];
+	std::atomic<uint64> Count;
+	std::atomic<uint64> Sum;
+	std::atomic<uint64> Max;
+};
+
+struct NOVABRIDGECORE_API FRouteMetrics
+{
+	FString Route;
+	FLatencyHistogram CheckUs;
+	FLatencyHistogram QueueWaitUs;
+	FLatencyHistogram HandlerUs;
+	FLatencyHistogram SerializeUs;
+	FLatencyHistogram ResponseBytes;
+	// Only responses that went through compression; the ratio is compressed over original size, in 1/1000ths.
+	FLatencyHistogram CompressUs;
+	FLatencyHistogram CompressionRatioPermille;
+	std::atomic<uint64> Responses2xx { 0 };
+	std::atomic<uint64> Responses3xx { 0 };
+	std::atomic<uint64> Responses4xx { 0 };
+	std::atomic<uint64> Responses5xx { 0 };
+	// Work abandoned once the request's deadline passed: queued game-thread tasks dropped before they ran, and
+	// long operations (plans, renders) stopped part way.
+	std::atomic<uint64> DroppedExpired { 0 };
+	std::atomic<uint64> Cancelled { 0 };
+
+	void RecordStatus(int32 StatusCode);
+	// Zeroes every histogram and counter in place. Racing Record() calls may survive the reset.
+	void Reset();
+};
+
+// Routes register once at bind time; the returned pointer stays valid for the registry's lifetime, since
+// request timings on other threads hold it without a lock.
+class NOVABRIDGECORE_API FRouteMetricsRegistry
+{
+public:
+	static FRouteMetricsRegistry& Get();
+
+	// Zeroes every route's metrics; routes stay registered and their pointers stay valid.
+	void Reset();
+	FRouteMetrics* RegisterRoute(const FString& Route);
+	FString BuildPrometheusText(const FString& MetricPrefix) const;
+
+private:
+	mutable FCriticalSection Mutex;
+	TArray<TUniquePtr<FRouteMetrics>> Routes;
+};
+} // namespace NovaBridgeCore
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NovaBridgeMeshBuffers.h"
+
+namespace NovaBridgeCore
+{
+struct FModelImportStats
+{
+	int32 SourcePositions = 0;
+	int32 SourceFaces = 0;
+	int32 ParseChunks = 0;
+	bool bMemoryMapped = false;
+};
+
+constexpr int64 DefaultObjChunkBytes = 1024 * 1024;
+
+// OBJ: chunks split at line boundaries are tokenized in parallel, then faces are fan-triangulated into one
+// vertex per corner. Positions are scaled and mirrored on Y, UVs flipped on V, and corners without a
+// normal get +Z, matching the original editor importer.
+NOVABRIDGECORE_API bool ParseObjMesh(const uint8* Data, int64 Size, float Scale, FMeshBuffers& OutMesh, FModelImportStats& OutStats, FString& OutError, int64 ChunkBytes = DefaultObjChunkBytes);
+
+// Binary glTF 2.0: every triangle primitive in the embedded BIN chunk is merged into one mesh, converted
+// from Y-up right-handed to Z-up left-handed and scaled. Node transforms are not applied.
+NOVABRIDGECORE_API bool ParseGlbMesh(const uint8* Data, int64 Size, float Scale, FMeshBuffers& OutMesh, FModelImportStats& OutStats, FString& OutError);
+
+// Memory-maps FilePath (falling back to a plain read) and dispatches on the .obj/.glb extension.
+NOVABRIDGECORE_API bool ImportMeshFile(const FString& FilePath, float Scale, FMeshBuffers& OutMesh, FModelImportStats& OutStats, FString& OutError);
+} // namespace NovaBridgeCore
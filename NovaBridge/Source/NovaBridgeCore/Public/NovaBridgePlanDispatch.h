@@ -26,6 +26,41 @@ private:
 	TMap<FString, FPlanCommandHandler> Handlers;
 };
 
+// Resumable step cursor for time-sliced plans. Each RunSlice() call runs at least one step, then keeps going
+// until the frame budget is spent; the caller reschedules until IsFinished(). A budget <= 0 runs everything.
+class NOVABRIDGECORE_API FPlanSliceRunner
+{
+public:
+	FPlanSliceRunner(int32 InStepCount, double InFrameBudgetMs);
+
+	// Clock returns seconds; it is injectable so tests do not depend on wall time.
+	void RunSlice(TFunctionRef<void(int32 StepIndex)> RunStep, TFunctionRef<double()> Clock);
+	bool IsFinished() const { return bCancelled || NextStep >= StepCount; }
+	// Stops the plan after the step that is running; later slices do nothing.
+	void Cancel() { bCancelled = true; }
+	bool IsCancelled() const { return bCancelled; }
+	int32 GetNextStep() const { return NextStep; }
+	int32 GetSliceCount() const { return SliceCount; }
+	double GetFrameBudgetMs() const { return FrameBudgetMs; }
+	double GetLongestSliceMs() const { return LongestSliceMs; }
+
+private:
+	int32 StepCount = 0;
+	int32 NextStep = 0;
+	int32 SliceCount = 0;
+	double FrameBudgetMs = 0.0;
+	double LongestSliceMs = 0.0;
+	bool bCancelled = false;
+};
+
+constexpr double MinRequestedPlanFrameBudgetMs = 1.0;
+constexpr double DefaultMaxRequestedPlanFrameBudgetMs = 33.0;
+
+// Budget for a plan that sends "frame_budget_ms": clamped to [MinRequestedPlanFrameBudgetMs, MaxMs], so a
+// client can tune slicing but never turn it off. Non-finite values get MaxMs. Only the server's own default
+// may be unbounded.
+NOVABRIDGECORE_API double ClampRequestedPlanFrameBudgetMs(double RequestedMs, double MaxMs);
+
 NOVABRIDGECORE_API FString NormalizePlanAction(const FString& RawAction);
 NOVABRIDGECORE_API TSharedPtr<FJsonObject> MakePlanStepResult(int32 StepIndex, const FString& Status, const FString& Message);
 NOVABRIDGECORE_API bool ExtractPlanStep(
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace NovaBridgeCore
+{
+struct FComponentIdentity
+{
+	FString Name;
+	FString ClassName;
+};
+
+// Lower-case alphanumerics with trailing digits dropped, so "PointLight", "point_light" and
+// "PointLightComponent0" compare by their stems.
+NOVABRIDGECORE_API FString NormalizeComponentKey(const FString& Value);
+
+// Component a "Component.Property" selector refers to: an exact or substring name/class match first,
+// then the normalized fuzzy match. INDEX_NONE when nothing matches.
+NOVABRIDGECORE_API int32 FindComponentForSelector(const FString& Selector, TArrayView<const FComponentIdentity> Components);
+
+constexpr int32 PropertyPathCacheDefaultCapacity = 4096;
+
+// Resolved property paths keyed by (class, path). Paths compare case-insensitively, like the
+// resolution they memoize. Entries hold raw reflection pointers, so owners must Reset() whenever
+// classes can be regenerated in place (blueprint compile, hot reload). Filling past capacity starts
+// over rather than evicting. Not thread-safe; owners keep it on the game thread.
+template <typename ClassType, typename EntryType>
+class TPropertyPathCache
+{
+public:
+	explicit TPropertyPathCache(int32 InCapacity = PropertyPathCacheDefaultCapacity)
+		: Capacity(FMath::Max(1, InCapacity))
+	{
+	}
+
+	const EntryType* Find(const ClassType* Class, const FString& Path)
+	{
+		const EntryType* Entry = Entries.Find(FKey(Class, Path));
+		if (Entry)
+		{
+			++Hits;
+		}
+		else
+		{
+			++Misses;
+		}
+		return Entry;
+	}
+
+	void Add(const ClassType* Class, const FString& Path, const EntryType& Entry)
+	{
+		if (Entries.Num() >= Capacity && !Entries.Contains(FKey(Class, Path)))
+		{
+			Entries.Reset();
+		}
+		Entries.Add(FKey(Class, Path), Entry);
+	}
+
+	void Reset()
+	{
+		if (Entries.Num() > 0)
+		{
+			Entries.Reset();
+			++Invalidations;
+		}
+	}
+
+	int32 Num() const
+	{
+		return Entries.Num();
+	}
+
+	uint64 GetHits() const
+	{
+		return Hits;
+	}
+
+	uint64 GetMisses() const
+	{
+		return Misses;
+	}
+
+	uint64 GetInvalidations() const
+	{
+		return Invalidations;
+	}
+
+private:
+	using FKey = TTuple<const ClassType*, FString>;
+
+	TMap<FKey, EntryType> Entries;
+	int32 Capacity = PropertyPathCacheDefaultCapacity;
+	uint64 Hits = 0;
+	uint64 Misses = 0;
+	uint64 Invalidations = 0;
+};
+} // namespace NovaBridgeCore
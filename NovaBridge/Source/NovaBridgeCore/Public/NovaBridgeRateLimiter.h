@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HttpResultCallback.h"
+
+#include <atomic>
+
+namespace NovaBridgeCore
+{
+struct FRateLimitDecision
+{
+	bool bAllowed = false;
+	int32 LimitPerMinute = 0;
+	int32 Remaining = 0;
+	// Seconds until the bucket is full again, and (when denied) until the next token is available.
+	int32 ResetSeconds = 0;
+	int32 RetryAfterSeconds = 0;
+};
+
+// Token buckets indexed by a route id handed out at bind time and a fixed role slot, so the request path
+// never builds or hashes a key. Each bucket is one packed atomic word updated with CAS; nothing on the
+// consume path takes a lock. A bucket holds a quarter of the limit as burst and refills the rest of the
+// minute's allowance evenly, so no 60 second window ever admits more than LimitPerMinute requests.
+class NOVABRIDGECORE_API FTokenBucketRateLimiter
+{
+public:
+	static constexpr int32 MaxRoutes = 256;
+	static constexpr int32 RoleSlotCount = 4;
+
+	FTokenBucketRateLimiter();
+
+	// Idempotent per key; returns INDEX_NONE once MaxRoutes keys are registered.
+	int32 RegisterRoute(const FString& RouteKey);
+
+	// NowSec is any monotonic clock in seconds (FPlatformTime::Seconds() in production).
+	FRateLimitDecision Consume(int32 RouteId, int32 RoleSlot, int32 LimitPerMinute, double NowSec);
+
+	// Refills every bucket; route ids stay valid.
+	void Reset();
+
+	static int32 RoleSlotForName(const FString& NormalizedRole);
+	static int32 BurstForLimit(int32 LimitPerMinute);
+	// Tokens regained per 1001 refill ticks (just over a minute); with the burst it comes to the limit in any
+	// 60 second window.
+	static int32 RefillPerMinuteForLimit(int32 LimitPerMinute);
+
+private:
+	FCriticalSection RegistrationMutex;
+	TArray<FString> RouteKeys;
+	std::atomic<uint64> Buckets[MaxRoutes * RoleSlotCount];
+};
+
+// Adds X-RateLimit-Limit / -Remaining / -Reset (and Retry-After when denied) to every response sent
+// through the returned callback.
+NOVABRIDGECORE_API FHttpResultCallback WrapResultCallbackWithRateLimitHeaders(const FRateLimitDecision& Decision, const FHttpResultCallback& OnComplete);
+} // namespace NovaBridgeCore
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HttpResultCallback.h"
+
+namespace NovaBridgeCore
+{
+struct FRouteMetrics;
+
+enum class EContentEncoding : uint8
+{
+	Identity,
+	Gzip,
+	Deflate,
+};
+
+// Bodies below this many bytes go out as-is; the header and CPU overhead is not worth it.
+constexpr int32 DefaultCompressionMinBytes = 8 * 1024;
+
+// Best supported coding from an Accept-Encoding header, honouring q-values ("q=0" excludes a coding).
+// Prefers gzip over deflate at equal weight; Identity when neither is acceptable.
+NOVABRIDGECORE_API EContentEncoding NegotiateContentEncoding(const FString& AcceptEncoding);
+
+NOVABRIDGECORE_API const TCHAR* GetContentEncodingName(EContentEncoding Encoding);
+
+// gzip, or zlib-wrapped deflate as HTTP's "deflate" expects. False for Identity or on failure.
+NOVABRIDGECORE_API bool CompressResponseBody(EContentEncoding Encoding, TConstArrayView<uint8> Body, TArray<uint8>& OutCompressed);
+
+// Compresses text and JSON bodies of at least MinBytes on a worker thread, then completes the response
+// from the game thread. Responses that are small, already encoded or binary images pass straight through.
+// Every response gets Vary: Accept-Encoding; a MinBytes of 0 or less disables the wrapper entirely.
+// Compression time and ratio are recorded on Metrics when given.
+NOVABRIDGECORE_API FHttpResultCallback WrapResultCallbackWithCompression(EContentEncoding Encoding, int32 MinBytes, FRouteMetrics* Metrics, const FHttpResultCallback& OnComplete);
+} // namespace NovaBridgeCore
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+class FJsonObject;
+struct FHttpServerRequest;
+
+namespace NovaBridgeCore
+{
+constexpr int32 CompactDefaultPrecision = 3;
+constexpr int32 CompactMaxPrecision = 9;
+
+// Opt-in response shape. Full is the documented object form; Compact writes vectors as arrays, numbers
+// with at most Precision decimals and leaves out default-valued fields.
+struct FResponseProfile
+{
+	bool bCompact = false;
+	int32 Precision = CompactDefaultPrecision;
+};
+
+// "profile=compact" (and optional "precision=N") from the query string, or the same parameters on the
+// Accept header, e.g. "Accept: application/json; profile=compact; precision=2".
+NOVABRIDGECORE_API FResponseProfile ParseResponseProfile(const FHttpServerRequest& Request);
+
+// Value rounded to Precision decimals with trailing zeros trimmed ("12.5", "-3", "0"); "null" when not finite.
+NOVABRIDGECORE_API FString FormatCompactNumber(double Value, int32 Precision);
+
+// Streams Object in the compact profile: {x,y,z}, {x,y} and {pitch,yaw,roll} objects become arrays, null
+// and empty-string fields are dropped, as are "rotation" vectors of zeros and "scale" vectors of ones.
+NOVABRIDGECORE_API void WriteCompactJson(TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>& Writer, const FJsonObject& Object, int32 Precision);
+} // namespace NovaBridgeCore
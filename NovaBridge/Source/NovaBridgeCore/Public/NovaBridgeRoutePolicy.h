@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "HttpServerRequest.h"
+#include "NovaBridgeAdmission.h"
+#include "NovaBridgeDeadline.h"
+#include "NovaBridgeRateLimiter.h"
+
+namespace NovaBridgeCore
+{
+enum class ERouteAuditLevel : uint8
+{
+	// Nothing is written to the audit trail by the bind wrapper (handlers may still audit).
+	Quiet,
+	// Auth, permission and rate-limit denials are audited.
+	Denials,
+};
+
+// Everything the bind wrapper needs to admit a request, compiled once per route at bind time. Role bits
+// use FTokenBucketRateLimiter role slots: bit N is set when slot N may call the route.
+struct NOVABRIDGECORE_API FRoutePolicy
+{
+	FString Path;
+	int32 RateRouteId = INDEX_NONE;
+	uint8 ReadRoleMask = 0;
+	uint8 WriteRoleMask = 0;
+	bool bReadOnly = false;
+	ERouteClass RouteClass = ERouteClass::Read;
+	// Used when the request sends no X-NovaBridge-Deadline; 0 means no deadline.
+	int32 DefaultDeadlineMs = 0;
+	ERouteAuditLevel AuditLevel = ERouteAuditLevel::Denials;
+	int32 RateLimitPerMinute[FTokenBucketRateLimiter::RoleSlotCount] = {};
+
+	// GET is checked against ReadRoleMask, every other verb against WriteRoleMask. Reads that take a POST body
+	// are opened to a role by compiling its bit into WriteRoleMask, not here.
+	bool Allows(int32 RoleSlot, EHttpServerRequestVerbs Verb) const
+	{
+		const uint8 Mask = Verb == EHttpServerRequestVerbs::VERB_GET ? ReadRoleMask : WriteRoleMask;
+		return RoleSlot >= 0 && RoleSlot < FTokenBucketRateLimiter::RoleSlotCount && (Mask & (1u << RoleSlot)) != 0;
+	}
+
+	int32 RateLimitFor(int32 RoleSlot) const
+	{
+		return RoleSlot >= 0 && RoleSlot < FTokenBucketRateLimiter::RoleSlotCount ? RateLimitPerMinute[RoleSlot] : 0;
+	}
+};
+
+// Owns compiled route policies. Records are immutable and live as long as the table: re-adding a path
+// allocates a new record and makes it current, while requests still holding the old pointer keep reading
+// the old, unchanged record. Pointers are safe to read from any thread without locking.
+class NOVABRIDGECORE_API FRoutePolicyTable
+{
+public:
+	const FRoutePolicy* Add(const FRoutePolicy& Policy);
+	// The current record for Path.
+	const FRoutePolicy* Find(const FString& Path) const;
+	// Current records, in the order their paths were first added.
+	TArray<const FRoutePolicy*> GetAll() const;
+
+	static const TCHAR* RoleNameForSlot(int32 RoleSlot);
+
+private:
+	mutable FCriticalSection Mutex;
+	TArray<TUniquePtr<FRoutePolicy>> Records;
+	TArray<FString> Paths;
+	TMap<FString, const FRoutePolicy*> CurrentByPath;
+};
+
+NOVABRIDGECORE_API const TCHAR* RouteAuditLevelToString(ERouteAuditLevel Level);
+
+// One object per route as seen by RoleSlot, for /nova/caps.
+NOVABRIDGECORE_API TArray<TSharedPtr<FJsonValue>> MakeRoutePolicyJson(const TArray<const FRoutePolicy*>& Policies, int32 RoleSlot);
+} // namespace NovaBridgeCore
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace NovaBridgeCore
+{
+enum class ESceneChangeKind : uint8
+{
+	Added,
+	Modified,
+	Removed,
+};
+
+inline const TCHAR* SceneChangeKindName(ESceneChangeKind Kind)
+{
+	switch (Kind)
+	{
+	case ESceneChangeKind::Added:
+		return TEXT("added");
+	case ESceneChangeKind::Removed:
+		return TEXT("removed");
+	default:
+		return TEXT("modified");
+	}
+}
+
+constexpr int32 SceneChangeLogDefaultCapacity = 4096;
+
+template <typename HandleType>
+struct TSceneChange
+{
+	uint64 Revision = 0;
+	uint32 Id = 0;
+	FName Name;
+	ESceneChangeKind Kind = ESceneChangeKind::Modified;
+	HandleType Handle;
+};
+
+// Per-world scene revision counter plus a fixed-capacity dirty log. Every recorded change bumps the
+// revision; once the ring wraps, cursors older than the oldest retained change must resync from a full
+// scene/list. Revisions are never reused, even across Reset(), so a cursor from a previous world is
+// always rejected rather than silently replayed. Not thread-safe; owners keep it on the game thread.
+template <typename HandleType>
+class TSceneChangeLog
+{
+public:
+	explicit TSceneChangeLog(int32 InCapacity = SceneChangeLogDefaultCapacity)
+	{
+		Slots.SetNum(FMath::Max(1, InCapacity));
+	}
+
+	uint64 GetRevision() const
+	{
+		return Revision;
+	}
+
+	// Oldest cursor that can still be answered without a resync.
+	uint64 GetFloorRevision() const
+	{
+		return FloorRevision;
+	}
+
+	uint64 Record(ESceneChangeKind Kind, uint32 Id, const FName& Name, const HandleType& Handle)
+	{
+		++Revision;
+
+		// Drags and property edits fire once per tick; fold repeats of the newest entry in place so a
+		// single moving actor cannot wrap the ring.
+		if (Count > 0 && Kind == ESceneChangeKind::Modified)
+		{
+			TSceneChange<HandleType>& Newest = Slots[SlotIndex(Count - 1)];
+			if (Newest.Id == Id && Newest.Kind != ESceneChangeKind::Removed)
+			{
+				Newest.Revision = Revision;
+				return Revision;
+			}
+		}
+
+		if (Count == Slots.Num())
+		{
+			FloorRevision = Slots[Head].Revision;
+			Head = (Head + 1) % Slots.Num();
+			--Count;
+		}
+		Slots[SlotIndex(Count)] = TSceneChange<HandleType> { Revision, Id, Name, Kind, Handle };
+		++Count;
+		return Revision;
+	}
+
+	// Drops the log (e.g. the world changed or undo rewrote actors outside the delegates). Every
+	// cursor handed out so far now requires a resync.
+	void Reset()
+	{
+		for (TSceneChange<HandleType>& Slot : Slots)
+		{
+			Slot = TSceneChange<HandleType>();
+		}
+		Head = 0;
+		Count = 0;
+		FloorRevision = ++Revision;
+	}
+
+	// Net changes after Since, one entry per actor in order of first change, carrying the latest
+	// revision. An actor added and removed inside the window is omitted. Returns false when Since is
+	// older than the floor or newer than the current revision; the caller must resync.
+	bool CollectSince(uint64 Since, TArray<TSceneChange<HandleType>>& OutChanges) const
+	{
+		if (Since < FloorRevision || Since > Revision)
+		{
+			return false;
+		}
+
+		const int32 FirstOut = OutChanges.Num();
+		TMap<uint32, int32> ById;
+		TBitArray<> AddedInWindow;
+		for (int32 Offset = 0; Offset < Count; ++Offset)
+		{
+			const TSceneChange<HandleType>& Change = Slots[SlotIndex(Offset)];
+			if (Change.Revision <= Since)
+			{
+				continue;
+			}
+
+			if (const int32* Existing = ById.Find(Change.Id))
+			{
+				TSceneChange<HandleType>& Net = OutChanges[*Existing];
+				Net.Kind = MergeKinds(Net.Kind, Change.Kind);
+				Net.Revision = Change.Revision;
+				Net.Name = Change.Name;
+				Net.Handle = Change.Handle;
+				continue;
+			}
+			ById.Add(Change.Id, OutChanges.Add(Change));
+			AddedInWindow.Add(Change.Kind == ESceneChangeKind::Added);
+		}
+
+		// Added and removed inside the window: the caller never saw the actor, so report nothing.
+		for (int32 Index = AddedInWindow.Num() - 1; Index >= 0; --Index)
+		{
+			if (AddedInWindow[Index] && OutChanges[FirstOut + Index].Kind == ESceneChangeKind::Removed)
+			{
+				OutChanges.RemoveAt(FirstOut + Index, 1, EAllowShrinking::No);
+			}
+		}
+		return true;
+	}
+
+private:
+	static ESceneChangeKind MergeKinds(ESceneChangeKind First, ESceneChangeKind Next)
+	{
+		if (Next == ESceneChangeKind::Removed)
+		{
+			return ESceneChangeKind::Removed;
+		}
+		if (First == ESceneChangeKind::Added)
+		{
+			return ESceneChangeKind::Added;
+		}
+		// Removed then re-added (undo of a delete) reads as a modification to a caller who had the actor.
+		return ESceneChangeKind::Modified;
+	}
+
+	int32 SlotIndex(int32 Offset) const
+	{
+		return (Head + Offset) % Slots.Num();
+	}
+
+	TArray<TSceneChange<HandleType>> Slots;
+	int32 Head = 0;
+	int32 Count = 0;
+	uint64 Revision = 0;
+	uint64 FloorRevision = 0;
+};
+} // namespace NovaBridgeCore
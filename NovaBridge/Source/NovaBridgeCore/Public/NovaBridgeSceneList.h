@@ -0,0 +1,151 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+namespace NovaBridgeCore
+{
+enum class ESceneField : uint32
+{
+	None = 0,
+	Name = 1 << 0,
+	Label = 1 << 1,
+	Class = 1 << 2,
+	Path = 1 << 3,
+	Transform = 1 << 4,
+	Tags = 1 << 5,
+	Default = Name | Label | Class | Path | Transform,
+	All = Default | Tags,
+};
+ENUM_CLASS_FLAGS(ESceneField)
+
+constexpr int32 SceneListDefaultLimit = 1000;
+constexpr int32 SceneListMaxLimit = 5000;
+
+// Stable scene ordering: actor name (FName lexical order), then object id to break ties between
+// same-named actors in different levels.
+struct FSceneListKey
+{
+	FName Name;
+	uint32 Id = 0;
+
+	bool operator<(const FSceneListKey& Other) const
+	{
+		const int32 NameOrder = Name.Compare(Other.Name);
+		return NameOrder != 0 ? NameOrder < 0 : Id < Other.Id;
+	}
+};
+
+struct FSceneListQuery
+{
+	int32 Limit = SceneListDefaultLimit;
+	bool bHasCursor = false;
+	FSceneListKey Cursor;
+	// Matches the actor class or any superclass by short name.
+	FName ClassName;
+	FName Tag;
+	ESceneField Fields = ESceneField::Default;
+};
+
+// Comma-separated field names ("name,class,transform"), or "all".
+NOVABRIDGECORE_API bool ParseSceneFields(const FString& Csv, ESceneField& OutFields, FString& OutError);
+
+// Reads cursor, limit, class, tag and fields from query parameters.
+NOVABRIDGECORE_API bool ParseSceneListQuery(const TMap<FString, FString>& Params, int32 DefaultLimit, FSceneListQuery& OutQuery, FString& OutError);
+
+NOVABRIDGECORE_API FString MakeSceneListCursor(const FSceneListKey& Key);
+
+// Accepts full paths ("/Script/Engine.StaticMeshActor") as well as short names; NAME_None when empty.
+NOVABRIDGECORE_API FName NormalizeSceneClassName(const FString& ClassName);
+
+constexpr int32 SceneGetManyMaxProperties = 64;
+
+// Body of /nova/scene/get-many. Actors come from Names when given, otherwise from Query's class, tag,
+// cursor and limit exactly as scene/list would page them. Properties are "Property" or
+// "Component.Property" paths, de-duplicated in request order.
+struct FSceneGetManyRequest
+{
+	TArray<FString> Names;
+	TArray<FString> Properties;
+	FSceneListQuery Query;
+};
+
+// Fields default to just the actor name here; "fields" widens it as in scene/list.
+NOVABRIDGECORE_API bool ParseSceneGetManyRequest(const FJsonObject& Body, FSceneGetManyRequest& OutRequest, FString& OutError);
+
+// Picks one page from an unordered actor scan: keeps the Limit smallest keys after the cursor in a
+// bounded max-heap, so a page costs O(N log Limit) rather than sorting the whole level.
+template <typename HandleType>
+class TScenePageCollector
+{
+public:
+	explicit TScenePageCollector(const FSceneListQuery& InQuery)
+		: Query(InQuery)
+	{
+		Heap.Reserve(FMath::Min(Query.Limit, 256) + 1);
+	}
+
+	// Call for every actor that passed the class/tag filters.
+	void Offer(const FSceneListKey& Key, const HandleType& Handle)
+	{
+		++Matched;
+		if (Query.bHasCursor && !(Query.Cursor < Key))
+		{
+			return;
+		}
+
+		++AfterCursor;
+		if (Heap.Num() < Query.Limit)
+		{
+			Heap.HeapPush(FEntry { Key, Handle }, FLargestFirst());
+		}
+		else if (Key < Heap.HeapTop().Key)
+		{
+			Heap.HeapPopDiscard(FLargestFirst(), EAllowShrinking::No);
+			Heap.HeapPush(FEntry { Key, Handle }, FLargestFirst());
+		}
+	}
+
+	int32 GetMatched() const
+	{
+		return Matched;
+	}
+
+	// Sorted page; bOutHasMore is set when actors remain after the last entry.
+	TArray<TPair<FSceneListKey, HandleType>> Finish(bool& bOutHasMore)
+	{
+		bOutHasMore = AfterCursor > Heap.Num();
+		Heap.Sort([](const FEntry& A, const FEntry& B) { return A.Key < B.Key; });
+
+		TArray<TPair<FSceneListKey, HandleType>> Page;
+		Page.Reserve(Heap.Num());
+		for (FEntry& Entry : Heap)
+		{
+			Page.Emplace(Entry.Key, MoveTemp(Entry.Handle));
+		}
+		Heap.Reset();
+		return Page;
+	}
+
+private:
+	struct FEntry
+	{
+		FSceneListKey Key;
+		HandleType Handle;
+	};
+
+	struct FLargestFirst
+	{
+		bool operator()(const FEntry& A, const FEntry& B) const
+		{
+			return B.Key < A.Key;
+		}
+	};
+
+	FSceneListQuery Query;
+	TArray<FEntry> Heap;
+	int32 Matched = 0;
+	int32 AfterCursor = 0;
+};
+} // namespace NovaBridgeCore
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/GenericOctree.h"
+
+class FJsonObject;
+
+namespace NovaBridgeCore
+{
+enum class ESceneQueryShape : uint8
+{
+	Box,
+	Sphere,
+	Frustum,
+};
+
+// Region for /nova/scene/query. Bounds is a conservative AABB used for the octree walk; Intersects()
+// is the exact (for frustums, plane-conservative) test against one actor's bounds.
+struct NOVABRIDGECORE_API FSceneQueryShape
+{
+	ESceneQueryShape Kind = ESceneQueryShape::Box;
+	FBox Bounds = FBox(ForceInit);
+	FVector Center = FVector::ZeroVector;
+	double Radius = 0.0;
+	// Outward-facing; a box entirely in front of any plane is outside the frustum.
+	TArray<FPlane, TInlineAllocator<6>> Planes;
+
+	static FSceneQueryShape MakeBox(const FBox& Box);
+	static FSceneQueryShape MakeSphere(const FVector& Center, double Radius);
+	static FSceneQueryShape MakeFrustum(const FVector& Origin, const FRotator& Rotation, double FovDegrees, double Aspect, double NearPlane, double FarPlane);
+
+	bool Intersects(const FBox& ActorBounds) const;
+};
+
+// Reads exactly one of "box" ({min,max} or {center,extent}), "sphere" ({center,radius}) or
+// "frustum" ({origin,rotation,fov,aspect,near,far}). Vectors are [x,y,z] or {x,y,z}.
+NOVABRIDGECORE_API bool ParseSceneQueryShape(const FJsonObject& Body, FSceneQueryShape& OutShape, FString& OutError);
+
+// Covers the editor's default world extent; elements outside it stay in the root node.
+constexpr double SceneSpatialIndexHalfExtent = 2097152.0;
+
+// Loose octree over actor bounds keyed by a stable id, built on the engine's TOctree2. Update() is
+// cheap enough to call from every transform notification. Not thread-safe; owners keep it on the
+// game thread.
+template <typename HandleType>
+class TSceneSpatialIndex
+{
+public:
+	TSceneSpatialIndex()
+		: Octree(FVector::ZeroVector, SceneSpatialIndexHalfExtent)
+	{
+	}
+
+	TSceneSpatialIndex(const TSceneSpatialIndex&) = delete;
+	TSceneSpatialIndex& operator=(const TSceneSpatialIndex&) = delete;
+
+	int32 Num() const
+	{
+		return ElementIds.Num();
+	}
+
+	void Reset()
+	{
+		Octree.Destroy();
+		ElementIds.Reset();
+	}
+
+	void Update(uint32 Id, const HandleType& Handle, const FBox& Bounds)
+	{
+		if (const FOctreeElementId2* Existing = ElementIds.Find(Id))
+		{
+			const FElement& Current = Octree.GetElementById(*Existing);
+			if (Current.Bounds == Bounds && Current.Handle == Handle)
+			{
+				return;
+			}
+			Octree.RemoveElement(*Existing);
+			ElementIds.Remove(Id);
+		}
+		Octree.AddElement(FElement { Id, Handle, Bounds, &ElementIds });
+	}
+
+	void Remove(uint32 Id)
+	{
+		FOctreeElementId2 ElementId;
+		if (ElementIds.RemoveAndCopyValue(Id, ElementId) && Octree.IsValidElementId(ElementId))
+		{
+			Octree.RemoveElement(ElementId);
+		}
+	}
+
+	// Visits every element whose indexed bounds pass Shape.Intersects.
+	void Query(const FSceneQueryShape& Shape, TFunctionRef<void(uint32 Id, const HandleType& Handle, const FBox& Bounds)> Visit) const
+	{
+		if (!Shape.Bounds.IsValid)
+		{
+			return;
+		}
+		Octree.FindElementsWithBoundsTest(FBoxCenterAndExtent(Shape.Bounds), [&Shape, &Visit](const FElement& Element)
+		{
+			if (Shape.Intersects(Element.Bounds))
+			{
+				Visit(Element.Id, Element.Handle, Element.Bounds);
+			}
+		});
+	}
+
+	// Closest element (by distance from Point to its bounds) within Radius that passes Filter.
+	bool FindNearest(const FVector& Point, double Radius, TFunctionRef<bool(const HandleType& Handle)> Filter, HandleType& OutHandle) const
+	{
+		double BestDistSq = FMath::Square(Radius);
+		bool bFound = false;
+		Query(FSceneQueryShape::MakeSphere(Point, Radius), [&](uint32 Id, const HandleType& Handle, const FBox& Bounds)
+		{
+			(void)Id;
+			const double DistSq = Bounds.ComputeSquaredDistanceToPoint(Point);
+			if (DistSq <= BestDistSq && Filter(Handle))
+			{
+				BestDistSq = DistSq;
+				OutHandle = Handle;
+				bFound = true;
+			}
+		});
+		return bFound;
+	}
+
+private:
+	struct FElement
+	{
+		uint32 Id = 0;
+		HandleType Handle;
+		FBox Bounds;
+		TMap<uint32, FOctreeElementId2>* Ids = nullptr;
+	};
+
+	struct FSemantics
+	{
+		enum { MaxElementsPerLeaf = 16 };
+		enum { MinInclusiveElementsPerNode = 7 };
+		enum { MaxNodeDepth = 12 };
+
+		typedef TInlineAllocator<MaxElementsPerLeaf> ElementAllocator;
+
+		static FBoxCenterAndExtent GetBoundingBox(const FElement& Element)
+		{
+			return FBoxCenterAndExtent(Element.Bounds);
+		}
+
+		static bool AreElementsEqual(const FElement& A, const FElement& B)
+		{
+			return A.Id == B.Id;
+		}
+
+		// The octree moves elements between slots on removal and node collapse; keep the id map current.
+		static void SetElementId(const FElement& Element, FOctreeElementId2 ElementId)
+		{
+			Element.Ids->Add(Element.Id, ElementId);
+		}
+
+		static void ApplyOffset(FElement& Element, const FVector& Offset)
+		{
+			Element.Bounds = Element.Bounds.ShiftBy(Offset);
+		}
+	};
+
+	TOctree2<FElement, FSemantics> Octree;
+	TMap<uint32, FOctreeElementId2> ElementIds;
+};
+} // namespace NovaBridgeCore
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "NovaBridgeResponseProfile.h"
+#include "NovaBridgeSceneList.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+namespace NovaBridgeCore
+{
+using FSnapshotJsonWriter = TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>;
+
+constexpr int32 SnapshotEncodeChunkSize = 512;
+
+// Plain copy of the actor fields a listing serializes. Handlers fill it on the game thread and only
+// for the requested fields; everything after that (FName lookups included) is safe on any thread.
+struct FActorSnapshot
+{
+	FName Name;
+	FString Label;
+	FName ClassName;
+	FString Path;
+	TArray<FName> Tags;
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	FVector Scale = FVector::OneVector;
+};
+
+// Same object shape and key order as the editor's ActorToJson, or what WriteCompactJson would make of it.
+NOVABRIDGECORE_API void WriteActorSnapshot(FSnapshotJsonWriter& Writer, const FActorSnapshot& Actor, ESceneField Fields, const FResponseProfile& Profile = FResponseProfile());
+
+// Encodes Items as a condensed JSON array. Chunks of ChunkSize items are written in parallel, each by
+// its own writer, and joined in order. WriteItem(Writer, Item) writes exactly one array element.
+template <typename ItemType, typename WriteFnType>
+FString EncodeJsonArrayParallel(TConstArrayView<ItemType> Items, WriteFnType WriteItem, int32 ChunkSize = SnapshotEncodeChunkSize)
+{
+	ChunkSize = FMath::Max(1, ChunkSize);
+	const int32 NumChunks = FMath::DivideAndRoundUp(Items.Num(), ChunkSize);
+	TArray<FString> Chunks;
+	Chunks.SetNum(NumChunks);
+	ParallelFor(NumChunks, [&Items, &WriteItem, &Chunks, ChunkSize](int32 Chunk)
+	{
+		FString& Out = Chunks[Chunk];
+		TSharedRef<FSnapshotJsonWriter> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Out);
+		Writer->WriteArrayStart();
+		const int32 End = FMath::Min(Items.Num(), (Chunk + 1) * ChunkSize);
+		for (int32 Index = Chunk * ChunkSize; Index < End; ++Index)
+		{
+			WriteItem(*Writer, Items[Index]);
+		}
+		Writer->WriteArrayEnd();
+		Writer->Close();
+	}, NumChunks < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	int32 TotalLen = 2;
+	for (const FString& Chunk : Chunks)
+	{
+		TotalLen += Chunk.Len();
+	}
+	FString Result;
+	Result.Reserve(TotalLen);
+	Result.AppendChar(TEXT('['));
+	for (const FString& Chunk : Chunks)
+	{
+		// Each chunk is "[...]"; keep the elements only.
+		if (Chunk.Len() > 2)
+		{
+			if (Result.Len() > 1)
+			{
+				Result.AppendChar(TEXT(','));
+			}
+			Result.AppendChars(*Chunk + 1, Chunk.Len() - 2);
+		}
+	}
+	Result.AppendChar(TEXT(']'));
+	return Result;
+}
+
+NOVABRIDGECORE_API FString EncodeActorSnapshotsJson(TConstArrayView<FActorSnapshot> Actors, ESceneField Fields, const FResponseProfile& Profile = FResponseProfile(), int32 ChunkSize = SnapshotEncodeChunkSize);
+
+// Condensed Envelope (in the requested profile) with ArrayField set to the pre-encoded ArrayJson, as the last field.
+NOVABRIDGECORE_API FString ComposeJsonBody(const TSharedRef<FJsonObject>& Envelope, const TCHAR* ArrayField, const FString& ArrayJson, const FResponseProfile& Profile = FResponseProfile());
+} // namespace NovaBridgeCore
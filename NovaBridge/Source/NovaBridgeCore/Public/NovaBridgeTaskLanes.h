@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "NovaBridgeAdmission.h"
+
+#include <atomic>
+
+namespace NovaBridgeCore
+{
+// Game-thread work is queued per lane and lanes drain in this order every frame.
+enum class ETaskLane : uint8
+{
+	// Control and read-only routes.
+	Interactive,
+	// Routes that change the editor state.
+	Mutating,
+	// Captures, renders, builds, imports and plans.
+	Heavy,
+};
+
+constexpr int32 TaskLaneCount = 3;
+constexpr double DefaultMutatingLaneBudgetMs = 8.0;
+constexpr double DefaultHeavyLaneBudgetMs = 4.0;
+
+NOVABRIDGECORE_API const TCHAR* TaskLaneToString(ETaskLane Lane);
+NOVABRIDGECORE_API ETaskLane TaskLaneForRouteClass(ERouteClass Class);
+
+struct FTaskLaneStats
+{
+	int32 Depth = 0;
+	int32 PeakDepth = 0;
+	uint64 Ran = 0;
+	// Drains that hit the lane's budget with work still queued.
+	uint64 Deferred = 0;
+	double BudgetMs = 0.0;
+};
+
+// Per-lane FIFOs of game-thread tasks. Enqueue from any thread; Drain from the game thread only. Each drain
+// runs a lane's tasks until its budget is spent, but always at least one, so no lane starves.
+class NOVABRIDGECORE_API FTaskLaneQueue
+{
+public:
+	// 0 means the lane has no budget and runs everything queued when its turn starts.
+	void SetBudgetMs(ETaskLane Lane, double BudgetMs);
+	void Enqueue(ETaskLane Lane, TUniqueFunction<void()>&& Task);
+	// Continuations of work that must yield first: the task is held until the drain after the one in
+	// progress (or the next drain, between drains). It keeps its FIFO place, so tasks queued behind it in
+	// the same lane wait with it.
+	void EnqueueNextDrain(ETaskLane Lane, TUniqueFunction<void()>&& Task);
+
+	// Clock returns seconds; it is injectable so tests do not depend on wall time. Tasks queued while a lane
+	// runs wait for the next drain. Returns the number of tasks run.
+	int32 Drain(TFunctionRef<double()> Clock);
+
+	FTaskLaneStats GetStats(ETaskLane Lane) const;
+	// Clears counters; budgets and queued tasks are kept.
+	void ResetStats();
+
+private:
+	struct FQueuedTask
+	{
+		TUniqueFunction<void()> Run;
+		// Drain serial the task may first run in; 0 runs in any drain.
+		uint64 NotBeforeDrain = 0;
+	};
+
+	struct FLane
+	{
+		TQueue<FQueuedTask, EQueueMode::Mpsc> Tasks;
+		std::atomic<int32> Depth { 0 };
+		std::atomic<int32> PeakDepth { 0 };
+		std::atomic<uint64> Ran { 0 };
+		std::atomic<uint64> Deferred { 0 };
+		std::atomic<double> BudgetMs { 0.0 };
+	};
+
+	void EnqueueTask(ETaskLane Lane, FQueuedTask&& Task);
+
+	FLane Lanes[TaskLaneCount];
+	// Bumped when each drain starts.
+	std::atomic<uint64> DrainSerial { 0 };
+};
+} // namespace NovaBridgeCore
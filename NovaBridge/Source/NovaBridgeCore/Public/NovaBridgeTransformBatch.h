@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+namespace NovaBridgeCore
+{
+enum class ETransformField : uint32
+{
+	None = 0,
+	Location = 1u << 0,
+	Rotation = 1u << 1,
+	Scale = 1u << 2,
+	All = Location | Rotation | Scale,
+};
+ENUM_CLASS_FLAGS(ETransformField)
+
+// One entry of /nova/scene/transform-batch. Only the components named in Fields are applied; the
+// rest of the actor's transform is kept.
+struct FTransformUpdate
+{
+	FString Name;
+	ETransformField Fields = ETransformField::None;
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	FVector Scale = FVector::OneVector;
+};
+
+// Binary body layout, all little-endian:
+//   char[4] "NBTX", uint32 version, uint32 flags (reserved, 0), uint32 update_count,
+//   then per update: uint32 fields, float32[3] location, float32[3] rotation (pitch, yaw, roll),
+//   float32[3] scale, uint32 name_length, uint8[name_length] UTF-8 actor name.
+// Every record carries all nine floats so records stay fixed-size apart from the name.
+constexpr uint32 TransformBatchBinaryVersion = 1;
+constexpr uint32 TransformBatchHeaderSize = 16;
+constexpr uint32 TransformBatchRecordSize = 44;
+constexpr int32 MaxTransformBatchUpdates = 100000;
+constexpr int32 MaxTransformBatchNameBytes = 1024;
+
+NOVABRIDGECORE_API bool ParseTransformBatchBinary(const uint8* Data, int64 Size, TArray<FTransformUpdate>& OutUpdates, FString& OutError);
+
+// Reads {"updates":[{"name", "location", "rotation", "scale"}]}. Vectors are [x,y,z] or {x,y,z};
+// rotations are [pitch,yaw,roll] or {pitch,yaw,roll}.
+NOVABRIDGECORE_API bool ParseTransformBatchJson(const FJsonObject& Body, TArray<FTransformUpdate>& OutUpdates, FString& OutError);
+
+NOVABRIDGECORE_API TArray<uint8> EncodeTransformBatchBinary(const TArray<FTransformUpdate>& Updates);
+} // namespace NovaBridgeCore
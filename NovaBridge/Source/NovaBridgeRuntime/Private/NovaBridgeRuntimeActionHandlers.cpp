@@ -1,4 +1,6 @@
 #include "NovaBridgeRuntimeModule.h"
+#include "NovaBridgeRuntimeInternals.h"
+#include "NovaBridgeSceneList.h"
 
 #include "Async/Async.h"
 #include "Dom/JsonValue.h"
@@ -69,27 +71,10 @@ UWorld* ResolveRuntimeWorld()
 
 AActor* FindActorByNameRuntime(UWorld* World, const FString& Name)
 {
-	if (!World || Name.IsEmpty())
-	{
-		return nullptr;
-	}
-
-	for (TActorIterator<AActor> It(World); It; ++It)
-	{
-		AActor* Actor = *It;
-		if (!Actor)
-		{
-			continue;
-		}
-		if (Actor->GetName() == Name || Actor->GetActorNameOrLabel() == Name)
-		{
-			return Actor;
-		}
-	}
-	return nullptr;
+	return FindIndexedRuntimeActor(World, Name, true);
 }
 
-TSharedPtr<FJsonObject> ActorToJsonRuntime(AActor* Actor)
+TSharedPtr<FJsonObject> ActorToJsonRuntime(AActor* Actor, NovaBridgeCore::ESceneField Fields = NovaBridgeCore::ESceneField::Default)
 {
 	const TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
 	if (!Actor)
@@ -99,10 +84,38 @@ TSharedPtr<FJsonObject> ActorToJsonRuntime(AActor* Actor)
 		return Obj;
 	}
 
-	Obj->SetStringField(TEXT("name"), Actor->GetName());
-	Obj->SetStringField(TEXT("label"), Actor->GetActorNameOrLabel());
-	Obj->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
+	using NovaBridgeCore::ESceneField;
+	if (EnumHasAnyFlags(Fields, ESceneField::Name))
+	{
+		Obj->SetStringField(TEXT("name"), Actor->GetName());
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Label))
+	{
+		Obj->SetStringField(TEXT("label"), Actor->GetActorNameOrLabel());
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Class))
+	{
+		Obj->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
+	}
+	if (EnumHasAnyFlags(Fields, ESceneField::Path))
+	{
+		Obj->SetStringField(TEXT("path"), Actor->GetPathName());
+	}
 	Obj->SetBoolField(TEXT("pending_kill"), Actor->IsPendingKillPending());
+	if (EnumHasAnyFlags(Fields, ESceneField::Tags))
+	{
+		TArray<TSharedPtr<FJsonValue>> Tags;
+		Tags.Reserve(Actor->Tags.Num());
+		for (const FName& Tag : Actor->Tags)
+		{
+			Tags.Add(MakeShared<FJsonValueString>(Tag.ToString()));
+		}
+		Obj->SetArrayField(TEXT("tags"), Tags);
+	}
+	if (!EnumHasAnyFlags(Fields, ESceneField::Transform))
+	{
+		return Obj;
+	}
 
 	const FVector Location = Actor->GetActorLocation();
 	const FRotator Rotation = Actor->GetActorRotation();
@@ -129,6 +142,23 @@ TSharedPtr<FJsonObject> ActorToJsonRuntime(AActor* Actor)
 	return Obj;
 }
 
+bool ActorMatchesClassNameRuntime(const AActor* Actor, FName ClassName, TMap<const UClass*, bool>& Cache)
+{
+	const UClass* ActorClass = Actor->GetClass();
+	if (const bool* Cached = Cache.Find(ActorClass))
+	{
+		return *Cached;
+	}
+
+	bool bMatches = false;
+	for (const UClass* Class = ActorClass; Class && !bMatches; Class = Class->GetSuperClass())
+	{
+		bMatches = Class->GetFName() == ClassName;
+	}
+	Cache.Add(ActorClass, bMatches);
+	return bMatches;
+}
+
 bool JsonValueToVector(const TSharedPtr<FJsonValue>& Value, FVector& OutVector)
 {
 	if (!Value.IsValid())
@@ -412,13 +442,15 @@ void AddCameraStateToJson(APlayerController* PlayerController, const TSharedPtr<
 
 bool FNovaBridgeRuntimeModule::HandleSceneList(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
-	int32 Limit = 500;
-	if (Request.QueryParams.Contains(TEXT("limit")))
+	NovaBridgeCore::FSceneListQuery Query;
+	FString QueryError;
+	if (!NovaBridgeCore::ParseSceneListQuery(Request.QueryParams, 500, Query, QueryError))
 	{
-		Limit = FMath::Clamp(FCString::Atoi(*Request.QueryParams[TEXT("limit")]), 1, 5000);
+		SendErrorResponse(OnComplete, QueryError, 400);
+		return true;
 	}
 
-	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Limit]()
+	AsyncTask(ENamedThreads::GameThread, [this, OnComplete, Query]()
 	{
 		UWorld* World = ResolveRuntimeWorld();
 		if (!World)
@@ -427,30 +459,39 @@ bool FNovaBridgeRuntimeModule::HandleSceneList(const FHttpServerRequest& Request
 			return;
 		}
 
-		TArray<TSharedPtr<FJsonValue>> Actors;
-		Actors.Reserve(FMath::Min(Limit, 256));
-		int32 Count = 0;
+		NovaBridgeCore::TScenePageCollector<AActor*> Collector(Query);
+		TMap<const UClass*, bool> ClassMatches;
 		for (TActorIterator<AActor> It(World); It; ++It)
 		{
 			AActor* Actor = *It;
-			if (!Actor)
+			if (!Actor
+				|| (!Query.ClassName.IsNone() && !ActorMatchesClassNameRuntime(Actor, Query.ClassName, ClassMatches))
+				|| (!Query.Tag.IsNone() && !Actor->ActorHasTag(Query.Tag)))
 			{
 				continue;
 			}
+			Collector.Offer(NovaBridgeCore::FSceneListKey { Actor->GetFName(), Actor->GetUniqueID() }, Actor);
+		}
 
-			Count++;
-			if (Actors.Num() >= Limit)
-			{
-				continue;
-			}
-			Actors.Add(MakeShared<FJsonValueObject>(ActorToJsonRuntime(Actor)));
+		bool bHasMore = false;
+		const TArray<TPair<NovaBridgeCore::FSceneListKey, AActor*>> Page = Collector.Finish(bHasMore);
+		TArray<TSharedPtr<FJsonValue>> Actors;
+		Actors.Reserve(Page.Num());
+		for (const TPair<NovaBridgeCore::FSceneListKey, AActor*>& Entry : Page)
+		{
+			Actors.Add(MakeShared<FJsonValueObject>(ActorToJsonRuntime(Entry.Value, Query.Fields)));
 		}
 
 		const TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 		Result->SetStringField(TEXT("status"), TEXT("ok"));
 		Result->SetStringField(TEXT("mode"), RuntimeModeName);
 		Result->SetStringField(TEXT("level"), World->GetMapName());
-		Result->SetNumberField(TEXT("count"), Count);
+		Result->SetNumberField(TEXT("count"), Actors.Num());
+		Result->SetNumberField(TEXT("total"), Collector.GetMatched());
+		if (bHasMore)
+		{
+			Result->SetStringField(TEXT("next_cursor"), NovaBridgeCore::MakeSceneListCursor(Page.Last().Key));
+		}
 		Result->SetArrayField(TEXT("actors"), Actors);
 		SendJsonResponse(OnComplete, Result);
 	});
@@ -0,0 +1,186 @@
+#include "NovaBridgeRuntimeInternals.h"
+
+#include "NovaBridgeActorLookupIndex.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+
+namespace
+{
+// Game-thread only: every lookup and every delegate that touches it runs there.
+struct FRuntimeActorIndexState
+{
+	TWeakObjectPtr<UWorld> World;
+	NovaBridgeCore::TActorLookupIndex<TWeakObjectPtr<AActor>> Index;
+	FDelegateHandle SpawnedHandle;
+	FDelegateHandle DestroyedHandle;
+};
+
+FRuntimeActorIndexState RuntimeActorIndex;
+FDelegateHandle RuntimeLabelChangedHandle;
+FDelegateHandle RuntimeLevelAddedHandle;
+FDelegateHandle RuntimeLevelRemovedHandle;
+FDelegateHandle RuntimeWorldCleanupHandle;
+
+bool IsIndexedWorld(const UWorld* World)
+{
+	return World && RuntimeActorIndex.World.Get() == World;
+}
+
+// Packaged builds have no labels, so only index one when it differs from the object name.
+FString RuntimeActorLabel(const AActor* Actor)
+{
+	const FString Label = Actor->GetActorNameOrLabel();
+	return Label.Equals(Actor->GetName(), ESearchCase::CaseSensitive) ? FString() : Label;
+}
+
+void IndexActor(AActor* Actor)
+{
+	if (IsValid(Actor))
+	{
+		RuntimeActorIndex.Index.Add(Actor, Actor->GetFName(), RuntimeActorLabel(Actor));
+	}
+}
+
+void OnActorSpawned(AActor* Actor)
+{
+	IndexActor(Actor);
+}
+
+void OnActorDestroyed(AActor* Actor)
+{
+	RuntimeActorIndex.Index.Remove(Actor);
+}
+
+#if WITH_EDITOR
+void OnActorLabelChanged(AActor* Actor)
+{
+	if (Actor && IsIndexedWorld(Actor->GetWorld()))
+	{
+		RuntimeActorIndex.Index.Relabel(Actor, RuntimeActorLabel(Actor));
+	}
+}
+#endif
+
+void OnLevelAdded(ULevel* Level, UWorld* World)
+{
+	if (Level && IsIndexedWorld(World))
+	{
+		for (AActor* Actor : Level->Actors)
+		{
+			IndexActor(Actor);
+		}
+	}
+}
+
+void OnLevelRemoved(ULevel* Level, UWorld* World)
+{
+	if (Level && IsIndexedWorld(World))
+	{
+		for (AActor* Actor : Level->Actors)
+		{
+			RuntimeActorIndex.Index.Remove(Actor);
+		}
+	}
+}
+
+void UnbindIndexedWorld()
+{
+	if (UWorld* World = RuntimeActorIndex.World.Get())
+	{
+		World->RemoveOnActorSpawnedHandler(RuntimeActorIndex.SpawnedHandle);
+		World->RemoveOnActorDestroyededHandler(RuntimeActorIndex.DestroyedHandle);
+	}
+	RuntimeActorIndex.SpawnedHandle.Reset();
+	RuntimeActorIndex.DestroyedHandle.Reset();
+	RuntimeActorIndex.World.Reset();
+	RuntimeActorIndex.Index.Reset();
+}
+
+void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	(void)bSessionEnded;
+	(void)bCleanupResources;
+	if (IsIndexedWorld(World))
+	{
+		UnbindIndexedWorld();
+	}
+}
+
+void BindIndexedWorld(UWorld* World)
+{
+	if (IsIndexedWorld(World))
+	{
+		return;
+	}
+
+	UnbindIndexedWorld();
+	RuntimeActorIndex.World = World;
+	RuntimeActorIndex.SpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateStatic(&OnActorSpawned));
+	RuntimeActorIndex.DestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateStatic(&OnActorDestroyed));
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		IndexActor(*It);
+	}
+}
+
+AActor* ResolveBucket(const NovaBridgeCore::TActorLookupIndex<TWeakObjectPtr<AActor>>::FBucket* Bucket, UWorld* World, const FString& Name, bool bByLabel)
+{
+	if (!Bucket)
+	{
+		return nullptr;
+	}
+
+	for (const TWeakObjectPtr<AActor>& Handle : *Bucket)
+	{
+		// Renames bypass the delegates, so confirm the key still matches before trusting an entry.
+		AActor* Actor = Handle.Get();
+		if (IsValid(Actor) && Actor->GetWorld() == World && (bByLabel ? Actor->GetActorNameOrLabel() == Name : Actor->GetName() == Name))
+		{
+			return Actor;
+		}
+	}
+	return nullptr;
+}
+} // namespace
+
+void StartRuntimeActorIndex()
+{
+#if WITH_EDITOR
+	RuntimeLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddStatic(&OnActorLabelChanged);
+#endif
+	RuntimeLevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddStatic(&OnLevelAdded);
+	RuntimeLevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddStatic(&OnLevelRemoved);
+	RuntimeWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&OnWorldCleanup);
+}
+
+void StopRuntimeActorIndex()
+{
+#if WITH_EDITOR
+	FCoreDelegates::OnActorLabelChanged.Remove(RuntimeLabelChangedHandle);
+#endif
+	FWorldDelegates::LevelAddedToWorld.Remove(RuntimeLevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(RuntimeLevelRemovedHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(RuntimeWorldCleanupHandle);
+	UnbindIndexedWorld();
+}
+
+AActor* FindIndexedRuntimeActor(UWorld* World, const FString& Name, bool bMatchLabel)
+{
+	check(IsInGameThread());
+	if (!World || Name.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	BindIndexedWorld(World);
+	const NovaBridgeCore::TActorLookupIndex<TWeakObjectPtr<AActor>>& Index = RuntimeActorIndex.Index;
+	if (AActor* Actor = ResolveBucket(Index.FindByName(FName(*Name, FNAME_Find)), World, Name, false))
+	{
+		return Actor;
+	}
+	// Spawns and level streaming keep the index complete, so a miss is an answer and never walks the world.
+	return bMatchLabel ? ResolveBucket(Index.FindByLabel(Name), World, Name, true) : nullptr;
+}
@@ -5,6 +5,7 @@
 #include "NovaBridgeHttpUtils.h"
 #include "NovaBridgePlanSchema.h"
 #include "NovaBridgePolicy.h"
+#include "NovaBridgeRoutePolicy.h"
 
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
@@ -198,10 +199,19 @@ TSharedPtr<FJsonObject> FNovaBridgeRuntimeModule::BuildRuntimePermissionsSnapsho
 	EventsPolicy->SetBoolField(TEXT("subscription_ack_required"), true);
 	Permissions->SetObjectField(TEXT("events"), EventsPolicy);
 
+	// Route answers come from the compiled table the bind wrapper enforces.
+	const int32 RoleSlot = NovaBridgeCore::FTokenBucketRateLimiter::RoleSlotForName(EffectiveRole);
+	auto RateLimitFor = [this, RoleSlot](const TCHAR* RoutePath)
+	{
+		const NovaBridgeCore::FRoutePolicy* Policy = RuntimeRoutePolicies.Find(RoutePath);
+		return Policy ? Policy->RateLimitFor(RoleSlot) : 0;
+	};
+
 	const TSharedPtr<FJsonObject> RouteRates = MakeShared<FJsonObject>();
-	RouteRates->SetNumberField(TEXT("all"), GetRuntimeRouteRateLimitPerMinute(EffectiveRole, TEXT("/nova/health")));
-	RouteRates->SetNumberField(TEXT("executePlan"), GetRuntimeRouteRateLimitPerMinute(EffectiveRole, TEXT("/nova/executePlan")));
+	RouteRates->SetNumberField(TEXT("all"), RateLimitFor(TEXT("/nova/health")));
+	RouteRates->SetNumberField(TEXT("executePlan"), RateLimitFor(TEXT("/nova/executePlan")));
 	Permissions->SetObjectField(TEXT("route_rate_limits_per_minute"), RouteRates);
+	Permissions->SetArrayField(TEXT("routes"), NovaBridgeCore::MakeRoutePolicyJson(RuntimeRoutePolicies.GetAll(), RoleSlot));
 	return Permissions;
 }
 
@@ -355,10 +365,7 @@ bool FNovaBridgeRuntimeModule::HandlePair(const FHttpServerRequest& Request, con
 	RuntimeTokenRole = PairRole;
 	RuntimeTokenIssuedUtc = NowUtc;
 	RuntimeTokenExpiryUtc = NowUtc + FTimespan::FromHours(1.0);
-	{
-		FScopeLock RateLock(&RuntimeRouteRateLimitMutex);
-		RuntimeRouteRateBuckets.Empty();
-	}
+	RuntimeRateLimiter.Reset();
 	const int32 RefreshedCode = FMath::RandRange(100000, 999999);
 	RuntimePairingCode = FString::Printf(TEXT("%06d"), RefreshedCode);
 	RuntimePairingExpiryUtc = NowUtc + FTimespan::FromMinutes(15.0);
@@ -75,10 +75,11 @@ void SendSocketJsonMessage(INetworkingWebSocket* Socket, const TSharedPtr<FJsonO
 	Socket->Send(MutableData, Utf8Payload.Length(), false);
 }
 
-bool ParseRuntimeSubscriptionPayload(const FString& Message, TSet<FString>& OutTypes, bool& bOutEnableFilter, FString& OutError)
+bool ParseRuntimeSubscriptionPayload(const FString& Message, TSet<FString>& OutTypes, bool& bOutEnableFilter, int64& OutSinceSeq, FString& OutError)
 {
 	OutTypes.Reset();
 	bOutEnableFilter = false;
+	OutSinceSeq = -1;
 
 	TSharedPtr<FJsonObject> JsonObj;
 	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
@@ -88,6 +89,21 @@ bool ParseRuntimeSubscriptionPayload(const FString& Message, TSet<FString>& OutT
 		return false;
 	}
 
+	if (JsonObj->HasTypedField<EJson::Number>(TEXT("since")))
+	{
+		OutSinceSeq = FMath::Max<int64>(0, static_cast<int64>(JsonObj->GetNumberField(TEXT("since"))));
+	}
+	else if (JsonObj->HasTypedField<EJson::String>(TEXT("since")))
+	{
+		const FString SinceText = JsonObj->GetStringField(TEXT("since"));
+		if (!SinceText.IsNumeric())
+		{
+			OutError = TEXT("Subscription 'since' must be a sequence number");
+			return false;
+		}
+		OutSinceSeq = FMath::Max<int64>(0, FCString::Atoi64(*SinceText));
+	}
+
 	FString Action = JsonObj->HasTypedField<EJson::String>(TEXT("action"))
 		? NormalizeEventType(JsonObj->GetStringField(TEXT("action")))
 		: TEXT("subscribe");
@@ -173,8 +189,9 @@ void FNovaBridgeRuntimeModule::StartEventWebSocketServer()
 			const FString Message(Converted.Length(), Converted.Get());
 			TSet<FString> RequestedTypes;
 			bool bEnableFilter = false;
+			int64 SinceSeq = -1;
 			FString ParseError;
-			if (!ParseRuntimeSubscriptionPayload(Message, RequestedTypes, bEnableFilter, ParseError))
+			if (!ParseRuntimeSubscriptionPayload(Message, RequestedTypes, bEnableFilter, SinceSeq, ParseError))
 			{
 				const TSharedPtr<FJsonObject> ErrorReply = MakeShared<FJsonObject>();
 				ErrorReply->SetStringField(TEXT("type"), TEXT("subscription"));
@@ -194,16 +211,34 @@ void FNovaBridgeRuntimeModule::StartEventWebSocketServer()
 				return;
 			}
 
-			EventWsClients[ClientIndex].bEventTypeFilterEnabled = bEnableFilter;
-			EventWsClients[ClientIndex].EventTypes = MoveTemp(RequestedTypes);
-			EventWsClients[ClientIndex].bSubscriptionConfirmed = true;
+			// since=<seq> replays everything after seq on the next pump; without it a new subscriber starts live.
+			FWsClient& Client = EventWsClients[ClientIndex];
+			const NovaBridgeCore::FEventRingStats EventStats = RuntimeEventRing.GetStats();
+			bool bReplayGap = false;
+			if (SinceSeq >= 0)
+			{
+				const uint64 Since = static_cast<uint64>(SinceSeq);
+				bReplayGap = !RuntimeEventRing.CanReplayFrom(Since);
+				Client.LastEventSeq = FMath::Min(Since, EventStats.HeadSeq);
+			}
+			else if (!Client.bSubscriptionConfirmed)
+			{
+				Client.LastEventSeq = EventStats.HeadSeq;
+			}
+			Client.bEventTypeFilterEnabled = bEnableFilter;
+			Client.EventTypes = MoveTemp(RequestedTypes);
+			Client.bSubscriptionConfirmed = true;
 
 			const TSharedPtr<FJsonObject> AckReply = MakeShared<FJsonObject>();
 			AckReply->SetStringField(TEXT("type"), TEXT("subscription"));
 			AckReply->SetStringField(TEXT("status"), TEXT("ok"));
 			AckReply->SetBoolField(TEXT("subscription_confirmed"), true);
-			AckReply->SetBoolField(TEXT("filter_enabled"), EventWsClients[ClientIndex].bEventTypeFilterEnabled);
-			AckReply->SetArrayField(TEXT("types"), MakeJsonStringArray(EventWsClients[ClientIndex].EventTypes.Array()));
+			AckReply->SetBoolField(TEXT("filter_enabled"), Client.bEventTypeFilterEnabled);
+			AckReply->SetArrayField(TEXT("types"), MakeJsonStringArray(Client.EventTypes.Array()));
+			AckReply->SetNumberField(TEXT("head_seq"), static_cast<double>(EventStats.HeadSeq));
+			AckReply->SetNumberField(TEXT("tail_seq"), static_cast<double>(EventStats.TailSeq));
+			AckReply->SetNumberField(TEXT("replay_from"), static_cast<double>(Client.LastEventSeq));
+			AckReply->SetBoolField(TEXT("replay_gap"), bReplayGap);
 			SendSocketJsonMessage(Socket, AckReply);
 		});
 		Socket->SetReceiveCallBack(ReceiveCallback);
@@ -234,6 +269,7 @@ void FNovaBridgeRuntimeModule::StartEventWebSocketServer()
 		WelcomeReply->SetBoolField(TEXT("events_paused_until_subscribe"), true);
 		WelcomeReply->SetBoolField(TEXT("filter_enabled"), false);
 		WelcomeReply->SetArrayField(TEXT("supported_types"), MakeJsonStringArray(SupportedRuntimeEventTypes()));
+		WelcomeReply->SetNumberField(TEXT("head_seq"), static_cast<double>(RuntimeEventRing.GetStats().HeadSeq));
 		WelcomeReply->SetStringField(TEXT("hint"), TEXT("{\"action\":\"subscribe\",\"types\":[\"spawn\",\"error\"]}"));
 		SendSocketJsonMessage(Socket, WelcomeReply);
 
@@ -293,9 +329,7 @@ void FNovaBridgeRuntimeModule::StopEventWebSocketServer()
 	EventWsServer.Reset();
 #endif
 
-	FScopeLock EventLock(&RuntimeEventQueueMutex);
-	RuntimePendingEventPayloads.Empty();
-	RuntimePendingEventTypes.Empty();
+	RuntimeEventRing.Reset();
 }
 
 void FNovaBridgeRuntimeModule::PumpEventSocketQueue()
@@ -306,56 +340,72 @@ void FNovaBridgeRuntimeModule::PumpEventSocketQueue()
 		return;
 	}
 
-	TArray<FString> PendingPayloads;
-	TArray<FString> PendingTypes;
+	uint64 OldestCursor = MAX_uint64;
+	for (int32 ClientIndex = EventWsClients.Num() - 1; ClientIndex >= 0; --ClientIndex)
 	{
-		FScopeLock EventLock(&RuntimeEventQueueMutex);
-		if (RuntimePendingEventPayloads.Num() == 0)
+		if (!EventWsClients[ClientIndex].Socket)
 		{
-			return;
+			EventWsClients.RemoveAtSwap(ClientIndex);
+			continue;
+		}
+		if (EventWsClients[ClientIndex].bSubscriptionConfirmed)
+		{
+			OldestCursor = FMath::Min(OldestCursor, EventWsClients[ClientIndex].LastEventSeq);
 		}
-		PendingPayloads = MoveTemp(RuntimePendingEventPayloads);
-		PendingTypes = MoveTemp(RuntimePendingEventTypes);
-		RuntimePendingEventPayloads.Reset();
-		RuntimePendingEventTypes.Reset();
 	}
-	if (PendingTypes.Num() != PendingPayloads.Num())
+	if (OldestCursor == MAX_uint64)
 	{
-		PendingTypes.Init(TEXT("audit"), PendingPayloads.Num());
+		// Nobody has subscribed yet; new subscribers start live (or replay with since=), so just advance.
+		FScopeLock EventLock(&RuntimeEventQueueMutex);
+		RuntimeEventPumpedSeq = FMath::Max(RuntimeEventPumpedSeq, RuntimeEventRing.GetStats().HeadSeq);
+		return;
 	}
 
-	for (int32 PayloadIndex = 0; PayloadIndex < PendingPayloads.Num(); ++PayloadIndex)
+	TArray<NovaBridgeCore::FEventRecord> Events;
+	RuntimeEventRing.CopySince(OldestCursor, Events);
+	if (Events.Num() == 0)
 	{
-		const FString& Payload = PendingPayloads[PayloadIndex];
-		const FString& PayloadType = PendingTypes.IsValidIndex(PayloadIndex) && !PendingTypes[PayloadIndex].IsEmpty()
-			? PendingTypes[PayloadIndex]
-			: TEXT("audit");
+		return;
+	}
 
-		const FTCHARToUTF8 Utf8Payload(*Payload);
-		const uint8* Data = reinterpret_cast<const uint8*>(Utf8Payload.Get());
-		uint8* MutableData = const_cast<uint8*>(Data);
-		const int32 DataLen = Utf8Payload.Length();
+	uint64 Sends = 0;
+	for (const NovaBridgeCore::FEventRecord& Event : Events)
+	{
+		if (!Event.Payload.IsValid())
+		{
+			continue;
+		}
 
-		for (int32 ClientIndex = EventWsClients.Num() - 1; ClientIndex >= 0; --ClientIndex)
+		// The socket API takes a mutable pointer but does not modify the buffer, so every client shares it.
+		uint8* Data = const_cast<uint8*>(Event.Payload->Utf8.GetData());
+		const int32 DataLen = Event.Payload->Utf8.Num();
+		const FString& PayloadType = Event.Payload->Type;
+		for (FWsClient& Client : EventWsClients)
 		{
-			if (!EventWsClients[ClientIndex].Socket)
+			if (!Client.bSubscriptionConfirmed || Event.Seq <= Client.LastEventSeq)
 			{
-				EventWsClients.RemoveAtSwap(ClientIndex);
 				continue;
 			}
-			if (!EventWsClients[ClientIndex].bSubscriptionConfirmed)
-			{
-				continue;
-			}
-			if (EventWsClients[ClientIndex].bEventTypeFilterEnabled
-				&& !EventWsClients[ClientIndex].EventTypes.Contains(PayloadType))
+			if (Client.bEventTypeFilterEnabled && !Client.EventTypes.Contains(PayloadType))
 			{
 				continue;
 			}
+			Client.Socket->Send(Data, DataLen, false);
+			Sends++;
+		}
+	}
+	RuntimeEventRing.RecordFanoutSends(Sends);
 
-			EventWsClients[ClientIndex].Socket->Send(MutableData, DataLen, false);
+	const uint64 LastSeq = Events.Last().Seq;
+	for (FWsClient& Client : EventWsClients)
+	{
+		if (Client.bSubscriptionConfirmed)
+		{
+			Client.LastEventSeq = FMath::Max(Client.LastEventSeq, LastSeq);
 		}
 	}
+	FScopeLock EventLock(&RuntimeEventQueueMutex);
+	RuntimeEventPumpedSeq = FMath::Max(RuntimeEventPumpedSeq, LastSeq);
 #endif
 }
 
@@ -367,9 +417,9 @@ bool FNovaBridgeRuntimeModule::HandleEvents(const FHttpServerRequest& Request, c
 	TArray<FString> PendingTypesSnapshot;
 	{
 		FScopeLock Lock(&RuntimeEventQueueMutex);
-		PendingEvents = RuntimePendingEventPayloads.Num();
-		PendingTypesSnapshot = RuntimePendingEventTypes;
+		RuntimeEventRing.CopyTypesSince(RuntimeEventPumpedSeq, PendingTypesSnapshot);
 	}
+	PendingEvents = PendingTypesSnapshot.Num();
 
 	TMap<FString, int32> PendingByType;
 	for (const FString& PendingType : PendingTypesSnapshot)
@@ -422,6 +472,20 @@ bool FNovaBridgeRuntimeModule::HandleEvents(const FHttpServerRequest& Request, c
 	Result->SetNumberField(TEXT("clients_pending_subscription"), PendingSubscriptionClients);
 	Result->SetNumberField(TEXT("pending_events"), PendingEvents);
 	Result->SetNumberField(TEXT("filtered_pending_events"), FilteredPendingEvents);
+	const NovaBridgeCore::FEventRingStats EventStats = RuntimeEventRing.GetStats();
+	Result->SetNumberField(TEXT("head_seq"), static_cast<double>(EventStats.HeadSeq));
+	Result->SetNumberField(TEXT("tail_seq"), static_cast<double>(EventStats.TailSeq));
+	Result->SetNumberField(TEXT("retained_events"), EventStats.Count);
+	Result->SetNumberField(TEXT("queue_capacity"), EventStats.Capacity);
+	Result->SetNumberField(TEXT("dropped_events"), static_cast<double>(EventStats.Dropped));
+
+	const double EncodedEvents = static_cast<double>(EventStats.EncodedEvents);
+	TSharedPtr<FJsonObject> EncodingObj = MakeShared<FJsonObject>();
+	EncodingObj->SetNumberField(TEXT("events_encoded"), EncodedEvents);
+	EncodingObj->SetNumberField(TEXT("payload_bytes"), static_cast<double>(EventStats.PayloadBytes));
+	EncodingObj->SetNumberField(TEXT("fanout_sends"), static_cast<double>(EventStats.FanoutSends));
+	EncodingObj->SetNumberField(TEXT("sends_per_event"), EncodedEvents > 0.0 ? static_cast<double>(EventStats.FanoutSends) / EncodedEvents : 0.0);
+	Result->SetObjectField(TEXT("encoding"), EncodingObj);
 	Result->SetArrayField(TEXT("supported_types"), MakeJsonStringArray(SupportedRuntimeEventTypes()));
 	Result->SetStringField(TEXT("subscription_action"), TEXT("{\"action\":\"subscribe\",\"types\":[\"spawn\",\"error\"]}"));
 	if (FilterTypes.Num() > 0)
@@ -1,4 +1,5 @@
 #include "NovaBridgeRuntimeModule.h"
+#include "NovaBridgeRuntimeInternals.h"
 
 #include "NovaBridgePlanDispatch.h"
 #include "NovaBridgePlanEvents.h"
@@ -12,7 +13,6 @@
 #include "Engine/GameViewportClient.h"
 #include "Engine/StaticMeshActor.h"
 #include "Engine/World.h"
-#include "EngineUtils.h"
 #include "GameFramework/Actor.h"
 #include "HAL/PlatformTime.h"
 #include "IImageWrapper.h"
@@ -54,24 +54,7 @@ UWorld* ResolveRuntimeWorld()
 
 AActor* FindActorByNameRuntime(UWorld* World, const FString& Name)
 {
-	if (!World || Name.IsEmpty())
-	{
-		return nullptr;
-	}
-
-	for (TActorIterator<AActor> It(World); It; ++It)
-	{
-		AActor* Actor = *It;
-		if (!Actor)
-		{
-			continue;
-		}
-		if (Actor->GetName() == Name)
-		{
-			return Actor;
-		}
-	}
-	return nullptr;
+	return FindIndexedRuntimeActor(World, Name, false);
 }
 
 const TArray<FString>& RuntimeAllowedClasses()
@@ -381,22 +364,13 @@ bool FNovaBridgeRuntimeModule::HandleExecutePlan(const FHttpServerRequest& Reque
 	const FString ResolvedRole = ResolveRuntimeRoleFromRequest(Request);
 	const int32 ExecutePlanLimit = GetRuntimeRouteRateLimitPerMinute(ResolvedRole, TEXT("/nova/executePlan"));
 
+	NovaBridgeCore::FRateLimitDecision PlanRateDecision;
+	FString PlanRateError;
+	if (!ConsumeRuntimeRouteRateLimit(RuntimeExecutePlanRateRouteId, NovaBridgeCore::FTokenBucketRateLimiter::RoleSlotForName(ResolvedRole), ExecutePlanLimit, PlanRateDecision, PlanRateError))
 	{
-		const double NowSec = FPlatformTime::Seconds();
-		FScopeLock Lock(&RuntimeExecutePlanRateLimitMutex);
-		if (RuntimeExecutePlanWindowStartSec <= 0.0 || (NowSec - RuntimeExecutePlanWindowStartSec) >= 60.0)
-		{
-			RuntimeExecutePlanWindowStartSec = NowSec;
-			RuntimeExecutePlanCountInWindow = 0;
-		}
-
-		RuntimeExecutePlanCountInWindow++;
-		if (RuntimeExecutePlanCountInWindow > ExecutePlanLimit)
-		{
-			PushAuditEntry(TEXT("/nova/executePlan"), TEXT("executePlan"), TEXT("rate_limited"), TEXT("Runtime executePlan per-minute limit exceeded"));
-			SendErrorResponse(OnComplete, FString::Printf(TEXT("Rate limit: max %d runtime executePlan requests per minute"), ExecutePlanLimit), 429);
-			return true;
-		}
+		PushAuditEntry(TEXT("/nova/executePlan"), TEXT("executePlan"), TEXT("rate_limited"), TEXT("Runtime executePlan per-minute limit exceeded"));
+		SendErrorResponse(OnComplete, FString::Printf(TEXT("Rate limit: max %d runtime executePlan requests per minute"), ExecutePlanLimit), 429);
+		return true;
 	}
 
 	const TSharedPtr<FJsonObject> Body = ParseRequestBody(Request);
@@ -259,25 +259,40 @@ int32 FNovaBridgeRuntimeModule::GetRuntimeRouteRateLimitPerMinute(const FString&
 	return 0;
 }
 
-bool FNovaBridgeRuntimeModule::ConsumeRuntimeRouteRateLimit(const FString& BucketKey, const int32 LimitPerMinute, FString& OutError)
+const NovaBridgeCore::FRoutePolicy* FNovaBridgeRuntimeModule::CompileRuntimeRoutePolicy(const FString& RoutePath)
 {
-	if (LimitPerMinute <= 0)
+	NovaBridgeCore::FRoutePolicy Policy;
+	Policy.Path = RoutePath;
+	Policy.RateRouteId = RuntimeRateLimiter.RegisterRoute(RoutePath);
+	Policy.bReadOnly = IsRuntimeReadOnlyRoute(RoutePath);
+	for (int32 RoleSlot = 0; RoleSlot < NovaBridgeCore::FTokenBucketRateLimiter::RoleSlotCount; ++RoleSlot)
 	{
-		OutError = TEXT("Rate limit denied for this runtime role/action");
-		return false;
+		const FString Role = NovaBridgeCore::FRoutePolicyTable::RoleNameForSlot(RoleSlot);
+		FString IgnoredReason;
+		if (IsRuntimeRouteAllowedForRole(Role, RoutePath, EHttpServerRequestVerbs::VERB_GET, IgnoredReason))
+		{
+			Policy.ReadRoleMask |= static_cast<uint8>(1u << RoleSlot);
+		}
+		if (IsRuntimeRouteAllowedForRole(Role, RoutePath, EHttpServerRequestVerbs::VERB_POST, IgnoredReason))
+		{
+			Policy.WriteRoleMask |= static_cast<uint8>(1u << RoleSlot);
+		}
+		Policy.RateLimitPerMinute[RoleSlot] = GetRuntimeRouteRateLimitPerMinute(Role, RoutePath);
 	}
+	return RuntimeRoutePolicies.Add(Policy);
+}
 
-	const double NowSec = FPlatformTime::Seconds();
-	FScopeLock Lock(&RuntimeRouteRateLimitMutex);
-	FRuntimeRateBucket& Bucket = RuntimeRouteRateBuckets.FindOrAdd(BucketKey);
-	if (Bucket.WindowStartSec <= 0.0 || (NowSec - Bucket.WindowStartSec) >= 60.0)
+bool FNovaBridgeRuntimeModule::ConsumeRuntimeRouteRateLimit(const int32 RouteId, const int32 RoleSlot, const int32 LimitPerMinute, NovaBridgeCore::FRateLimitDecision& OutDecision, FString& OutError)
+{
+	if (LimitPerMinute <= 0)
 	{
-		Bucket.WindowStartSec = NowSec;
-		Bucket.Count = 0;
+		OutDecision = NovaBridgeCore::FRateLimitDecision();
+		OutError = TEXT("Rate limit denied for this runtime role/action");
+		return false;
 	}
 
-	Bucket.Count++;
-	if (Bucket.Count > LimitPerMinute)
+	OutDecision = RuntimeRateLimiter.Consume(RouteId, RoleSlot, LimitPerMinute, FPlatformTime::Seconds());
+	if (!OutDecision.bAllowed)
 	{
 		OutError = FString::Printf(TEXT("Rate limit: max %d requests/minute for this runtime role/action"), LimitPerMinute);
 		return false;
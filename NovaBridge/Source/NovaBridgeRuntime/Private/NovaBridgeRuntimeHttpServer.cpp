@@ -41,19 +41,13 @@ void FNovaBridgeRuntimeModule::StartHttpServer()
 		FScopeLock AuditLock(&RuntimeAuditMutex);
 		RuntimeAuditTrail.Empty();
 	}
-	{
-		FScopeLock EventLock(&RuntimeEventQueueMutex);
-		RuntimePendingEventPayloads.Empty();
-		RuntimePendingEventTypes.Empty();
-	}
+	RuntimeEventRing.Reset();
 	{
 		FScopeLock UndoLock(&RuntimeUndoMutex);
 		RuntimeUndoStack.Empty();
 	}
-	{
-		FScopeLock RateLock(&RuntimeRouteRateLimitMutex);
-		RuntimeRouteRateBuckets.Empty();
-	}
+	RuntimeRateLimiter.Reset();
+	RuntimeExecutePlanRateRouteId = RuntimeRateLimiter.RegisterRoute(TEXT("plan.execute"));
 	{
 		FScopeLock ActorLock(&RuntimeActorCountMutex);
 		RuntimeActiveActorCount = 0;
@@ -178,10 +172,11 @@ void FNovaBridgeRuntimeModule::StartHttpServer()
 	auto Bind = [this](const TCHAR* Path, EHttpServerRequestVerbs Verbs, bool bRequireAuth, bool (FNovaBridgeRuntimeModule::*Handler)(const FHttpServerRequest&, const FHttpResultCallback&))
 	{
 		const FString RoutePath(Path);
+		const NovaBridgeCore::FRoutePolicy* Policy = CompileRuntimeRoutePolicy(RoutePath);
 		ApiRouteCount++;
 		RouteHandles.Add(HttpRouter->BindRoute(
 			FHttpPath(Path), Verbs,
-			FHttpRequestHandler::CreateLambda([this, Handler, bRequireAuth, RoutePath](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) -> bool
+			FHttpRequestHandler::CreateLambda([this, Handler, bRequireAuth, RoutePath, Policy](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) -> bool
 			{
 				if (!bRuntimeEnabled)
 				{
@@ -203,40 +198,29 @@ void FNovaBridgeRuntimeModule::StartHttpServer()
 					return true;
 				}
 
+				FHttpResultCallback RouteOnComplete = OnComplete;
 				if (bRequireAuth)
 				{
-					FString RoutePermissionError;
-					if (!IsRuntimeRouteAllowedForRole(ResolvedRole, RoutePath, Request.Verb, RoutePermissionError))
+					const int32 RoleSlot = NovaBridgeCore::FTokenBucketRateLimiter::RoleSlotForName(ResolvedRole);
+					if (!Policy->Allows(RoleSlot, Request.Verb))
 					{
+						// Denials are rare, so only they pay for the descriptive string checks.
+						FString RoutePermissionError;
+						IsRuntimeRouteAllowedForRole(ResolvedRole, RoutePath, Request.Verb, RoutePermissionError);
 						PushAuditEntry(RoutePath, RoutePath, TEXT("denied"),
 							FString::Printf(TEXT("Role '%s' denied: %s"), *ResolvedRole, *RoutePermissionError));
 						SendErrorResponse(OnComplete, TEXT("Permission denied for runtime role on this endpoint"), 403);
 						return true;
 					}
 
-					FString PresentedToken = NovaBridgeCore::GetHeaderValueCaseInsensitive(Request, TEXT("X-NovaBridge-Token"));
-					if (PresentedToken.IsEmpty())
-					{
-						const FString Authorization = NovaBridgeCore::GetHeaderValueCaseInsensitive(Request, TEXT("Authorization"));
-						static const FString BearerPrefix = TEXT("Bearer ");
-						if (Authorization.StartsWith(BearerPrefix, ESearchCase::IgnoreCase))
-						{
-							PresentedToken = Authorization.Mid(BearerPrefix.Len());
-						}
-					}
-					PresentedToken.TrimStartAndEndInline();
-					if (PresentedToken.IsEmpty())
-					{
-						PresentedToken = RuntimeToken;
-					}
-
-					const int32 RateLimit = GetRuntimeRouteRateLimitPerMinute(ResolvedRole, RoutePath);
-					const FString RateBucket = PresentedToken + TEXT("|") + ResolvedRole + TEXT("|") + RoutePath;
+					NovaBridgeCore::FRateLimitDecision RateDecision;
 					FString RateError;
-					if (!ConsumeRuntimeRouteRateLimit(RateBucket, RateLimit, RateError))
+					const bool bRateAllowed = ConsumeRuntimeRouteRateLimit(Policy->RateRouteId, RoleSlot, Policy->RateLimitFor(RoleSlot), RateDecision, RateError);
+					RouteOnComplete = NovaBridgeCore::WrapResultCallbackWithRateLimitHeaders(RateDecision, OnComplete);
+					if (!bRateAllowed)
 					{
 						PushAuditEntry(RoutePath, RoutePath, TEXT("rate_limited"), RateError);
-						SendErrorResponse(OnComplete, RateError, 429);
+						SendErrorResponse(RouteOnComplete, RateError, 429);
 						return true;
 					}
 				}
@@ -245,7 +229,7 @@ void FNovaBridgeRuntimeModule::StartHttpServer()
 					*FDateTime::Now().ToString(),
 					HttpVerbToString(Request.Verb),
 					*Request.RelativePath.GetPath());
-				return (this->*Handler)(Request, OnComplete);
+				return (this->*Handler)(Request, RouteOnComplete);
 			})
 		));
 
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UWorld;
+
+// Actor index: name and label lookups against a per-world index kept current by actor spawn, destroy and label delegates.
+void StartRuntimeActorIndex();
+void StopRuntimeActorIndex();
+AActor* FindIndexedRuntimeActor(UWorld* World, const FString& Name, bool bMatchLabel);
@@ -1,4 +1,5 @@
 #include "NovaBridgeRuntimeModule.h"
+#include "NovaBridgeRuntimeInternals.h"
 
 #if NOVABRIDGE_WITH_WEBSOCKET_NETWORKING
 #include "IWebSocketServer.h"
@@ -21,12 +22,17 @@ void FNovaBridgeRuntimeModule::StartupModule()
 	}
 
 	bRuntimeEnabled = true;
+	StartRuntimeActorIndex();
 	StartHttpServer();
 }
 
 void FNovaBridgeRuntimeModule::ShutdownModule()
 {
 	StopHttpServer();
+	if (bRuntimeEnabled)
+	{
+		StopRuntimeActorIndex();
+	}
 	bRuntimeEnabled = false;
 }
 
@@ -32,22 +32,19 @@ void FNovaBridgeRuntimeModule::QueueRuntimeEvent(const TSharedPtr<FJsonObject>&
 		EventObj->SetStringField(TEXT("timestamp_utc"), FDateTime::UtcNow().ToIso8601());
 	}
 
-	const FString EventType = NormalizeEventType(EventObj->GetStringField(TEXT("type")));
-	FString SerializedEvent;
+	FString EventType = NormalizeEventType(EventObj->GetStringField(TEXT("type")));
+	if (EventType.IsEmpty())
 	{
-		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&SerializedEvent);
-		FJsonSerializer::Serialize(EventObj.ToSharedRef(), Writer);
+		EventType = TEXT("audit");
 	}
-
-	FScopeLock EventLock(&RuntimeEventQueueMutex);
-	RuntimePendingEventPayloads.Add(MoveTemp(SerializedEvent));
-	RuntimePendingEventTypes.Add(EventType);
-	if (RuntimePendingEventPayloads.Num() > RuntimePendingEventsLimit)
+	RuntimeEventRing.Push(EventType, [&EventObj](uint64 Seq)
 	{
-		const int32 RemoveCount = RuntimePendingEventPayloads.Num() - RuntimePendingEventsLimit;
-		RuntimePendingEventPayloads.RemoveAt(0, RemoveCount, EAllowShrinking::No);
-		RuntimePendingEventTypes.RemoveAt(0, RemoveCount, EAllowShrinking::No);
-	}
+		EventObj->SetNumberField(TEXT("seq"), static_cast<double>(Seq));
+		FString SerializedEvent;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&SerializedEvent);
+		FJsonSerializer::Serialize(EventObj.ToSharedRef(), Writer);
+		return SerializedEvent;
+	});
 }
 
 void FNovaBridgeRuntimeModule::PushAuditEntry(const FString& Route, const FString& Action, const FString& Status, const FString& Message)
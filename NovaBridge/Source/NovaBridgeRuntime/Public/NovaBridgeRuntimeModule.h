@@ -2,6 +2,9 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "NovaBridgeEventRing.h"
+#include "NovaBridgeRateLimiter.h"
+#include "NovaBridgeRoutePolicy.h"
 #include "HttpRouteHandle.h"
 #include "HttpServerRequest.h"
 #include "HttpServerResponse.h"
@@ -40,7 +43,8 @@ private:
 	FString ResolveRuntimeRoleFromRequest(const FHttpServerRequest& Request) const;
 	bool IsRuntimeRouteAllowedForRole(const FString& Role, const FString& RoutePath, EHttpServerRequestVerbs Verb, FString& OutReason) const;
 	int32 GetRuntimeRouteRateLimitPerMinute(const FString& Role, const FString& RoutePath) const;
-	bool ConsumeRuntimeRouteRateLimit(const FString& BucketKey, int32 LimitPerMinute, FString& OutError);
+	const NovaBridgeCore::FRoutePolicy* CompileRuntimeRoutePolicy(const FString& RoutePath);
+	bool ConsumeRuntimeRouteRateLimit(int32 RouteId, int32 RoleSlot, int32 LimitPerMinute, NovaBridgeCore::FRateLimitDecision& OutDecision, FString& OutError);
 	void QueueRuntimeEvent(const TSharedPtr<FJsonObject>& EventObj);
 	void PushAuditEntry(const FString& Route, const FString& Action, const FString& Status, const FString& Message);
 	void PushRuntimeUndoEntry(const FString& Action, const FString& ActorName, const FString& ActorLabel);
@@ -88,9 +92,6 @@ private:
 	mutable FCriticalSection RuntimeActorCountMutex;
 	int32 RuntimeActiveActorCount = 0;
 
-	mutable FCriticalSection RuntimeExecutePlanRateLimitMutex;
-	double RuntimeExecutePlanWindowStartSec = 0.0;
-	int32 RuntimeExecutePlanCountInWindow = 0;
 	int32 MaxExecutePlanPerMinute = 30;
 	int32 MaxAdminExecutePlanPerMinute = 30;
 	int32 MaxAutomationExecutePlanPerMinute = 20;
@@ -99,13 +100,10 @@ private:
 	int32 MaxAutomationRequestsPerMinute = 120;
 	int32 MaxReadOnlyRequestsPerMinute = 120;
 
-	struct FRuntimeRateBucket
-	{
-		double WindowStartSec = 0.0;
-		int32 Count = 0;
-	};
-	mutable FCriticalSection RuntimeRouteRateLimitMutex;
-	TMap<FString, FRuntimeRateBucket> RuntimeRouteRateBuckets;
+	// Only one runtime token is valid at a time and pairing resets the buckets, so role + route is enough.
+	NovaBridgeCore::FTokenBucketRateLimiter RuntimeRateLimiter;
+	NovaBridgeCore::FRoutePolicyTable RuntimeRoutePolicies;
+	int32 RuntimeExecutePlanRateRouteId = INDEX_NONE;
 
 	struct FWsClient
 	{
@@ -114,15 +112,15 @@ private:
 		bool bSubscriptionConfirmed = false;
 		bool bEventTypeFilterEnabled = false;
 		TSet<FString> EventTypes;
+		uint64 LastEventSeq = 0;
 	};
 	TUniquePtr<IWebSocketServer> EventWsServer;
 	TArray<FWsClient> EventWsClients;
 	uint32 EventWsPort = 30022;
 	FTSTicker::FDelegateHandle EventWsServerTickHandle;
+	NovaBridgeCore::FEventRing RuntimeEventRing { 2048 };
 	mutable FCriticalSection RuntimeEventQueueMutex;
-	TArray<FString> RuntimePendingEventPayloads;
-	TArray<FString> RuntimePendingEventTypes;
-	int32 RuntimePendingEventsLimit = 2048;
+	uint64 RuntimeEventPumpedSeq = 0;
 
 	struct FRuntimeAuditEntry
 	{
@@ -8,14 +8,121 @@ from __future__ import annotations
 import base64
 import json
 import os
+import struct
 import time
 import urllib.error
 import urllib.parse
 import urllib.request
+import zlib
 from dataclasses import dataclass
 from typing import Any, Dict, Optional
 
 
+def _scene_list_params(
+    cursor: Optional[str],
+    limit: Optional[int],
+    class_name: Optional[str],
+    tag: Optional[str],
+    fields: Optional[str],
+) -> Dict[str, Any]:
+    params: Dict[str, Any] = {}
+    if cursor:
+        params["cursor"] = cursor
+    if limit is not None:
+        params["limit"] = int(limit)
+    if class_name:
+        params["class"] = class_name
+    if tag:
+        params["tag"] = tag
+    if fields:
+        params["fields"] = fields
+    return params
+
+
+def _scene_query_body(
+    box: Optional[Dict[str, Any]],
+    sphere: Optional[Dict[str, Any]],
+    frustum: Optional[Dict[str, Any]],
+    classes: Optional[Any],
+    tag: Optional[str],
+    limit: Optional[int],
+    fields: Optional[str],
+) -> Dict[str, Any]:
+    body: Dict[str, Any] = {}
+    for key, value in (("box", box), ("sphere", sphere), ("frustum", frustum), ("tag", tag), ("fields", fields)):
+        if value:
+            body[key] = value
+    if classes:
+        body["classes"] = [classes] if isinstance(classes, str) else list(classes)
+    if limit is not None:
+        body["limit"] = int(limit)
+    return body
+
+
+
+def _scene_get_many_body(
+    properties: Any,
+    names: Optional[Any],
+    class_name: Optional[str],
+    tag: Optional[str],
+    limit: Optional[int],
+    cursor: Optional[str],
+    fields: Optional[str],
+) -> Dict[str, Any]:
+    body: Dict[str, Any] = {"properties": [properties] if isinstance(properties, str) else list(properties)}
+    if names:
+        body["names"] = [names] if isinstance(names, str) else list(names)
+    for key, value in (("class", class_name), ("tag", tag), ("cursor", cursor), ("fields", fields)):
+        if value:
+            body[key] = value
+    if limit is not None:
+        body["limit"] = int(limit)
+    return body
+
+
+_TRANSFORM_AXES = {"location": ("x", "y", "z"), "rotation": ("pitch", "yaw", "roll"), "scale": ("x", "y", "z")}
+
+
+def _pack_transform_batch(updates: Any) -> bytes:
+    """Encodes transform-batch updates in the packed 'NBTX' body format."""
+    updates = list(updates)
+    chunks = [b"NBTX", struct.pack("<III", 1, 0, len(updates))]
+    for update in updates:
+        fields = 0
+        values = [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0]
+        for bit, (key, axes) in enumerate(_TRANSFORM_AXES.items()):
+            value = update.get(key)
+            if value is None:
+                continue
+            triple = [value[axis] for axis in axes] if isinstance(value, dict) else list(value)
+            values[bit * 3 : bit * 3 + 3] = [float(component) for component in triple]
+            fields |= 1 << bit
+        name = str(update["name"]).encode("utf-8")
+        chunks.append(struct.pack("<I9fI", fields, *values, len(name)))
+        chunks.append(name)
+    return b"".join(chunks)
+
+
+def _read_body(resp: Any) -> bytes:
+    payload = resp.read()
+    headers = getattr(resp, "headers", None)
+    encoding = (headers.get("Content-Encoding", "") if headers is not None else "").strip().lower()
+    if encoding == "gzip":
+        return zlib.decompress(payload, 16 + zlib.MAX_WBITS)
+    if encoding == "deflate":
+        return zlib.decompress(payload)
+    return payload
+
+
+def _retry_delay(headers: Any, backoff: float, attempt: int) -> float:
+    delay = backoff * (2**attempt)
+    retry_after = headers.get("Retry-After") if headers is not None else None
+    try:
+        return max(delay, float(retry_after)) if retry_after else delay
+    except ValueError:
+        return delay
+
+
 class NovaBridgeError(RuntimeError):
     """Raised when NovaBridge returns an HTTP or protocol error."""
 
@@ -32,6 +139,10 @@ class NovaBridge:
     runtime_token: Optional[str] = None
     max_retries: int = 2
     retry_backoff: float = 0.25
+    compact: bool = False
+    compact_precision: Optional[int] = None
+    compress: bool = False
+    deadline_ms: Optional[int] = None
 
     @property
     def base_url(self) -> str:
@@ -57,6 +168,15 @@ class NovaBridge:
         effective_runtime_token = runtime_token if runtime_token is not None else self.runtime_token
         if effective_runtime_token:
             headers["X-NovaBridge-Token"] = effective_runtime_token
+        if self.compact:
+            accept = "application/json; profile=compact"
+            if self.compact_precision is not None:
+                accept += f"; precision={int(self.compact_precision)}"
+            headers["Accept"] = accept
+        if self.compress:
+            headers["Accept-Encoding"] = "gzip, deflate"
+        if self.deadline_ms is not None:
+            headers["X-NovaBridge-Deadline"] = str(int(self.deadline_ms))
         return headers
 
     def _request(
@@ -67,10 +187,15 @@ class NovaBridge:
         *,
         role: Optional[str] = None,
         runtime_token: Optional[str] = None,
+        raw: Optional[bytes] = None,
     ) -> Dict[str, Any]:
         body = None
         headers = self._build_headers(role=role, runtime_token=runtime_token)
-        if data is not None:
+        if raw is not None:
+            body = raw
+            headers["Content-Type"] = "application/octet-stream"
+            headers["Content-Length"] = str(len(body))
+        elif data is not None:
             body = json.dumps(data).encode("utf-8")
             headers["Content-Type"] = "application/json"
             headers["Content-Length"] = str(len(body))
@@ -85,14 +210,14 @@ class NovaBridge:
             )
             try:
                 with urllib.request.urlopen(req, timeout=self.timeout) as resp:
-                    payload = resp.read()
+                    payload = _read_body(resp)
                     if not payload:
                         return {"status": "ok"}
                     return json.loads(payload)
             except urllib.error.HTTPError as exc:
                 detail = exc.read().decode("utf-8", errors="replace")
                 if exc.code in (429, 500, 502, 503, 504) and attempt < retries:
-                    time.sleep(self.retry_backoff * (2**attempt))
+                    time.sleep(_retry_delay(exc.headers, self.retry_backoff, attempt))
                     continue
                 raise NovaBridgeError(f"HTTP {exc.code}: {detail}") from exc
             except urllib.error.URLError as exc:
@@ -122,11 +247,11 @@ class NovaBridge:
             )
             try:
                 with urllib.request.urlopen(req, timeout=self.timeout) as resp:
-                    return resp.read()
+                    return _read_body(resp)
             except urllib.error.HTTPError as exc:
                 detail = exc.read().decode("utf-8", errors="replace")
                 if exc.code in (429, 500, 502, 503, 504) and attempt < retries:
-                    time.sleep(self.retry_backoff * (2**attempt))
+                    time.sleep(_retry_delay(exc.headers, self.retry_backoff, attempt))
                     continue
                 raise NovaBridgeError(f"HTTP {exc.code}: {detail}") from exc
             except urllib.error.URLError as exc:
@@ -261,6 +386,15 @@ class NovaBridge:
     def undo(self, *, role: Optional[str] = None) -> Dict[str, Any]:
         return self._post("/undo", {}, role=role)
 
+    def batch(
+        self,
+        requests: Any,
+        *,
+        stop_on_error: bool = False,
+        role: Optional[str] = None,
+    ) -> Dict[str, Any]:
+        return self._post("/batch", {"requests": requests, "stop_on_error": stop_on_error}, role=role)
+
     def runtime_pair(self, code: str, *, role: Optional[str] = None) -> Dict[str, Any]:
         body: Dict[str, Any] = {"code": code}
         if role:
@@ -271,8 +405,37 @@ class NovaBridge:
             self.runtime_token = token
         return result
 
-    def scene_list(self) -> Dict[str, Any]:
-        return self._get("/scene/list")
+    def scene_list(
+        self,
+        *,
+        cursor: Optional[str] = None,
+        limit: Optional[int] = None,
+        class_name: Optional[str] = None,
+        tag: Optional[str] = None,
+        fields: Optional[str] = None,
+    ) -> Dict[str, Any]:
+        params = _scene_list_params(cursor, limit, class_name, tag, fields)
+        return self._get("/scene/list", params or None)
+
+    def scene_changes(self, since: int, *, fields: Optional[str] = None) -> Dict[str, Any]:
+        params: Dict[str, Any] = {"since": int(since)}
+        if fields:
+            params["fields"] = fields
+        return self._get("/scene/changes", params)
+
+    def scene_query(
+        self,
+        *,
+        box: Optional[Dict[str, Any]] = None,
+        sphere: Optional[Dict[str, Any]] = None,
+        frustum: Optional[Dict[str, Any]] = None,
+        classes: Optional[Any] = None,
+        tag: Optional[str] = None,
+        limit: Optional[int] = None,
+        fields: Optional[str] = None,
+    ) -> Dict[str, Any]:
+        body = _scene_query_body(box, sphere, frustum, classes, tag, limit, fields)
+        return self._post("/scene/query", body)
 
     def spawn(
         self,
@@ -319,9 +482,28 @@ class NovaBridge:
             data["scale"] = scale
         return self._post("/scene/transform", data)
 
+    def transform_batch(self, updates: Any, *, binary: bool = False) -> Dict[str, Any]:
+        if binary:
+            return self._request("POST", "/scene/transform-batch", raw=_pack_transform_batch(updates))
+        return self._post("/scene/transform-batch", {"updates": list(updates)})
+
     def get_actor(self, name: str) -> Dict[str, Any]:
         return self._post("/scene/get", {"name": name})
 
+    def scene_get_many(
+        self,
+        properties: Any,
+        *,
+        names: Optional[Any] = None,
+        class_name: Optional[str] = None,
+        tag: Optional[str] = None,
+        limit: Optional[int] = None,
+        cursor: Optional[str] = None,
+        fields: Optional[str] = None,
+    ) -> Dict[str, Any]:
+        body = _scene_get_many_body(properties, names, class_name, tag, limit, cursor, fields)
+        return self._post("/scene/get-many", body)
+
     def set_property(self, name: str, prop: str, value: Any) -> Dict[str, Any]:
         return self._post("/scene/set-property", {"name": name, "property": prop, "value": str(value)})
 
@@ -4,6 +4,7 @@ from __future__ import annotations
 
 import asyncio
 import json
+import struct
 import urllib.parse
 from dataclasses import dataclass
 from typing import Any, Dict, Optional
@@ -11,6 +12,99 @@ from typing import Any, Dict, Optional
 import aiohttp
 
 
+def _scene_list_params(
+    cursor: Optional[str],
+    limit: Optional[int],
+    class_name: Optional[str],
+    tag: Optional[str],
+    fields: Optional[str],
+) -> Dict[str, Any]:
+    params: Dict[str, Any] = {}
+    if cursor:
+        params["cursor"] = cursor
+    if limit is not None:
+        params["limit"] = int(limit)
+    if class_name:
+        params["class"] = class_name
+    if tag:
+        params["tag"] = tag
+    if fields:
+        params["fields"] = fields
+    return params
+
+
+def _scene_query_body(
+    box: Optional[Dict[str, Any]],
+    sphere: Optional[Dict[str, Any]],
+    frustum: Optional[Dict[str, Any]],
+    classes: Optional[Any],
+    tag: Optional[str],
+    limit: Optional[int],
+    fields: Optional[str],
+) -> Dict[str, Any]:
+    body: Dict[str, Any] = {}
+    for key, value in (("box", box), ("sphere", sphere), ("frustum", frustum), ("tag", tag), ("fields", fields)):
+        if value:
+            body[key] = value
+    if classes:
+        body["classes"] = [classes] if isinstance(classes, str) else list(classes)
+    if limit is not None:
+        body["limit"] = int(limit)
+    return body
+
+
+def _scene_get_many_body(
+    properties: Any,
+    names: Optional[Any],
+    class_name: Optional[str],
+    tag: Optional[str],
+    limit: Optional[int],
+    cursor: Optional[str],
+    fields: Optional[str],
+) -> Dict[str, Any]:
+    body: Dict[str, Any] = {"properties": [properties] if isinstance(properties, str) else list(properties)}
+    if names:
+        body["names"] = [names] if isinstance(names, str) else list(names)
+    for key, value in (("class", class_name), ("tag", tag), ("cursor", cursor), ("fields", fields)):
+        if value:
+            body[key] = value
+    if limit is not None:
+        body["limit"] = int(limit)
+    return body
+
+
+_TRANSFORM_AXES = {"location": ("x", "y", "z"), "rotation": ("pitch", "yaw", "roll"), "scale": ("x", "y", "z")}
+
+
+def _pack_transform_batch(updates: Any) -> bytes:
+    """Encodes transform-batch updates in the packed 'NBTX' body format."""
+    updates = list(updates)
+    chunks = [b"NBTX", struct.pack("<III", 1, 0, len(updates))]
+    for update in updates:
+        fields = 0
+        values = [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0]
+        for bit, (key, axes) in enumerate(_TRANSFORM_AXES.items()):
+            value = update.get(key)
+            if value is None:
+                continue
+            triple = [value[axis] for axis in axes] if isinstance(value, dict) else list(value)
+            values[bit * 3 : bit * 3 + 3] = [float(component) for component in triple]
+            fields |= 1 << bit
+        name = str(update["name"]).encode("utf-8")
+        chunks.append(struct.pack("<I9fI", fields, *values, len(name)))
+        chunks.append(name)
+    return b"".join(chunks)
+
+
+def _retry_delay(headers: Any, backoff: float, attempt: int) -> float:
+    delay = backoff * (2**attempt)
+    retry_after = headers.get("Retry-After") if headers is not None else None
+    try:
+        return max(delay, float(retry_after)) if retry_after else delay
+    except ValueError:
+        return delay
+
+
 class AsyncNovaBridgeError(RuntimeError):
     """Raised when async NovaBridge requests fail."""
 
@@ -27,6 +121,9 @@ class AsyncNovaBridge:
     runtime_token: Optional[str] = None
     max_retries: int = 2
     retry_backoff: float = 0.25
+    compact: bool = False
+    compact_precision: Optional[int] = None
+    deadline_ms: Optional[int] = None
 
     _session: Optional[aiohttp.ClientSession] = None
     _owns_session: bool = False
@@ -76,6 +173,13 @@ class AsyncNovaBridge:
         effective_token = runtime_token if runtime_token is not None else self.runtime_token
         if effective_token:
             headers["X-NovaBridge-Token"] = effective_token
+        if self.compact:
+            accept = "application/json; profile=compact"
+            if self.compact_precision is not None:
+                accept += f"; precision={int(self.compact_precision)}"
+            headers["Accept"] = accept
+        if self.deadline_ms is not None:
+            headers["X-NovaBridge-Deadline"] = str(int(self.deadline_ms))
         return headers
 
     async def _request(
@@ -88,21 +192,24 @@ class AsyncNovaBridge:
         runtime_token: Optional[str] = None,
         expect_bytes: bool = False,
         base_url_override: Optional[str] = None,
+        raw: Optional[bytes] = None,
     ) -> Any:
         session = await self._ensure_session()
         base = base_url_override or self.base_url
         url = f"{base}{route}"
         headers = self._build_headers(role=role, runtime_token=runtime_token)
+        if raw is not None:
+            headers["Content-Type"] = "application/octet-stream"
 
         last_error: Optional[Exception] = None
         for attempt in range(self.max_retries + 1):
             try:
-                async with session.request(method, url, json=data, headers=headers) as resp:
+                async with session.request(method, url, json=data if raw is None else None, data=raw, headers=headers) as resp:
                     payload = await resp.read()
                     if resp.status >= 400:
                         detail = payload.decode("utf-8", errors="replace")
                         if resp.status in (429, 500, 502, 503, 504) and attempt < self.max_retries:
-                            await asyncio.sleep(self.retry_backoff * (2**attempt))
+                            await asyncio.sleep(_retry_delay(resp.headers, self.retry_backoff, attempt))
                             continue
                         raise AsyncNovaBridgeError(f"HTTP {resp.status}: {detail}")
 
@@ -179,8 +286,59 @@ class AsyncNovaBridge:
             payload["risk"] = risk
         return await self._assistant_request("POST", "/execute", payload)
 
-    async def scene_list(self) -> Dict[str, Any]:
-        return await self._request("GET", "/scene/list")
+    async def scene_list(
+        self,
+        *,
+        cursor: Optional[str] = None,
+        limit: Optional[int] = None,
+        class_name: Optional[str] = None,
+        tag: Optional[str] = None,
+        fields: Optional[str] = None,
+    ) -> Dict[str, Any]:
+        route = "/scene/list"
+        params = _scene_list_params(cursor, limit, class_name, tag, fields)
+        if params:
+            route = f"{route}?{urllib.parse.urlencode(params)}"
+        return await self._request("GET", route)
+
+    async def scene_changes(self, since: int, *, fields: Optional[str] = None) -> Dict[str, Any]:
+        params: Dict[str, Any] = {"since": int(since)}
+        if fields:
+            params["fields"] = fields
+        return await self._request("GET", f"/scene/changes?{urllib.parse.urlencode(params)}")
+
+    async def scene_query(
+        self,
+        *,
+        box: Optional[Dict[str, Any]] = None,
+        sphere: Optional[Dict[str, Any]] = None,
+        frustum: Optional[Dict[str, Any]] = None,
+        classes: Optional[Any] = None,
+        tag: Optional[str] = None,
+        limit: Optional[int] = None,
+        fields: Optional[str] = None,
+    ) -> Dict[str, Any]:
+        body = _scene_query_body(box, sphere, frustum, classes, tag, limit, fields)
+        return await self._request("POST", "/scene/query", body)
+
+    async def transform_batch(self, updates: Any, *, binary: bool = False) -> Dict[str, Any]:
+        if binary:
+            return await self._request("POST", "/scene/transform-batch", raw=_pack_transform_batch(updates))
+        return await self._request("POST", "/scene/transform-batch", {"updates": list(updates)})
+
+    async def scene_get_many(
+        self,
+        properties: Any,
+        *,
+        names: Optional[Any] = None,
+        class_name: Optional[str] = None,
+        tag: Optional[str] = None,
+        limit: Optional[int] = None,
+        cursor: Optional[str] = None,
+        fields: Optional[str] = None,
+    ) -> Dict[str, Any]:
+        body = _scene_get_many_body(properties, names, class_name, tag, limit, cursor, fields)
+        return await self._request("POST", "/scene/get-many", body)
 
     async def execute_plan(self, steps: Any, *, plan_id: Optional[str] = None, role: Optional[str] = None) -> Dict[str, Any]:
         data: Dict[str, Any] = {"steps": steps}
@@ -221,6 +379,11 @@ class AsyncNovaBridge:
     async def undo(self, *, role: Optional[str] = None) -> Dict[str, Any]:
         return await self._request("POST", "/undo", data={}, role=role)
 
+    async def batch(
+        self, requests: Any, *, stop_on_error: bool = False, role: Optional[str] = None
+    ) -> Dict[str, Any]:
+        return await self._request("POST", "/batch", data={"requests": requests, "stop_on_error": stop_on_error}, role=role)
+
     async def runtime_pair(self, code: str, *, role: Optional[str] = None) -> Dict[str, Any]:
         body: Dict[str, Any] = {"code": code}
         if role:
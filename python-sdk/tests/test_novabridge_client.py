@@ -1,8 +1,12 @@
 from __future__ import annotations
 
+import io
 import json
+import struct
 import sys
 import unittest
+import urllib.error
+import zlib
 from pathlib import Path
 from unittest.mock import patch
 
@@ -15,8 +19,9 @@ from novabridge import NovaBridge  # noqa: E402
 
 
 class _FakeResponse:
-    def __init__(self, payload: bytes):
+    def __init__(self, payload: bytes, headers: dict | None = None):
         self._payload = payload
+        self.headers = headers or {}
 
     def read(self) -> bytes:
         return self._payload
@@ -44,6 +49,7 @@ class NovaBridgeClientTests(unittest.TestCase):
             role="automation",
             runtime_token="tok_test",
             timeout=17,
+            deadline_ms=5000,
         )
 
         with patch("urllib.request.urlopen", side_effect=fake_urlopen):
@@ -54,9 +60,93 @@ class NovaBridgeClientTests(unittest.TestCase):
         self.assertEqual(req.get_header("X-api-key"), "k_test")
         self.assertEqual(req.get_header("X-novabridge-role"), "automation")
         self.assertEqual(req.get_header("X-novabridge-token"), "tok_test")
+        self.assertEqual(req.get_header("X-novabridge-deadline"), "5000")
         self.assertEqual(req.full_url, "http://127.0.0.1:30123/nova/health")
         self.assertEqual(captured["timeout"], 17)
 
+    def test_scene_list_passes_paging_and_filter_params(self) -> None:
+        captured = {}
+
+        def fake_urlopen(req, timeout):  # type: ignore[no-untyped-def]
+            captured["req"] = req
+            return _FakeResponse(json.dumps({"status": "ok", "actors": []}).encode("utf-8"))
+
+        client = NovaBridge(host="127.0.0.1", port=30123)
+        with patch("urllib.request.urlopen", side_effect=fake_urlopen):
+            client.scene_list(cursor="Cube|42", limit=50, class_name="StaticMeshActor", fields="name,transform")
+
+        self.assertEqual(
+            captured["req"].full_url,
+            "http://127.0.0.1:30123/nova/scene/list?cursor=Cube%7C42&limit=50&class=StaticMeshActor&fields=name%2Ctransform",
+        )
+
+    def test_compress_requests_and_decodes_gzip_responses(self) -> None:
+        captured = {}
+        body = json.dumps({"status": "ok", "actors": [{"name": "Cube"}] * 100}).encode("utf-8")
+        compressor = zlib.compressobj(wbits=16 + zlib.MAX_WBITS)
+        gzipped = compressor.compress(body) + compressor.flush()
+
+        def fake_urlopen(req, timeout):  # type: ignore[no-untyped-def]
+            captured["req"] = req
+            return _FakeResponse(gzipped, {"Content-Encoding": "gzip"})
+
+        client = NovaBridge(compress=True)
+        with patch("urllib.request.urlopen", side_effect=fake_urlopen):
+            result = client.scene_list()
+
+        self.assertEqual(captured["req"].get_header("Accept-encoding"), "gzip, deflate")
+        self.assertEqual(len(result["actors"]), 100)
+
+    def test_busy_responses_wait_for_retry_after(self) -> None:
+        calls = []
+
+        def fake_urlopen(req, timeout):  # type: ignore[no-untyped-def]
+            calls.append(req.full_url)
+            if len(calls) == 1:
+                raise urllib.error.HTTPError(
+                    req.full_url, 503, "Service Unavailable", {"Retry-After": "2"}, io.BytesIO(b'{"status":"error"}')
+                )
+            return _FakeResponse(b'{"status":"ok"}')
+
+        client = NovaBridge(host="127.0.0.1", port=30010, max_retries=2, retry_backoff=0.25)
+        with patch("urllib.request.urlopen", side_effect=fake_urlopen), patch("time.sleep") as sleep:
+            result = client.health()
+
+        self.assertEqual(result["status"], "ok")
+        self.assertEqual(len(calls), 2)
+        sleep.assert_called_once_with(2.0)
+
+    def test_transform_batch_packs_binary_updates(self) -> None:
+        captured = {}
+
+        def fake_urlopen(req, timeout):  # type: ignore[no-untyped-def]
+            captured["req"] = req
+            return _FakeResponse(json.dumps({"status": "ok", "applied": 2}).encode("utf-8"))
+
+        updates = [
+            {"name": "Cube", "location": [1, 2, 3]},
+            {"name": "Lamp", "rotation": {"pitch": 0, "yaw": 90, "roll": 0}, "scale": [2, 2, 2]},
+        ]
+        client = NovaBridge(host="127.0.0.1", port=30123)
+        with patch("urllib.request.urlopen", side_effect=fake_urlopen):
+            client.transform_batch(updates, binary=True)
+
+        req = captured["req"]
+        self.assertEqual(req.full_url, "http://127.0.0.1:30123/nova/scene/transform-batch")
+        self.assertEqual(req.get_header("Content-type"), "application/octet-stream")
+        body = req.data
+        self.assertEqual(body[:4], b"NBTX")
+        self.assertEqual(struct.unpack_from("<III", body, 4), (1, 0, 2))
+        first = struct.unpack_from("<I9fI", body, 16)
+        self.assertEqual(first[0], 1)
+        self.assertEqual(first[1:4], (1.0, 2.0, 3.0))
+        self.assertEqual(body[60:64], b"Cube")
+        second = struct.unpack_from("<I9fI", body, 64)
+        self.assertEqual(second[0], 6)
+        self.assertEqual(second[5], 90.0)
+        self.assertEqual(second[7:10], (2.0, 2.0, 2.0))
+        self.assertEqual(len(body), 64 + 44 + len("Lamp"))
+
     def test_raw_viewport_screenshot_sends_auth_headers(self) -> None:
         captured = {}
         png_bytes = b"\x89PNG\r\n\x1a\nraw-bytes"